@@ -0,0 +1,61 @@
+/*
+AUTHOR:
+	Chris Pray
+
+DATE:
+	10/19/26
+
+FILENAME:
+	CapacityPolicy.h
+
+PURPOSE:
+	A CapacityPolicy is a struct that describes how an OrdListClass object grows and shrinks its list.
+	The defaults reproduce the constants in ABCListClass.h: the list doubles when full, halves when
+	less than 25% occupied, and never shrinks below MAX_ENTRIES.
+
+	To keep a list from growing and shrinking over and over when its length hovers around a threshold,
+	a policy must leave a gap (hysteresis) between the two triggers:
+		(1) shrinkTrigger < 1 / growthFactor, so that a list that has just grown is not immediately
+			shrunk by the next Delete.
+		(2) shrinkTrigger < shrinkFactor, so that a list that has just shrunk is not immediately
+			grown by the next Insert.
+	IsValidPolicy checks these conditions. OrdListClass rejects any policy that fails them.
+*/
+
+#ifndef CapacityPolicy_h
+#define CapacityPolicy_h
+
+#include "ABCListClass.h"	// For MAX_ENTRIES, EXPANSION_FACTOR, CONTRACTION_FACTOR, OCCUPANCY_TRIGGER
+
+struct CapacityPolicy
+{
+	float growthFactor;		// Size is multiplied by this when the list is full (> 1)
+	float shrinkFactor;		// Size is multiplied by this when the list is contracted (0 < f < 1)
+	float shrinkTrigger;	// The list is contracted when length < shrinkTrigger * size
+	int minCapacity;		// The list is never contracted below this size (>= 1)
+
+}; // End CapacityPolicy
+
+// The policy used by OrdListClass unless the client supplies another
+const CapacityPolicy DEFAULT_CAPACITY_POLICY = { float(EXPANSION_FACTOR),
+												 CONTRACTION_FACTOR,
+												 OCCUPANCY_TRIGGER,
+												 MAX_ENTRIES };
+
+//Purpose:	Determines whether policy is usable and leaves a gap between its grow and shrink triggers.
+//Pre:		None
+//Post:		True has been returned if growthFactor > 1, 0 < shrinkFactor < 1, minCapacity >= 1,
+//			0 <= shrinkTrigger, shrinkTrigger < 1 / growthFactor and shrinkTrigger < shrinkFactor.
+//			Otherwise false has been returned.
+inline bool IsValidPolicy(/* in */ const CapacityPolicy& policy)	// The policy to check
+{
+	return policy.growthFactor > 1.0f &&
+		   policy.shrinkFactor > 0.0f && policy.shrinkFactor < 1.0f &&
+		   policy.minCapacity >= 1 &&
+		   policy.shrinkTrigger >= 0.0f &&
+		   policy.shrinkTrigger * policy.growthFactor < 1.0f &&
+		   policy.shrinkTrigger < policy.shrinkFactor;
+
+} // End IsValidPolicy(const CapacityPolicy& policy)
+
+#endif
\ No newline at end of file
@@ -0,0 +1,578 @@
+/*
+AUTHOR:
+	Chris Pray
+
+DATE:
+	10/19/26
+
+FILENAME:
+	ConcurrentOrdList.cpp
+
+PURPOSE:
+	This file contains the implementation for all of the methods declared in ConcurrentOrdList.h
+*/
+
+#include "ConcurrentOrdList.h"	// For class declarations
+#include<algorithm>				// For stable_sort in InsertBatch
+#include<functional>			// For hash, used to spread threads over the reader slots
+#include<thread>				// For this_thread::get_id and this_thread::yield
+#include<new>					// For bad_alloc
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Implementation of File-scope Helpers
+
+//Purpose:	Returns the position of the first of length items whose key is less than or equal to key
+//			if inclusive is true, or less than key if it is false.
+//Pre:		items holds length items in descending order of key.
+//Post:		The position has been returned, or length if there is none.
+static int SearchVersion(/* in */ const ItemType items[],	// The items to search
+						 /* in */ int length,				// # of items
+						 /* in */ KeyType key,				// The key to bound
+						 /* in */ bool inclusive)			// True if an item whose key is key qualifies
+{
+	int first = 0;		// First position that may hold the bound
+	int last = length;	// One past the last position that may hold the bound
+	int middle;			// The position being compared
+
+	while(first < last)
+	{
+		middle = first + (last - first) / 2;
+
+		// If the bound is after middle
+		if(items[middle].key > key || (!inclusive && items[middle].key == key))
+		{
+			first = middle + 1;
+
+		} // End if
+		// Else the bound is at or before middle
+		else
+		{
+			last = middle;
+
+		} // End else
+
+	} // End while
+
+	return first;
+
+} // End SearchVersion(const ItemType items[], int length, KeyType key, bool inclusive)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+//Purpose:	Returns true if left belongs before right in a list, which is in descending order of key.
+//Pre:		None
+//Post:		True has been returned if left's key is greater than right's.
+static bool ComesBefore(/* in */ const ItemType& left,		// The first item to compare
+						/* in */ const ItemType& right)		// The second item to compare
+{
+	return left.key > right.key;
+
+} // End ComesBefore(const ItemType& left, const ItemType& right)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Implementation of ListSnapshot
+
+ListSnapshot::ListSnapshot(/* in */ ReaderSlot* pinnedSlot,				// The slot holding the pin
+						   /* in */ const ListVersion* pinnedVersion)	// The version to hold
+{
+	slot = pinnedSlot;
+	version = pinnedVersion;
+
+} // End ListSnapshot(ReaderSlot* pinnedSlot, const ListVersion* pinnedVersion)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+ListSnapshot::ListSnapshot(/* in */ ListSnapshot&& orig)	// The snapshot to take over
+{
+	slot = orig.slot;
+	version = orig.version;
+
+	// orig no longer holds the pin, so its destructor must not release it
+	orig.slot = NULL;
+
+} // End ListSnapshot(ListSnapshot&& orig)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+ListSnapshot::~ListSnapshot()
+{
+	// If the snapshot still holds its pin
+	if(slot != NULL)
+	{
+		// Free the slot. Release ordering keeps every read of the version before the slot is freed.
+		slot->epoch.store(IDLE_EPOCH, memory_order_release);
+
+	} // End if
+
+} // End ~ListSnapshot()
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+bool ListSnapshot::Find(/* in */ KeyType key,				// The key to search for
+						/* out */ ItemType& found) const	// Gets the item whose key is key
+{
+	int position = SearchVersion(version->items, version->length, key, true);	// Where key would be
+
+	// If key is at its position
+	if(position < version->length && version->items[position].key == key)
+	{
+		found = version->items[position];
+		return true;
+
+	} // End if
+
+	return false;
+
+} // End Find(KeyType key, ItemType& found)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+int ListSnapshot::LowerBound(/* in */ KeyType key) const	// The key to bound
+{
+	return SearchVersion(version->items, version->length, key, true);
+
+} // End LowerBound(KeyType key)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+int ListSnapshot::CountInRange(/* in */ KeyType lo,			// Smallest key in the range
+							   /* in */ KeyType hi) const	// Key just above the range
+{
+	return GetRange(lo, hi).Length();
+
+} // End CountInRange(KeyType lo, KeyType hi)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+ItemSpan ListSnapshot::GetRange(/* in */ KeyType lo,		// Smallest key in the range
+								/* in */ KeyType hi) const	// Key just above the range
+{
+	ItemSpan range;	// Gets the view of the range
+
+	// The range runs from the first key below hi to the first key below lo
+	range.first = version->items + SearchVersion(version->items, version->length, hi, false);
+	range.last = version->items + SearchVersion(version->items, version->length, lo, false);
+
+	// If the range holds no keys
+	if(range.last < range.first)
+	{
+		range.last = range.first;
+
+	} // End if
+
+	return range;
+
+} // End GetRange(KeyType lo, KeyType hi)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+int ListSnapshot::GetLength() const
+{
+	return version->length;
+
+} // End GetLength()
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+bool ListSnapshot::IsEmpty() const
+{
+	return version->length == 0;
+
+} // End IsEmpty()
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+unsigned long long ListSnapshot::GetVersion() const
+{
+	return version->number;
+
+} // End GetVersion()
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+const ItemType* ListSnapshot::begin() const
+{
+	return version->items;
+
+} // End begin()
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+const ItemType* ListSnapshot::end() const
+{
+	return version->items + version->length;
+
+} // End end()
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Implementation of ConcurrentOrdListClass
+
+ConcurrentOrdListClass::ConcurrentOrdListClass()
+{
+	ListVersion* firstVersion = AllocateVersion(0);	// The empty first version
+
+	firstVersion->number = 0;
+
+	// Epochs start after IDLE_EPOCH so that a pinned slot is never mistaken for a free one
+	globalEpoch.store(IDLE_EPOCH + 1);
+	current.store(firstVersion);
+
+	// Every reader slot starts free
+	for(int i = 0; i < MAX_READER_SLOTS; i++)
+	{
+		slots[i].epoch.store(IDLE_EPOCH);
+
+	} // End for
+
+} // End ConcurrentOrdListClass()
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+ConcurrentOrdListClass::ConcurrentOrdListClass(/* in */ const ItemType items[],	// The items to hold
+											   /* in */ int count)				// # of items
+{
+	ListVersion* firstVersion = AllocateVersion(count);	// The first version, holding the items
+
+	// Copy the items into the first version
+	for(int i = 0; i < count; i++)
+	{
+		firstVersion->items[i] = items[i];
+
+	} // End for
+
+	firstVersion->number = 0;
+
+	// Epochs start after IDLE_EPOCH so that a pinned slot is never mistaken for a free one
+	globalEpoch.store(IDLE_EPOCH + 1);
+	current.store(firstVersion);
+
+	// Every reader slot starts free
+	for(int i = 0; i < MAX_READER_SLOTS; i++)
+	{
+		slots[i].epoch.store(IDLE_EPOCH);
+
+	} // End for
+
+} // End ConcurrentOrdListClass(const ItemType items[], int count)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+ConcurrentOrdListClass::~ConcurrentOrdListClass()
+{
+	// No snapshot remains, so every version can be freed
+	for(size_t i = 0; i < retired.size(); i++)
+	{
+		FreeVersion(retired[i].version);
+
+	} // End for
+
+	FreeVersion(current.load());
+
+} // End ~ConcurrentOrdListClass()
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+ListSnapshot ConcurrentOrdListClass::GetSnapshot() const
+{
+	// Threads start looking for a free slot in different places so that they rarely contend for one
+	int start = int(hash<thread::id>()(this_thread::get_id()) % MAX_READER_SLOTS);
+	int index;								// The slot being tried
+	unsigned long long idle;				// Gets the slot's epoch if it is not free
+	unsigned long long epoch;				// The epoch to pin
+
+	for(;;)
+	{
+		// For each slot, starting at start
+		for(int i = 0; i < MAX_READER_SLOTS; i++)
+		{
+			index = (start + i) % MAX_READER_SLOTS;
+			idle = IDLE_EPOCH;
+			epoch = globalEpoch.load();
+
+			// If the slot is free, pin epoch in it. The pin is ordered before the load of current, so
+			//  a writer that replaces the version loaded below will see the pin and keep the version.
+			if(slots[index].epoch.compare_exchange_strong(idle, epoch))
+			{
+				return ListSnapshot(&slots[index], current.load());
+
+			} // End if
+
+		} // End for
+
+		// Every slot is held; let the holders run
+		this_thread::yield();
+
+	} // End for
+
+} // End GetSnapshot()
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+void ConcurrentOrdListClass::Insert(/* in */ const ItemType& target)	// The item to insert
+{
+	lock_guard<mutex> lock(writeLock);			// Keeps other writers out until Insert returns
+	ListVersion* oldVersion = current.load();	// The version being replaced
+	ListVersion* newVersion;					// Gets the version holding target
+	int position;								// Where target belongs
+
+	position = SearchVersion(oldVersion->items, oldVersion->length, target.key, true);
+
+	// If target is already in the list
+	if(position < oldVersion->length && oldVersion->items[position].key == target.key)
+	{
+		throw DuplicateKeyException(target.key,
+			"DuplicateKeyException: Attempt to insert a duplicate key failed.");
+
+	} // End if
+
+	newVersion = AllocateVersion(oldVersion->length + 1);
+
+	// Copy the items before position, then target, then the items after it
+	for(int i = 0; i < position; i++)
+	{
+		newVersion->items[i] = oldVersion->items[i];
+
+	} // End for
+
+	newVersion->items[position] = target;
+
+	for(int i = position; i < oldVersion->length; i++)
+	{
+		newVersion->items[i + 1] = oldVersion->items[i];
+
+	} // End for
+
+	Publish(newVersion);
+
+} // End Insert(const ItemType& target)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+int ConcurrentOrdListClass::InsertBatch(/* in */ const ItemType items[],	// The items to insert
+										/* in */ int count)					// # of items
+{
+	lock_guard<mutex> lock(writeLock);			// Keeps other writers out until InsertBatch returns
+	ListVersion* oldVersion = current.load();	// The version being replaced
+	ListVersion* newVersion;					// Gets the merged version
+	vector<ItemType> batch;						// The items, sorted into list order
+	int oldIndex = 0;							// The next item of oldVersion to merge
+	int batchIndex = 0;							// The next item of batch to merge
+	int newIndex = 0;							// The next position of newVersion to fill
+
+	try
+	{
+		batch.assign(items, items + count);
+
+	} // End try
+	catch(bad_alloc e)	// Failed to allocate memory
+	{
+		throw OutOfMemoryException("OutOfMemoryException : Not enough memory to complete operation.");
+
+	} // End catch(bad_alloc e)
+
+	// Sort the batch into list order. The sort is stable, so the first of several equal keys leads.
+	stable_sort(batch.begin(), batch.end(), ComesBefore);
+
+	newVersion = AllocateVersion(oldVersion->length + count);
+
+	// Merge the list and the batch, skipping batch items whose keys are already in newVersion
+	while(oldIndex < oldVersion->length || batchIndex < count)
+	{
+		// If the next batch item's key was just merged, or is the next key of the list
+		if(batchIndex < count &&
+		   ((newIndex > 0 && newVersion->items[newIndex - 1].key == batch[batchIndex].key) ||
+			(oldIndex < oldVersion->length && oldVersion->items[oldIndex].key == batch[batchIndex].key)))
+		{
+			batchIndex++;
+
+		} // End if
+		// Else if the next item of the list comes first
+		else if(batchIndex == count ||
+				(oldIndex < oldVersion->length && ComesBefore(oldVersion->items[oldIndex], batch[batchIndex])))
+		{
+			newVersion->items[newIndex++] = oldVersion->items[oldIndex++];
+
+		} // End else if
+		// Else the next batch item comes first
+		else
+		{
+			newVersion->items[newIndex++] = batch[batchIndex++];
+
+		} // End else
+
+	} // End while
+
+	newVersion->length = newIndex;
+
+	// oldVersion may be freed by Publish, so count the items inserted first
+	newIndex -= oldVersion->length;
+
+	// If every key was already in the list, there is nothing to publish
+	if(newIndex == 0)
+	{
+		FreeVersion(newVersion);
+
+	} // End if
+	// Else publish the merged version
+	else
+	{
+		Publish(newVersion);
+
+	} // End else
+
+	return newIndex;
+
+} // End InsertBatch(const ItemType items[], int count)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+bool ConcurrentOrdListClass::Delete(/* in */ KeyType key)	// The key of the item to delete
+{
+	lock_guard<mutex> lock(writeLock);			// Keeps other writers out until Delete returns
+	ListVersion* oldVersion = current.load();	// The version being replaced
+	ListVersion* newVersion;					// Gets the version without key
+	int position;								// Where key is
+
+	position = SearchVersion(oldVersion->items, oldVersion->length, key, true);
+
+	// If key is not in the list
+	if(position == oldVersion->length || oldVersion->items[position].key != key)
+	{
+		return false;
+
+	} // End if
+
+	newVersion = AllocateVersion(oldVersion->length - 1);
+
+	// Copy the items before and after position
+	for(int i = 0; i < position; i++)
+	{
+		newVersion->items[i] = oldVersion->items[i];
+
+	} // End for
+
+	for(int i = position + 1; i < oldVersion->length; i++)
+	{
+		newVersion->items[i - 1] = oldVersion->items[i];
+
+	} // End for
+
+	Publish(newVersion);
+
+	return true;
+
+} // End Delete(KeyType key)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+int ConcurrentOrdListClass::GetLength() const
+{
+	// Read the length through a snapshot, so that a writer cannot free the version while it is read
+	return GetSnapshot().GetLength();
+
+} // End GetLength()
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+ListVersion* ConcurrentOrdListClass::AllocateVersion(/* in */ int length)	// # of items the version holds
+{
+	ListVersion* newVersion = NULL;	// Gets the new version
+
+	try
+	{
+		newVersion = new ListVersion;
+
+		// Allocate at least one item so that items is never NULL
+		newVersion->items = new ItemType[(length > 0) ? length : 1];
+		newVersion->length = length;
+
+	} // End try
+	catch(bad_alloc e)	// Failed to allocate memory
+	{
+		delete newVersion;
+
+		throw OutOfMemoryException("OutOfMemoryException : Not enough memory to complete operation.");
+
+	} // End catch(bad_alloc e)
+
+	return newVersion;
+
+} // End AllocateVersion(int length)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+void ConcurrentOrdListClass::FreeVersion(/* in */ ListVersion* oldVersion)	// The version to free
+{
+	delete [] oldVersion->items;
+	delete oldVersion;
+
+} // End FreeVersion(ListVersion* oldVersion)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+void ConcurrentOrdListClass::Publish(/* in */ ListVersion* newVersion)	// The version to publish
+{
+	RetiredVersion replaced;						// The version newVersion replaces
+	unsigned long long oldestPin = ~0ull;			// Gets the oldest epoch any snapshot has pinned
+	unsigned long long pinned;						// The epoch pinned in a slot
+	size_t kept = 0;								// # of retired versions that must be kept
+
+	newVersion->number = current.load()->number + 1;
+
+	// Make room for the replaced version first, so that nothing can fail once newVersion is published
+	try
+	{
+		retired.reserve(retired.size() + 1);
+
+	} // End try
+	catch(bad_alloc e)	// Failed to allocate memory
+	{
+		FreeVersion(newVersion);
+
+		throw OutOfMemoryException("OutOfMemoryException : Not enough memory to complete operation.");
+
+	} // End catch(bad_alloc e)
+
+	// Swap in newVersion, then close the epoch in which the old version could still be loaded
+	replaced.version = current.exchange(newVersion);
+	replaced.epoch = globalEpoch.fetch_add(1);
+	retired.push_back(replaced);
+
+	// Find the oldest epoch still pinned
+	for(int i = 0; i < MAX_READER_SLOTS; i++)
+	{
+		pinned = slots[i].epoch.load();
+
+		if(pinned != IDLE_EPOCH && pinned < oldestPin)
+		{
+			oldestPin = pinned;
+
+		} // End if
+
+	} // End for
+
+	// A version replaced in an epoch before every pin can no longer be held by a snapshot: each
+	//  snapshot pinned later than that loaded a newer version
+	for(size_t i = 0; i < retired.size(); i++)
+	{
+		// If a snapshot may still hold the version
+		if(retired[i].epoch >= oldestPin)
+		{
+			retired[kept++] = retired[i];
+
+		} // End if
+		// Else nothing can reach it
+		else
+		{
+			FreeVersion(retired[i].version);
+
+		} // End else
+
+	} // End for
+
+	retired.resize(kept);
+
+} // End Publish(ListVersion* newVersion)
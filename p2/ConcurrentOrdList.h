@@ -0,0 +1,364 @@
+//FileName:			ConcurrentOrdList.h
+//Author:			Chris Pray
+//Date:				10/19/26
+//Project:			OrdList
+//
+//Purpose: This file contains the specification for an ordered list(descending) that many threads can
+//   search at once while other threads change it. OrdListClass keeps its cursor (currPos) inside the
+//   object, so even Find changes the list and no two threads can search the same OrdListClass object.
+//   A ConcurrentOrdListClass object has no cursor. Instead:
+//
+//   Readers call GetSnapshot() and search the ListSnapshot it returns. A snapshot is an immutable
+//   version of the list; taking one and searching it never locks and never waits on a writer, and
+//   each snapshot has its own iterators (begin() and end()).
+//
+//   Writers build a new version of the list beside the current one and publish it with a single
+//   atomic pointer swap, so a reader sees either the whole change or none of it. Writers are
+//   serialized by a mutex. InsertBatch merges many items into one new version, so a batch of N
+//   items costs one copy of the list instead of N.
+//
+//   Old versions are reclaimed by epochs. A snapshot pins the epoch it was taken in, and a version
+//   replaced in epoch E is freed once no snapshot pinned at or before E remains.
+//
+//                         SUMMARY OF METHODS
+//
+//	ConcurrentOrdListClass();
+//		Instantiates an empty ConcurrentOrdListClass object.
+//	ConcurrentOrdListClass(const ItemType items[], int count);
+//		Instantiates a ConcurrentOrdListClass object holding count items.
+//	~ConcurrentOrdListClass();
+//		Deallocates memory from a ConcurrentOrdListClass object
+//
+//	ListSnapshot GetSnapshot() const;
+//		Returns an immutable snapshot of the current version of the list.
+//	void Insert(const ItemType& target);
+//		Publishes a new version of the list with target inserted.
+//	int InsertBatch(const ItemType items[], int count);
+//		Publishes a new version of the list with every item in items whose key is not yet in it.
+//	bool Delete(KeyType key);
+//		Publishes a new version of the list without the item whose key is key.
+//	int GetLength() const;
+//		Returns the length of the current version of the list.
+//
+//	ListSnapshot:
+//	bool Find(KeyType key, ItemType& found) const;
+//		Searches the snapshot for key without changing it.
+//	int LowerBound(KeyType key) const;
+//		Returns the position of the first item whose key is less than or equal to key.
+//	int CountInRange(KeyType lo, KeyType hi) const;
+//		Returns the number of items whose keys are in [lo, hi).
+//	ItemSpan GetRange(KeyType lo, KeyType hi) const;
+//		Returns a view of the items whose keys are in [lo, hi).
+//	int GetLength() const;
+//		Returns the length of the snapshot.
+//	bool IsEmpty() const;
+//		Returns true if the snapshot holds no items.
+//	unsigned long long GetVersion() const;
+//		Returns the number of the version the snapshot holds.
+//	const ItemType* begin() const / end() const;
+//		Iterate over the items of the snapshot, highest key first.
+//
+//ASSUMPTIONS:
+// (1): No more than MAX_READER_SLOTS snapshots are held at once. GetSnapshot waits for one to be
+//		released when they are all in use.
+// (2): Every snapshot is released before the list it was taken from is destroyed.
+//
+//Exception Handling:
+//	bad_alloc is caught if an attempt to allocate dynamic memory fails, and OutOfMemoryException is
+//		thrown in its place.
+//	DuplicateKeyException is thrown by Insert when the key of the item is already in the list.
+//
+
+
+#ifndef ConcurrentOrdList_h
+#define ConcurrentOrdList_h
+
+#include<atomic>			// For atomic, used to publish versions and pin epochs
+#include<mutex>				// For mutex, used to serialize writers
+#include<vector>			// For the list of replaced versions waiting to be freed
+#include<cstddef>			// For NULL
+#include "OrdList.h"		// For ItemType, KeyType and ItemSpan
+#include "Exceptions.h"		// For custom exceptions, DuplicateKeyException and OutOfMemoryException
+using namespace std;
+using namespace nmspcExceptions;
+
+const int MAX_READER_SLOTS = 64;	// # of snapshots that can be held at once
+
+// One immutable version of a ConcurrentOrdListClass list
+struct ListVersion
+{
+	ItemType* items;				// The items, in descending order of key
+	int length;						// # of items
+	unsigned long long number;		// Counts the versions published by the list, starting at 0
+
+}; // End ListVersion
+
+// Records the epoch a snapshot was taken in. Each slot is on its own cache line so that readers
+//  pinning different slots do not slow each other down.
+struct alignas(64) ReaderSlot
+{
+	atomic<unsigned long long> epoch;	// The pinned epoch, or IDLE_EPOCH if the slot is free
+
+}; // End ReaderSlot
+
+const unsigned long long IDLE_EPOCH = 0;	// The epoch held by a free ReaderSlot
+
+// Class Declarations
+class ListSnapshot
+{
+	friend class ConcurrentOrdListClass;	// The only class that can take a snapshot
+
+	public:
+
+		ListSnapshot(ListSnapshot&& orig);	// The snapshot to take over
+		//Purpose:				Instantiates a ListSnapshot that takes over orig's version and pin.
+		//Pre:					orig exists
+		//Post:					The applying object holds orig's version. orig holds nothing.
+		//Classification:		Move Constructor
+		//Order of Magnitude:	O(1)
+
+
+		~ListSnapshot();
+		//Purpose:				Releases the snapshot so that the version it holds can be freed.
+		//Pre:					A ListSnapshot object exists
+		//Post:					The snapshot's reader slot is free.
+		//Classification:		Destructor
+		//Order of Magnitude:	O(1)
+
+
+		bool Find(/* in */ KeyType key,					// The key to search for
+				  /* out */ ItemType& found) const;		// Gets the item whose key is key
+		//Purpose:				Searches the snapshot for key.
+		//Pre:					The snapshot holds a version.
+		//Post:					If key is in the snapshot, true has been returned and found holds its
+		//						item. Otherwise false has been returned and found is unchanged.
+		//Classification:		Observer / Predicator
+		//Order of Magnitude:	O(logN)
+
+
+		int LowerBound(/* in */ KeyType key) const;	// The key to bound
+		//Purpose:				Returns the position of the first item whose key is less than or equal
+		//						to key.
+		//Pre:					The snapshot holds a version.
+		//Post:					The position has been returned, or the length if there is none.
+		//Classification:		Observer / Accessor
+		//Order of Magnitude:	O(logN)
+
+
+		int CountInRange(/* in */ KeyType lo,			// Smallest key in the range
+						 /* in */ KeyType hi) const;	// Key just above the range
+		//Purpose:				Returns the number of items whose keys are in [lo, hi).
+		//Pre:					The snapshot holds a version.
+		//Post:					The number of items where lo <= key < hi has been returned. If hi <= lo,
+		//						0 has been returned.
+		//Classification:		Observer / Summarizer
+		//Order of Magnitude:	O(logN)
+
+
+		ItemSpan GetRange(/* in */ KeyType lo,			// Smallest key in the range
+						  /* in */ KeyType hi) const;	// Key just above the range
+		//Purpose:				Returns a view of the items whose keys are in [lo, hi). Unlike
+		//						OrdListClass::GetRange, the view stays valid for the life of the
+		//						snapshot no matter how the list changes.
+		//Pre:					The snapshot holds a version.
+		//Post:					An ItemSpan over the items where lo <= key < hi has been returned.
+		//Classification:		Observer / Accessor
+		//Order of Magnitude:	O(logN)
+
+
+		int GetLength() const;
+		//Purpose:				Returns the number of items in the snapshot.
+		//Pre:					The snapshot holds a version.
+		//Post:					The length of the snapshot has been returned.
+		//Classification:		Observer / Accessor
+		//Order of Magnitude:	O(1)
+
+
+		bool IsEmpty() const;
+		//Purpose:				Determines whether the snapshot holds no items.
+		//Pre:					The snapshot holds a version.
+		//Post:					True has been returned if the snapshot is empty, false otherwise.
+		//Classification:		Observer / Predicator
+		//Order of Magnitude:	O(1)
+
+
+		unsigned long long GetVersion() const;
+		//Purpose:				Returns the number of the version the snapshot holds. Two snapshots with
+		//						the same number hold the same items.
+		//Pre:					The snapshot holds a version.
+		//Post:					The version number has been returned.
+		//Classification:		Observer / Accessor
+		//Order of Magnitude:	O(1)
+
+
+		const ItemType* begin() const;
+		//Purpose:				Returns an iterator to the first (highest) item of the snapshot.
+		//Pre:					The snapshot holds a version.
+		//Post:					A pointer to the first item has been returned.
+		//Classification:		Observer / Accessor
+		//Order of Magnitude:	O(1)
+
+
+		const ItemType* end() const;
+		//Purpose:				Returns an iterator one past the last item of the snapshot.
+		//Pre:					The snapshot holds a version.
+		//Post:					A pointer one past the last item has been returned.
+		//Classification:		Observer / Accessor
+		//Order of Magnitude:	O(1)
+
+
+		ListSnapshot(const ListSnapshot&) = delete;				// Each snapshot owns its reader slot
+		ListSnapshot& operator=(const ListSnapshot&) = delete;	// Each snapshot owns its reader slot
+
+	private:
+
+		ListSnapshot(/* in */ ReaderSlot* pinnedSlot,				// The slot holding the pin
+					 /* in */ const ListVersion* pinnedVersion);	// The version to hold
+		//Purpose:				Instantiates a ListSnapshot holding pinnedVersion.
+		//Pre:					pinnedSlot is pinned to an epoch that protects pinnedVersion.
+		//Post:					A ListSnapshot holding pinnedVersion has been instantiated.
+		//Classification:		Non-default Constructor
+		//Order of Magnitude:	O(1)
+
+
+		ReaderSlot* slot;				// The slot pinning the snapshot's epoch, or NULL once moved from
+		const ListVersion* version;		// The version the snapshot holds
+
+}; // End ListSnapshot
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+class ConcurrentOrdListClass
+{
+	public:
+
+		ConcurrentOrdListClass();
+		//Purpose:				Instantiates an empty ConcurrentOrdListClass object.
+		//Pre:					None
+		//Post:					An empty ConcurrentOrdListClass object has been instantiated.
+		//Classification:		Default Constructor
+		//Order of Magnitude:	O(1)
+		//Exceptions Thrown:	OutOfMemoryException
+
+
+		ConcurrentOrdListClass(/* in */ const ItemType items[],	// The items to hold
+							   /* in */ int count);				// # of items
+		//Purpose:				Instantiates a ConcurrentOrdListClass object holding count items.
+		//Pre:					items holds count items with unique keys, in descending order of key.
+		//Post:					A ConcurrentOrdListClass object holding the items has been instantiated.
+		//Classification:		Non-default Constructor
+		//Order of Magnitude:	O(N), where N is count
+		//Exceptions Thrown:	OutOfMemoryException
+
+
+		~ConcurrentOrdListClass();
+		//Purpose:				Deallocates memory from a ConcurrentOrdListClass object
+		//Pre:					No snapshot of the list is held.
+		//Post:					The ConcurrentOrdListClass object has been destroyed
+		//Classification:		Destructor
+		//Order of Magnitude:	O(V), where V is the number of versions waiting to be freed
+
+
+		ListSnapshot GetSnapshot() const;
+		//Purpose:				Returns an immutable snapshot of the current version of the list. Never
+		//						locks, and never waits on a writer.
+		//Pre:					List has been instantiated.
+		//Post:					A snapshot of the current version has been returned. The version will not
+		//						be freed until the snapshot is released.
+		//Classification:		Observer / Accessor
+		//Order of Magnitude:	O(1), or O(MAX_READER_SLOTS) when many snapshots are held
+
+
+		void Insert(/* in */ const ItemType& target);	// The item to insert
+		//Purpose:				Publishes a new version of the list with target inserted in order.
+		//Pre:					List has been instantiated.
+		//Post:					The current version of the list holds target. Snapshots already taken
+		//						are unchanged.
+		//Classification:		Mutator
+		//Order of Magnitude:	O(N), where N is the length of the list
+		//Exceptions Thrown:	DuplicateKeyException, OutOfMemoryException
+
+
+		int InsertBatch(/* in */ const ItemType items[],	// The items to insert
+						/* in */ int count);				// # of items
+		//Purpose:				Publishes one new version of the list holding every item in items whose
+		//						key is not already in the list. The items may be in any order; when
+		//						several share a key, the first is kept.
+		//Pre:					List has been instantiated. count >= 0
+		//Post:					The current version of the list holds every key in items. The number of
+		//						items inserted has been returned.
+		//Classification:		Mutator
+		//Order of Magnitude:	O(N + M logM), where N is the length of the list and M is count
+		//Exceptions Thrown:	OutOfMemoryException
+
+
+		bool Delete(/* in */ KeyType key);	// The key of the item to delete
+		//Purpose:				Publishes a new version of the list without the item whose key is key.
+		//Pre:					List has been instantiated.
+		//Post:					If key was in the list, a version without it has been published and true
+		//						has been returned. Otherwise false has been returned.
+		//Classification:		Mutator
+		//Order of Magnitude:	O(N), where N is the length of the list
+		//Exceptions Thrown:	OutOfMemoryException
+
+
+		int GetLength() const;
+		//Purpose:				Returns the length of the current version of the list. Another thread
+		//						may change it at any time; take a snapshot to get a length that holds.
+		//Pre:					List has been instantiated.
+		//Post:					The length of the current version has been returned.
+		//Classification:		Observer / Accessor
+		//Order of Magnitude:	O(1)
+
+
+		ConcurrentOrdListClass(const ConcurrentOrdListClass&) = delete;				// Not copyable
+		ConcurrentOrdListClass& operator=(const ConcurrentOrdListClass&) = delete;	// Not copyable
+
+	private:
+
+		static ListVersion* AllocateVersion(/* in */ int length);	// # of items the version holds
+		//Purpose:				Allocates a version with room for length items.
+		//Pre:					length >= 0
+		//Post:					A version whose length is length has been returned. Its items and number
+		//						are not set.
+		//Classification:		Mutator
+		//Order of Magnitude:	O(1)
+		//Exceptions Thrown:	OutOfMemoryException
+
+
+		static void FreeVersion(/* in */ ListVersion* oldVersion);	// The version to free
+		//Purpose:				Returns a version and its items back to the heap.
+		//Pre:					oldVersion was returned by AllocateVersion.
+		//Post:					oldVersion has been freed.
+		//Classification:		Mutator
+		//Order of Magnitude:	O(1)
+
+
+		void Publish(/* in */ ListVersion* newVersion);	// The version to publish
+		//Purpose:				Makes newVersion the current version, retires the version it replaces,
+		//						and frees every retired version no snapshot can still hold.
+		//Pre:					The calling thread holds writeLock. newVersion's items are set.
+		//Post:					newVersion is the current version.
+		//Classification:		Mutator
+		//Order of Magnitude:	O(MAX_READER_SLOTS + V), where V is the number of retired versions
+		//Exceptions Thrown:	OutOfMemoryException, in which case newVersion has been freed and the
+		//						current version is unchanged
+
+
+		// A version that has been replaced, and the epoch in which it was replaced
+		struct RetiredVersion
+		{
+			ListVersion* version;			// The replaced version
+			unsigned long long epoch;		// The epoch in which it was replaced
+
+		}; // End RetiredVersion
+
+		atomic<ListVersion*> current;					// The version new snapshots are taken of
+		atomic<unsigned long long> globalEpoch;			// Advances each time a version is replaced
+		mutable ReaderSlot slots[MAX_READER_SLOTS];		// The epoch pinned by each held snapshot
+		mutex writeLock;								// Held by the thread changing the list
+		vector<RetiredVersion> retired;					// Replaced versions not yet freed
+
+}; // End ConcurrentOrdListClass
+
+#endif
\ No newline at end of file
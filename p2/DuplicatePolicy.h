@@ -0,0 +1,41 @@
+/*
+AUTHOR:
+	Chris Pray
+
+DATE:
+	10/19/26
+
+FILENAME:
+	DuplicatePolicy.h
+
+PURPOSE:
+	A DuplicatePolicy tells an OrdListClass object what to do when an item is inserted whose key is
+	already in the list:
+		REJECT_DUPLICATES	The list is a set. Insert throws DuplicateKeyException and TryInsert
+							returns DUPLICATE_REJECTED. This is the default.
+		COUNT_DUPLICATES	The list is a multiset. Each key is stored once, with a count of how many
+							times it has been inserted, and Delete removes one copy at a time.
+
+	An InsertStatus is returned by OrdListClass::TryInsert to say what happened to the item, so that
+	duplicates can be handled with a compare instead of a thrown exception.
+*/
+
+#ifndef DuplicatePolicy_h
+#define DuplicatePolicy_h
+
+enum DuplicatePolicy
+{
+	REJECT_DUPLICATES,	// Inserting a key already in the list fails
+	COUNT_DUPLICATES	// Inserting a key already in the list adds one to its count
+
+}; // End DuplicatePolicy
+
+enum InsertStatus
+{
+	INSERTED,			// The item was inserted into the list
+	DUPLICATE_COUNTED,	// The key was already in the list, and its count was increased
+	DUPLICATE_REJECTED	// The key was already in the list, and the list was not changed
+
+}; // End InsertStatus
+
+#endif
\ No newline at end of file
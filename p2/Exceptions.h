@@ -13,6 +13,9 @@ PURPOSE:
 	used with OrdListClass objects. DuplicateKeyException should be thrown whenever an item is attempted
 	to be inserted into a list when the key of the item matches the key of an item already in the list.
 	OutOfMemoryException should be thrown whenever an attempt to allocate dynamic memory fails.
+	InvalidCapacityPolicyException should be thrown whenever a list is given a CapacityPolicy that
+	IsValidPolicy rejects. ListFileException should be thrown whenever a list cannot be saved to or
+	opened from a file, or the file is not a valid list file.
 
 SUMMARY OF METHODS:
 	
@@ -29,6 +32,18 @@ SUMMARY OF METHODS:
 		Returns PDM message which is set when the exception is thrown.
 	DuplicateKeyException::GetKey()
 		Returns PDM key which is set when the exception is thrown.
+
+	InvalidCapacityPolicyException::InvalidCapacityPolicyException(string msg)
+		Non-default constructor for an InvalidCapacityPolicyException object. msg is a message passed
+		when the exception is thrown.
+	InvalidCapacityPolicyException::GetMessage()
+		Returns PDM message which is set when the exception is thrown.
+
+	ListFileException::ListFileException(string msg)
+		Non-default constructor for a ListFileException object. msg is a message passed when the
+		exception is thrown.
+	ListFileException::GetMessage()
+		Returns PDM message which is set when the exception is thrown.
 */
 
 #ifndef Exceptions_h
@@ -109,6 +124,66 @@ namespace nmspcExceptions
 
 	}; // End DuplicateKeyException
 
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+	class InvalidCapacityPolicyException
+	{
+		private:
+
+			string message;	// A message to the user explaining why the exception was thrown
+
+		public:
+
+			//Purpose:	Instantiates an InvalidCapacityPolicyException object
+			//Pre:		None
+			//Post:		An InvalidCapacityPolicyException object has been instantiated
+			InvalidCapacityPolicyException(string msg)	// Message that gets assigned to PDM, message
+			{
+				message = msg;
+
+			} // End InvalidCapacityPolicyException(string msg)
+
+			//Purpose:	Returns a message stating why the exception was thrown
+			//Pre:		An InvalidCapacityPolicyException object has been instantiated
+			//Post:		The message stating why the exception was thrown has been returned
+			string GetMessage()
+			{
+				return message;
+
+			} // End GetMessage()
+
+	}; // End InvalidCapacityPolicyException
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+	class ListFileException
+	{
+		private:
+
+			string message;	// A message to the user explaining why the exception was thrown
+
+		public:
+
+			//Purpose:	Instantiates a ListFileException object
+			//Pre:		None
+			//Post:		A ListFileException object has been instantiated
+			ListFileException(string msg)	// Message that gets assigned to PDM, message
+			{
+				message = msg;
+
+			} // End ListFileException(string msg)
+
+			//Purpose:	Returns a message stating why the exception was thrown
+			//Pre:		A ListFileException object has been instantiated
+			//Post:		The message stating why the exception was thrown has been returned
+			string GetMessage()
+			{
+				return message;
+
+			} // End GetMessage()
+
+	}; // End ListFileException
+
 } // End nmspcExceptions
 
 #endif
\ No newline at end of file
@@ -0,0 +1,833 @@
+/*
+AUTHOR:
+	Chris Pray
+
+DATE:
+	10/19/26
+
+FILENAME:
+	FrozenOrdList.cpp
+
+PURPOSE:
+	This file contains the implementation for all of the methods declared in FrozenOrdList.h
+*/
+
+#include "FrozenOrdList.h"	// For class declarations
+#include<cstring>			// For memcpy
+#include<new>				// For bad_alloc
+#include<vector>			// For the keys in common in operator*
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include<emmintrin.h>		// For SSE2 intrinsics used to decode blocks
+#define FROZEN_USE_SSE2
+#endif
+
+const int EXCEPTION_COST = 40;	// # of bits an exception costs: an 8-bit position and a 32-bit high part
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Implementation of File-scope Helpers
+
+//Purpose:	Returns the number of bits needed to hold value (0 for 0).
+//Pre:		None
+//Post:		The bit length of value has been returned.
+static int BitLength(/* in */ unsigned int value)	// The value to measure
+{
+	int bits = 0;	// Gets the bit length of value
+
+	while(value != 0)
+	{
+		bits++;
+		value >>= 1;
+
+	} // End while
+
+	return bits;
+
+} // End BitLength(unsigned int value)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+//Purpose:	Fills gaps with the gap, less one, between each pair of consecutive keys in a block.
+//Pre:		keys holds count >= 1 unique keys in descending order.
+//Post:		gaps[i] holds keys[i] - keys[i + 1] - 1 for 0 <= i < count - 1.
+static void ComputeGaps(/* in */ const KeyType keys[],	// The block's keys
+						/* in */ int count,				// # of keys in the block
+						/* out */ unsigned int gaps[])	// Gets the gaps
+{
+	for(int i = 0; i < count - 1; i++)
+	{
+		// Unsigned arithmetic is exact even when the keys span the whole range of KeyType
+		gaps[i] = unsigned(keys[i]) - unsigned(keys[i + 1]) - 1u;
+
+	} // End for
+
+} // End ComputeGaps(const KeyType keys[], int count, unsigned int gaps[])
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+//Purpose:	Chooses the width that packs count gaps into the fewest bits, counting EXCEPTION_COST bits
+//			for each gap that does not fit.
+//Pre:		gaps holds count values.
+//Post:		The chosen width has been returned. numExceptions is the # of gaps wider than it.
+static int ChooseWidth(/* in */ const unsigned int gaps[],	// The gaps to pack
+					   /* in */ int count,					// # of gaps
+					   /* out */ int& numExceptions)		// Gets # of gaps wider than the width
+{
+	int wider[33] = {0};	// wider[b] gets # of gaps needing more than b bits
+	int bestWidth = 0;		// The cheapest width so far
+	int bestCost;			// # of bits bestWidth costs
+
+	// For each width, count the gaps that need more bits than it
+	for(int i = 0; i < count; i++)
+	{
+		int bits = BitLength(gaps[i]);	// Bit length of the gap
+
+		// Every width below bits is too narrow for this gap
+		for(int b = 0; b < bits; b++)
+		{
+			wider[b]++;
+
+		} // End for
+
+	} // End for
+
+	bestCost = wider[0] * EXCEPTION_COST;
+
+	// Try each wider width; no gap needs more than 32 bits, so width 32 has no exceptions
+	for(int b = 1; b <= 32; b++)
+	{
+		int cost = b * count + wider[b] * EXCEPTION_COST;	// # of bits width b costs
+
+		if(cost < bestCost)
+		{
+			bestCost = cost;
+			bestWidth = b;
+
+		} // End if
+
+	} // End for
+
+	numExceptions = wider[bestWidth];
+
+	return bestWidth;
+
+} // End ChooseWidth(const unsigned int gaps[], int count, int& numExceptions)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+//Purpose:	Returns the # of words needed to pack count values of width bits.
+//Pre:		0 <= width <= 32
+//Post:		The # of words has been returned.
+static int WordsFor(/* in */ int count,		// # of values
+					/* in */ int width)		// # of bits per value
+{
+	return int((long long)(count) * width + 31) / 32;
+
+} // End WordsFor(int count, int width)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Implementation of Constructors/Destructors
+
+FrozenOrdListClass::FrozenOrdListClass()
+{
+	blocks = NULL;
+	numBlocks = EMPTY;
+	length = EMPTY;
+	packed = NULL;
+	numWords = EMPTY;
+	exceptionPositions = NULL;
+	exceptionHighs = NULL;
+	numExceptions = EMPTY;
+
+} // End FrozenOrdListClass()
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+FrozenOrdListClass::FrozenOrdListClass(/* in */ const KeyType keys[],	// Keys in descending order
+									   /* in */ int count)				// # of keys
+{
+	blocks = NULL;
+	numBlocks = EMPTY;
+	length = EMPTY;
+	packed = NULL;
+	numWords = EMPTY;
+	exceptionPositions = NULL;
+	exceptionHighs = NULL;
+	numExceptions = EMPTY;
+
+	Build(keys, count);
+
+} // End FrozenOrdListClass(const KeyType keys[], int count)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+FrozenOrdListClass::FrozenOrdListClass(const FrozenOrdListClass& orig)	// The original list
+{
+	blocks = NULL;
+	numBlocks = EMPTY;
+	length = EMPTY;
+	packed = NULL;
+	numWords = EMPTY;
+	exceptionPositions = NULL;
+	exceptionHighs = NULL;
+	numExceptions = EMPTY;
+
+	CopyFrom(orig);
+
+} // End FrozenOrdListClass(const FrozenOrdListClass& orig)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+FrozenOrdListClass::~FrozenOrdListClass()
+{
+	Free();
+
+} // End ~FrozenOrdListClass()
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Implementation of Public Methods
+
+bool FrozenOrdListClass::Find(/* in */ KeyType key) const	// The key to search for
+{
+	int block = FindBlock(key);	// The only block that can hold key
+	bool found = false;			// Gets true if key is in the list
+
+	// If key falls within the block's range
+	if(block < numBlocks && !(blocks[block].firstKey < key))
+	{
+		KeyType keys[FROZEN_BLOCK_KEYS];			// The block's keys
+		int count = DecodeBlock(block, keys);	// # of keys in the block
+		int first = 0;							// Bounds of the section of the block being searched
+		int last = count - 1;
+
+		// Binary search the decoded block
+		while(first <= last && !found)
+		{
+			int mid = (first + last) / 2;	// The position compared with key
+
+			if(key < keys[mid])
+			{
+				first = mid + 1;
+
+			} // End if
+			else if(key > keys[mid])
+			{
+				last = mid - 1;
+
+			} // End else if
+			else
+			{
+				found = true;
+
+			} // End else
+
+		} // End while
+
+	} // End if
+
+	return found;
+
+} // End Find(KeyType key)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+int FrozenOrdListClass::CountInRange(/* in */ KeyType lo,			// Smallest key in the range
+									 /* in */ KeyType hi) const	// Key just above the range
+{
+	int count = EMPTY;	// # of keys in the range
+
+	// If the range is not empty
+	if(lo < hi)
+	{
+		count = CountAtLeast(lo) - CountAtLeast(hi);
+
+	} // End if
+
+	return count;
+
+} // End CountInRange(KeyType lo, KeyType hi)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+void FrozenOrdListClass::ScanRange(/* in */ KeyType lo,				// Smallest key in the range
+								   /* in */ KeyType hi,				// Key just above the range
+								   /* in */ KeyFunctionType visit,	// Called on each key in the range
+								   /* in */ void* context) const	// Passed through to visit
+{
+	KeyType keys[FROZEN_BLOCK_KEYS];	// The keys of the block being scanned
+	int block = numBlocks;				// The block being scanned
+	bool moreToScan = true;				// Gets false once a key below lo has been reached
+
+	// If the range is not empty, start at the first block holding a key below hi; every block before
+	//  it lies above the range
+	if(lo < hi)
+	{
+		block = FindBlock(hi - 1);
+
+	} // End if
+
+	for(; block < numBlocks && moreToScan; block++)
+	{
+		int count = DecodeBlock(block, keys);	// # of keys in the block
+
+		for(int i = 0; i < count && moreToScan; i++)
+		{
+			// If the key is below the range, so is every key after it
+			if(keys[i] < lo)
+			{
+				moreToScan = false;
+
+			} // End if
+			// Else if the key is in the range
+			else if(keys[i] < hi)
+			{
+				visit(keys[i], context);
+
+			} // End else if
+
+		} // End for
+
+	} // End for
+
+} // End ScanRange(KeyType lo, KeyType hi, KeyFunctionType visit, void* context)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+int FrozenOrdListClass::GetLength() const
+{
+	return length;
+
+} // End GetLength()
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+bool FrozenOrdListClass::IsEmpty() const
+{
+	return length == EMPTY;
+
+} // End IsEmpty()
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+int FrozenOrdListClass::GetMemoryUsage() const
+{
+	int bytes = numBlocks * int(sizeof(FrozenBlock));	// Gets the # of bytes used
+
+	// If there is a packed array, count its padding word too
+	if(packed != NULL)
+	{
+		bytes += (numWords + 1) * int(sizeof(unsigned int));
+
+	} // End if
+
+	bytes += numExceptions * int(sizeof(unsigned char) + sizeof(unsigned int));
+
+	return bytes;
+
+} // End GetMemoryUsage()
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+void FrozenOrdListClass::Print() const
+{
+	// If the list is not empty
+	if(!IsEmpty())
+	{
+		KeyType keys[FROZEN_BLOCK_KEYS];	// The keys of the block being printed
+		int index = 0;						// The position of the key in the list
+
+		// For each block in the list
+		for(int block = 0; block < numBlocks; block++)
+		{
+			int count = DecodeBlock(block, keys);	// # of keys in the block
+
+			for(int i = 0; i < count; i++)
+			{
+				cout << "Index " << index << ": " << keys[i] << endl;
+				index++;
+
+			} // End for
+
+		} // End for
+
+	} // End if
+	// Else the list is empty
+	else
+	{
+		cout << "The list is empty." << endl;
+
+	} // End else
+
+	cout << "Length: " << GetLength() << endl
+		 << "Blocks: " << numBlocks << endl
+		 << "Bytes: " << GetMemoryUsage() << endl;
+
+} // End Print()
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Implementation of Operators that were Overloaded
+
+FrozenOrdListClass FrozenOrdListClass::operator*(const FrozenOrdListClass& rtOp) const	// List to intersect
+{
+	KeyType leftKeys[FROZEN_BLOCK_KEYS];		// The keys of the applying object's current block
+	KeyType rightKeys[FROZEN_BLOCK_KEYS];		// The keys of rtOp's current block
+	vector<KeyType> common;						// Gets the keys found in both lists; freed even
+												//  if Build throws
+	int numCommon = 0;							// # of keys in common
+	int left = 0;								// The applying object's current block
+	int right = 0;								// rtOp's current block
+	int i = 0;									// Position in leftKeys
+	int j = 0;									// Position in rightKeys
+	int leftDecoded = -1;						// The block decoded into leftKeys, or -1
+	int rightDecoded = -1;						// The block decoded into rightKeys, or -1
+	FrozenOrdListClass frozenIntersection;		// Gets the intersection
+
+	try
+	{
+		// There can be no more keys in common than are in the shorter list
+		common.resize((length < rtOp.length) ? length + 1 : rtOp.length + 1);
+
+	} // End try
+	catch(bad_alloc e)	// Failed to allocate memory
+	{
+		throw OutOfMemoryException("OutOfMemoryException : Not enough memory to complete operation.");
+
+	} // End catch(bad_alloc e)
+
+	// While both lists have blocks left
+	while(left < numBlocks && right < rtOp.numBlocks)
+	{
+		const FrozenBlock& leftBlock = blocks[left];			// Skip index entry of left's block
+		const FrozenBlock& rightBlock = rtOp.blocks[right];	// Skip index entry of right's block
+
+		// If the applying object's block lies entirely above rtOp's, skip the rest of it undecoded
+		if(rightBlock.firstKey < leftBlock.lastKey)
+		{
+			left++;
+			i = 0;
+
+		} // End if
+		// Else if rtOp's block lies entirely above the applying object's, skip the rest of it undecoded
+		else if(leftBlock.firstKey < rightBlock.lastKey)
+		{
+			right++;
+			j = 0;
+
+		} // End else if
+		// Else the blocks overlap, so merge their keys; a block merged with the previous block of the
+		//  other list resumes where that merge stopped
+		else
+		{
+			int leftCount;	// # of keys in left's block
+			int rightCount;	// # of keys in right's block
+
+			// Decode each block only the first time it is merged
+			if(leftDecoded != left)
+			{
+				DecodeBlock(left, leftKeys);
+				leftDecoded = left;
+
+			} // End if
+
+			if(rightDecoded != right)
+			{
+				rtOp.DecodeBlock(right, rightKeys);
+				rightDecoded = right;
+
+			} // End if
+
+			leftCount = leftBlock.numKeys;
+			rightCount = rightBlock.numKeys;
+
+			while(i < leftCount && j < rightCount)
+			{
+				if(leftKeys[i] > rightKeys[j])
+				{
+					i++;
+
+				} // End if
+				else if(leftKeys[i] < rightKeys[j])
+				{
+					j++;
+
+				} // End else if
+				else
+				{
+					common[numCommon] = leftKeys[i];
+					numCommon++;
+
+					i++;
+					j++;
+
+				} // End else
+
+			} // End while
+
+			// If the applying object's block has been merged to its end, move to its next block
+			if(i == leftCount)
+			{
+				left++;
+				i = 0;
+
+			} // End if
+
+			// If rtOp's block has been merged to its end, move to its next block
+			if(j == rightCount)
+			{
+				right++;
+				j = 0;
+
+			} // End if
+
+		} // End else
+
+	} // End while
+
+	frozenIntersection.Build(common.data(), numCommon);
+
+	return frozenIntersection;
+
+} // End operator*(const FrozenOrdListClass& rtOp) const
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+FrozenOrdListClass& FrozenOrdListClass::operator=(const FrozenOrdListClass& orig)	// Object to assign
+{
+	// If the applying object is not orig
+	if(this != &orig)
+	{
+		Free();
+		CopyFrom(orig);
+
+	} // End if
+
+	return *this;
+
+} // End operator=(const FrozenOrdListClass& orig)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Implementation of Private Methods
+
+void FrozenOrdListClass::Build(/* in */ const KeyType keys[],	// Keys in descending order
+							   /* in */ int count)				// # of keys
+{
+	unsigned int gaps[FROZEN_BLOCK_KEYS];	// The gaps of the block being packed
+	int wordOffset = 0;						// Gets the first word of each block
+	int exceptionOffset = 0;				// Gets the first exception of each block
+
+	Free();
+
+	// If there are no keys, the list is left empty
+	if(count > 0)
+	{
+		numBlocks = (count + FROZEN_BLOCK_KEYS - 1) / FROZEN_BLOCK_KEYS;
+
+		try
+		{
+			blocks = new FrozenBlock[numBlocks];
+
+		} // End try
+		catch(bad_alloc e)	// Failed to allocate memory
+		{
+			numBlocks = EMPTY;
+			throw OutOfMemoryException("OutOfMemoryException : Not enough memory to complete operation.");
+
+		} // End catch(bad_alloc e)
+
+		// First pass: choose each block's width and size the packed and exception arrays
+		for(int block = 0; block < numBlocks; block++)
+		{
+			const KeyType* blockKeys = keys + block * FROZEN_BLOCK_KEYS;	// The block's first key
+			int blockCount = count - block * FROZEN_BLOCK_KEYS;			// # of keys in the block
+			int blockExceptions;											// # of wide gaps
+
+			if(blockCount > FROZEN_BLOCK_KEYS)
+			{
+				blockCount = FROZEN_BLOCK_KEYS;
+
+			} // End if
+
+			ComputeGaps(blockKeys, blockCount, gaps);
+
+			blocks[block].firstKey = blockKeys[0];
+			blocks[block].lastKey = blockKeys[blockCount - 1];
+			blocks[block].numKeys = (unsigned char)blockCount;
+			blocks[block].width = (unsigned char)ChooseWidth(gaps, blockCount - 1, blockExceptions);
+			blocks[block].numExceptions = (unsigned char)blockExceptions;
+			blocks[block].wordOffset = wordOffset;
+			blocks[block].exceptionOffset = exceptionOffset;
+
+			wordOffset += WordsFor(blockCount - 1, blocks[block].width);
+			exceptionOffset += blockExceptions;
+
+		} // End for
+
+		numWords = wordOffset;
+		numExceptions = exceptionOffset;
+
+		try
+		{
+			// The padding word lets DecodeBlock always read two words at a time
+			packed = new unsigned int[numWords + 1];
+			exceptionPositions = new unsigned char[numExceptions];
+			exceptionHighs = new unsigned int[numExceptions];
+
+		} // End try
+		catch(bad_alloc e)	// Failed to allocate memory
+		{
+			Free();
+			throw OutOfMemoryException("OutOfMemoryException : Not enough memory to complete operation.");
+
+		} // End catch(bad_alloc e)
+
+		memset(packed, 0, (numWords + 1) * sizeof(unsigned int));
+
+		// Second pass: pack each block's gaps and record its exceptions
+		for(int block = 0; block < numBlocks; block++)
+		{
+			const FrozenBlock& entry = blocks[block];	// The block's skip index entry
+			unsigned int* words = packed + entry.wordOffset;	// The block's packed words
+			unsigned int mask = (entry.width == 32) ? ~0u : ((1u << entry.width) - 1u);	// Low bits kept
+			int exception = entry.exceptionOffset;		// The next exception to record
+
+			ComputeGaps(keys + block * FROZEN_BLOCK_KEYS, entry.numKeys, gaps);
+
+			for(int i = 0; i < entry.numKeys - 1; i++)
+			{
+				long long bit = (long long)(i) * entry.width;	// The gap's first bit in words
+				int word = int(bit / 32);						// The word holding that bit
+				int shift = int(bit % 32);						// Its position within the word
+
+				// If the gap is too wide, keep its high bits as an exception
+				if(entry.width < 32 && (gaps[i] >> entry.width) != 0)
+				{
+					exceptionPositions[exception] = (unsigned char)i;
+					exceptionHighs[exception] = gaps[i] >> entry.width;
+					exception++;
+
+				} // End if
+
+				// If the block packs any bits, write the gap's low bits, spilling into the next word
+				if(entry.width > 0)
+				{
+					unsigned long long value = (unsigned long long)(gaps[i] & mask) << shift;
+
+					words[word] |= (unsigned int)(value);
+					words[word + 1] |= (unsigned int)(value >> 32);
+
+				} // End if
+
+			} // End for
+
+		} // End for
+
+		length = count;
+
+	} // End if
+
+} // End Build(const KeyType keys[], int count)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+int FrozenOrdListClass::DecodeBlock(/* in */ int block,				// The block to decode
+									/* out */ KeyType keys[]) const	// Gets the block's keys
+{
+	const FrozenBlock& entry = blocks[block];				// The block's skip index entry
+	const unsigned int* words = packed + entry.wordOffset;	// The block's packed words
+	unsigned int steps[FROZEN_BLOCK_KEYS];					// Gets each gap plus one
+	int numSteps = entry.numKeys - 1;						// # of steps between the block's keys
+	int i = 0;												// LCV
+
+	// If the block packs any bits, unpack them; otherwise every gap is 0 before patching
+	if(entry.width > 0)
+	{
+		unsigned long long mask = (1ull << entry.width) - 1ull;	// Low bits of one gap
+
+		for(i = 0; i < numSteps; i++)
+		{
+			long long bit = (long long)(i) * entry.width;			// The gap's first bit in words
+			unsigned long long both = words[bit / 32] |
+				((unsigned long long)(words[bit / 32 + 1]) << 32);	// The gap's word and the next
+
+			steps[i] = (unsigned int)((both >> (bit % 32)) & mask);
+
+		} // End for
+
+	} // End if
+	else
+	{
+		for(i = 0; i < numSteps; i++)
+		{
+			steps[i] = 0u;
+
+		} // End for
+
+	} // End else
+
+	// Patch in the high bits of the gaps too wide for the block's width
+	for(int e = entry.exceptionOffset; e < entry.exceptionOffset + entry.numExceptions; e++)
+	{
+		steps[exceptionPositions[e]] |= exceptionHighs[e] << entry.width;
+
+	} // End for
+
+	keys[0] = entry.firstKey;
+	i = 0;
+
+#ifdef FROZEN_USE_SSE2
+	// Rebuild four keys at a time: each key is the previous one less the running sum of the steps
+	{
+		const __m128i ones = _mm_set1_epi32(1);						// Turns gaps into steps
+		__m128i previous = _mm_set1_epi32(int(entry.firstKey));		// The last key rebuilt, in all lanes
+
+		for(; i + 4 <= numSteps; i += 4)
+		{
+			__m128i sums = _mm_add_epi32(_mm_loadu_si128((const __m128i*)(steps + i)), ones);
+
+			// In-register inclusive prefix sum of the four steps
+			sums = _mm_add_epi32(sums, _mm_slli_si128(sums, 4));
+			sums = _mm_add_epi32(sums, _mm_slli_si128(sums, 8));
+
+			previous = _mm_sub_epi32(previous, sums);
+			_mm_storeu_si128((__m128i*)(keys + i + 1), previous);
+
+			// Broadcast the fourth key to every lane for the next group
+			previous = _mm_shuffle_epi32(previous, _MM_SHUFFLE(3, 3, 3, 3));
+
+		} // End for
+
+	}
+#endif
+
+	// Rebuild the remaining keys one at a time
+	for(; i < numSteps; i++)
+	{
+		keys[i + 1] = KeyType(unsigned(keys[i]) - steps[i] - 1u);
+
+	} // End for
+
+	return entry.numKeys;
+
+} // End DecodeBlock(int block, KeyType keys[]) const
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+int FrozenOrdListClass::FindBlock(/* in */ KeyType key) const	// The key to bound
+{
+	int first = 0;				// The first block that could be the answer
+	int count = numBlocks;		// # of blocks that could be the answer
+
+	while(count > 0)
+	{
+		int half = count / 2;	// The block first + half is tested
+
+		// If every key in the block is greater than key, the answer is after it
+		if(key < blocks[first + half].lastKey)
+		{
+			first += half + 1;
+			count -= half + 1;
+
+		} // End if
+		else
+		{
+			count = half;
+
+		} // End else
+
+	} // End while
+
+	return first;
+
+} // End FindBlock(KeyType key) const
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+int FrozenOrdListClass::CountAtLeast(/* in */ KeyType key) const	// The key to bound
+{
+	int block = FindBlock(key);					// First block holding a key <= key
+	int count = block * FROZEN_BLOCK_KEYS;		// Every block before it is full and lies above key
+
+	// If every block lies above key, every key counts, including those in a partial last block
+	if(block == numBlocks)
+	{
+		count = length;
+
+	} // End if
+	// Else if the block straddles key, decode it and count its keys >= key
+	else if(!(blocks[block].firstKey < key))
+	{
+		KeyType keys[FROZEN_BLOCK_KEYS];			// The block's keys
+		int blockCount = DecodeBlock(block, keys);	// # of keys in the block
+
+		for(int i = 0; i < blockCount && !(keys[i] < key); i++)
+		{
+			count++;
+
+		} // End for
+
+	} // End else if
+
+	return count;
+
+} // End CountAtLeast(KeyType key) const
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+void FrozenOrdListClass::CopyFrom(/* in */ const FrozenOrdListClass& orig)	// List to copy
+{
+	// If orig holds any keys
+	if(orig.numBlocks > 0)
+	{
+		try
+		{
+			blocks = new FrozenBlock[orig.numBlocks];
+			packed = new unsigned int[orig.numWords + 1];
+			exceptionPositions = new unsigned char[orig.numExceptions];
+			exceptionHighs = new unsigned int[orig.numExceptions];
+
+		} // End try
+		catch(bad_alloc e)	// Failed to allocate memory
+		{
+			Free();
+			throw OutOfMemoryException("OutOfMemoryException : Not enough memory to complete operation.");
+
+		} // End catch(bad_alloc e)
+
+		numBlocks = orig.numBlocks;
+		length = orig.length;
+		numWords = orig.numWords;
+		numExceptions = orig.numExceptions;
+
+		memcpy(blocks, orig.blocks, numBlocks * sizeof(FrozenBlock));
+		memcpy(packed, orig.packed, (numWords + 1) * sizeof(unsigned int));
+		memcpy(exceptionPositions, orig.exceptionPositions, numExceptions * sizeof(unsigned char));
+		memcpy(exceptionHighs, orig.exceptionHighs, numExceptions * sizeof(unsigned int));
+
+	} // End if
+
+} // End CopyFrom(const FrozenOrdListClass& orig)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+void FrozenOrdListClass::Free()
+{
+	delete [] blocks;
+	delete [] packed;
+	delete [] exceptionPositions;
+	delete [] exceptionHighs;
+
+	blocks = NULL;
+	numBlocks = EMPTY;
+	length = EMPTY;
+	packed = NULL;
+	numWords = EMPTY;
+	exceptionPositions = NULL;
+	exceptionHighs = NULL;
+	numExceptions = EMPTY;
+
+} // End Free()
@@ -0,0 +1,289 @@
+//FileName:			FrozenOrdList.h
+//Author:			Chris Pray
+//Date:				10/19/26
+//Project:			OrdList
+//
+//Purpose: This file contains the specification for an immutable, compressed ordered list(descending) of
+//   keys. A FrozenOrdListClass object is usually built from an OrdListClass object by
+//   OrdListClass::Freeze(), and keeps only the keys, packed as follows:
+//
+//   The keys are split into blocks of FROZEN_BLOCK_KEYS (128) keys. For each block, a skip index entry
+//   holds the block's first (highest) and last (lowest) key. The gaps between consecutive keys, less
+//   one, are bit-packed using the fewest bits that fit most of them (frame of reference). The few gaps
+//   that do not fit are stored separately as exceptions and patched in when the block is decoded
+//   (patched frame of reference, PFOR). A list of dense keys therefore packs to 0 bits per key plus
+//   its skip index.
+//
+//   Find and range queries binary search the skip index and decode at most two blocks. The
+//   intersection operator skips every pair of blocks whose key ranges do not overlap, so only
+//   overlapping blocks are decoded. Blocks are decoded with an SSE2 prefix sum when it is available.
+//
+//                         SUMMARY OF METHODS
+//
+//	FrozenOrdListClass();
+//		Instantiates an empty FrozenOrdListClass object.
+//	FrozenOrdListClass(const KeyType keys[], int count);
+//		Instantiates a FrozenOrdListClass object holding count keys in descending order.
+//	FrozenOrdListClass(const FrozenOrdListClass& orig);
+//		Instantiates a deep copy of orig.
+//	~FrozenOrdListClass();
+//		Deallocates memory from a FrozenOrdListClass object
+//
+//	bool Find(KeyType key) const;
+//		Returns true if key is in the list, false otherwise.
+//	int CountInRange(KeyType lo, KeyType hi) const;
+//		Returns the number of keys in [lo, hi).
+//	void ScanRange(KeyType lo, KeyType hi, KeyFunctionType visit, void* context) const;
+//		Calls visit on every key in [lo, hi), highest key first.
+//	int GetLength() const;
+//		Returns the number of keys in the list.
+//	bool IsEmpty() const;
+//		Returns true if the list holds no keys.
+//	int GetMemoryUsage() const;
+//		Returns the number of bytes of dynamic memory the list uses.
+//	void Print() const;
+//		Prints the keys of the list.
+//
+//	FrozenOrdListClass operator*(const FrozenOrdListClass& rtOp) const;
+//		Intersects the keys of the applying object with those of rtOp.
+//	FrozenOrdListClass& operator=(const FrozenOrdListClass& orig);
+//		Assigns orig to applying class object.
+//
+//ASSUMPTIONS:
+// (1): KeyType is a 4-byte integer type.
+// (2): Only the keys of the items in the source list are kept. Any other fields of ItemType are lost.
+//
+//Exception Handling:
+//	bad_alloc is caught if an attempt to allocate dynamic memory fails, and OutOfMemoryException is
+//		thrown in its place.
+//
+
+
+#ifndef FrozenOrdList_h
+#define FrozenOrdList_h
+
+#include<iostream>			// For cout in Print()
+#include<cstddef>			// For NULL
+#include<type_traits>		// For is_integral
+#include "ABCListClass.h"	// For ItemType, KeyType and EMPTY
+#include "Exceptions.h"		// For custom exception, OutOfMemoryException
+using namespace std;
+using namespace nmspcExceptions;
+
+static_assert(is_integral<KeyType>::value && sizeof(KeyType) == 4,
+			  "FrozenOrdListClass requires KeyType to be a 4-byte integer");
+
+const int FROZEN_BLOCK_KEYS = 128;	// # of keys in each block (the last block may hold fewer)
+
+typedef void (*KeyFunctionType)(KeyType key, void* context);
+	// Function pointer used to return each key of a range scan to the client, along with the context
+	//  the client passed to ScanRange
+
+struct FrozenBlock
+{
+	KeyType firstKey;				// The highest key in the block
+	KeyType lastKey;				// The lowest key in the block
+	int wordOffset;					// Index in packed of the block's first word
+	int exceptionOffset;			// Index in the exception arrays of the block's first exception
+	unsigned char width;			// # of bits each gap is packed into
+	unsigned char numExceptions;	// # of gaps too wide for width bits
+	unsigned char numKeys;			// # of keys in the block
+
+}; // End FrozenBlock
+
+// Class Declarations
+class FrozenOrdListClass
+{
+	public:
+
+		FrozenOrdListClass();
+		//Purpose:				Instantiates an empty FrozenOrdListClass object.
+		//Pre:					None
+		//Post:					An empty FrozenOrdListClass object has been instantiated.
+		//Classification:		Default Constructor
+		//Order of Magnitude:	O(1)
+
+
+		FrozenOrdListClass(/* in */ const KeyType keys[],	// Keys in descending order
+						   /* in */ int count);				// # of keys
+		//Purpose:				Instantiates a FrozenOrdListClass object holding count keys.
+		//Pre:					keys holds count unique keys in descending order.
+		//Post:					A FrozenOrdListClass object holding the keys has been instantiated.
+		//Classification:		Non-default Constructor
+		//Order of Magnitude:	O(N), where N is count
+		//Exceptions Thrown:	OutOfMemoryException
+
+
+		FrozenOrdListClass(const FrozenOrdListClass& orig);	// The original list
+		//Purpose:				Instantiates a deep copy of orig.
+		//Pre:					orig exists
+		//Post:					A deep copy of orig has been instantiated
+		//Classification:		Copy Constructor
+		//Order of Magnitude:	O(S), where S is the compressed size of orig
+		//Exceptions Thrown:	OutOfMemoryException
+
+
+		~FrozenOrdListClass();
+		//Purpose:				Deallocates memory from a FrozenOrdListClass object
+		//Pre:					A FrozenOrdListClass object exists
+		//Post:					The FrozenOrdListClass object has been destroyed
+		//Classification:		Destructor
+		//Order of Magnitude:	O(1)
+
+
+		bool Find(/* in */ KeyType key) const;	// The key to search for
+		//Purpose:				Determines whether key is in the list.
+		//Pre:					List has been instantiated.
+		//Post:					True has been returned if key is in the list, false otherwise.
+		//Classification:		Observer / Predicator
+		//Order of Magnitude:	O(logN), plus decoding one block
+
+
+		int CountInRange(/* in */ KeyType lo,			// Smallest key in the range
+						 /* in */ KeyType hi) const;	// Key just above the range
+		//Purpose:				Returns the number of keys in [lo, hi). Blocks entirely inside the range
+		//						are counted from the skip index without being decoded.
+		//Pre:					List has been instantiated.
+		//Post:					The number of keys where lo <= key < hi has been returned. If hi <= lo,
+		//						0 has been returned.
+		//Classification:		Observer / Summarizer
+		//Order of Magnitude:	O(logN), plus decoding two blocks
+
+
+		void ScanRange(/* in */ KeyType lo,					// Smallest key in the range
+					   /* in */ KeyType hi,					// Key just above the range
+					   /* in */ KeyFunctionType visit,		// Called on each key in the range
+					   /* in */ void* context) const;		// Passed through to visit
+		//Purpose:				Calls visit on every key in [lo, hi), highest key first. Each block
+		//						overlapping the range is decoded once.
+		//Pre:					List has been instantiated. visit is not NULL.
+		//Post:					visit has been called once with each key where lo <= key < hi.
+		//Classification:		Observer / Accessor
+		//Order of Magnitude:	O(logN + M), where M is the number of keys in the range
+
+
+		int GetLength() const;
+		//Purpose:				Returns the number of keys in the list.
+		//Pre:					List has been instantiated.
+		//Post:					The number of keys has been returned.
+		//Classification:		Observer / Accessor
+		//Order of Magnitude:	O(1)
+
+
+		bool IsEmpty() const;
+		//Purpose:				Determines whether the list holds no keys.
+		//Pre:					List has been instantiated.
+		//Post:					True has been returned if the list is empty, false otherwise.
+		//Classification:		Observer / Predicator
+		//Order of Magnitude:	O(1)
+
+
+		int GetMemoryUsage() const;
+		//Purpose:				Returns the number of bytes of dynamic memory the list uses: its skip
+		//						index, its packed gaps and its exceptions.
+		//Pre:					List has been instantiated.
+		//Post:					The number of bytes has been returned.
+		//Classification:		Observer / Summarizer
+		//Order of Magnitude:	O(1)
+
+
+		void Print() const;
+		//Purpose:				Prints the keys of the list in the format of OrdListClass::Print,
+		//						followed by the number of blocks and bytes used.
+		//Pre:					List has been instantiated.
+		//Post:					The keys of the list have been printed.
+		//Classification:		Observer / Accessor
+		//Order of Magnitude:	O(N), where N is the length of the list
+
+
+		FrozenOrdListClass operator*(const FrozenOrdListClass& rtOp) const;	// List to intersect with
+		//Purpose:				Intersects the keys of the applying object with those of rtOp. Pairs of
+		//						blocks whose key ranges do not overlap are skipped without decoding.
+		//Pre:					List has been instantiated.
+		//Post:					A FrozenOrdListClass object holding the keys found in both lists has
+		//						been returned.
+		//Classification:		Observer / Summarizer
+		//Order of Magnitude:	O(B + K), where B is the number of blocks in both lists and K is the
+		//						number of keys in overlapping blocks
+		//Exceptions Thrown:	OutOfMemoryException
+
+
+		FrozenOrdListClass& operator=(const FrozenOrdListClass& orig);	// Object to aggregately assign
+		//Purpose:				Assigns orig to applying class object.
+		//Pre:					List has been instantiated.
+		//Post:					The applying object holds a copy of orig's keys. A reference to the
+		//						applying object has been returned.
+		//Classification:		Mutator
+		//Order of Magnitude:	O(S), where S is the compressed size of orig
+		//Exceptions Thrown:	OutOfMemoryException
+
+
+	private:
+
+		void Build(/* in */ const KeyType keys[],	// Keys in descending order
+				   /* in */ int count);				// # of keys
+		//Purpose:				Compresses count keys into the list, replacing what it held.
+		//Pre:					keys holds count unique keys in descending order.
+		//Post:					The list holds the keys in keys.
+		//Classification:		Mutator
+		//Order of Magnitude:	O(N), where N is count
+		//Exceptions Thrown:	OutOfMemoryException
+
+
+		int DecodeBlock(/* in */ int block,						// The block to decode
+						/* out */ KeyType keys[]) const;		// Gets the block's keys
+		//Purpose:				Decodes a block into keys, highest key first. The packed gaps are
+		//						unpacked, the exceptions patched in, and the keys rebuilt by a prefix
+		//						sum, four at a time with SSE2 when it is available.
+		//Pre:					0 <= block < numBlocks. keys has room for FROZEN_BLOCK_KEYS keys.
+		//Post:					keys holds the block's keys. The number of keys has been returned.
+		//Classification:		Observer / Accessor
+		//Order of Magnitude:	O(FROZEN_BLOCK_KEYS)
+
+
+		int FindBlock(/* in */ KeyType key) const;	// The key to bound
+		//Purpose:				Returns the first block whose lowest key is less than or equal to key,
+		//						which is the only block that can hold key.
+		//Pre:					List has been instantiated.
+		//Post:					The block has been returned, or numBlocks if there is none.
+		//Classification:		Observer / Accessor
+		//Order of Magnitude:	O(log B), where B is the number of blocks
+
+
+		int CountAtLeast(/* in */ KeyType key) const;	// The key to bound
+		//Purpose:				Returns the number of keys greater than or equal to key.
+		//Pre:					List has been instantiated.
+		//Post:					The number of keys >= key has been returned.
+		//Classification:		Observer / Summarizer
+		//Order of Magnitude:	O(log B), plus decoding one block
+
+
+		void CopyFrom(/* in */ const FrozenOrdListClass& orig);	// List to copy
+		//Purpose:				Replaces the contents of the list with a copy of orig's.
+		//Pre:					The list holds no dynamic memory.
+		//Post:					The list holds a copy of orig's blocks, packed gaps and exceptions.
+		//Classification:		Mutator
+		//Order of Magnitude:	O(S), where S is the compressed size of orig
+		//Exceptions Thrown:	OutOfMemoryException
+
+
+		void Free();
+		//Purpose:				Returns all dynamic memory held by the list to the heap.
+		//Pre:					None
+		//Post:					The list is empty and holds no dynamic memory.
+		//Classification:		Mutator
+		//Order of Magnitude:	O(1)
+
+
+		FrozenBlock* blocks;				// The skip index; one entry per block
+		int numBlocks;						// # of blocks
+		int length;							// # of keys
+		unsigned int* packed;				// The bit-packed gaps of every block
+		int numWords;						// # of words in packed, not counting the padding word
+		unsigned char* exceptionPositions;	// Position in its block of each exception
+		unsigned int* exceptionHighs;		// The bits of each exception above its block's width
+		int numExceptions;					// # of exceptions
+
+}; // End FrozenOrdListClass
+
+#endif
\ No newline at end of file
@@ -0,0 +1,114 @@
+/*
+AUTHOR:
+	Chris Pray
+
+DATE:
+	10/19/26
+
+FILENAME:
+	ListFile.h
+
+PURPOSE:
+	This file describes the on-disk format written by OrdListClass::Save and read by OrdListClass::Open.
+	A list file is a ListFileHeader followed immediately by the list's items, stored contiguously
+	exactly as they are laid out in memory, so that Open can map the file and use the items in place.
+	A list that counts duplicates stores the count of each item after the items.
+
+		Offset 0					ListFileHeader (LIST_FILE_HEADER_SIZE bytes)
+		Offset LIST_FILE_HEADER_SIZE	length * itemSize bytes of items, in descending order of key
+		Then, if LIST_FILE_HAS_COUNTS is set in flags, length 32-bit counts, in the order of the items
+
+	The header records the format version, the size of an ItemType, a code describing KeyType, the
+	length of the list and a checksum of the items and counts, so that a file written by a build with a different
+	ItemType, or a file that has been damaged, is rejected instead of misread. Integers are stored in
+	the byte order of the machine that wrote the file.
+
+	Version history:
+		1	10/19/26	Initial format
+		2	10/19/26	Adds flags and the duplicate counts; a version 1 file reads as one with no counts
+*/
+
+#ifndef ListFile_h
+#define ListFile_h
+
+#include<cstdint>			// For fixed-width integer types
+#include<cstring>			// For memcpy
+#include<type_traits>		// For is_integral, is_signed and is_floating_point
+#include "ItemType.h"		// For ItemType and KeyType
+
+const char LIST_FILE_MAGIC[8] = { 'O', 'R', 'D', 'L', 'I', 'S', 'T', '\0' };	// Identifies a list file
+const uint32_t LIST_FILE_VERSION = 2;	// The version of the format written by Save
+const uint32_t LIST_FILE_HAS_COUNTS = 1;	// Flag set when the duplicate counts follow the items
+
+struct ListFileHeader
+{
+	char magic[8];			// LIST_FILE_MAGIC
+	uint32_t version;		// LIST_FILE_VERSION when the file was written
+	uint32_t headerSize;	// sizeof(ListFileHeader); the items start at this offset
+	uint32_t itemSize;		// sizeof(ItemType) when the file was written
+	uint32_t keyType;		// KeyTypeCode() when the file was written
+	int64_t length;			// # of items in the file
+	uint64_t checksum;		// ListChecksum of the items, continued over the counts if there are any
+	uint32_t flags;			// LIST_FILE_HAS_COUNTS if the counts follow the items; 0 in version 1
+	uint32_t reserved;		// Always 0; room for later versions
+
+}; // End ListFileHeader
+
+const int LIST_FILE_HEADER_SIZE = int(sizeof(ListFileHeader));	// Offset of the first item
+
+static_assert(sizeof(ListFileHeader) % alignof(ItemType) == 0,
+			  "ListFileHeader must keep the items that follow it aligned");
+
+static_assert(sizeof(int) == sizeof(int32_t), "The duplicate counts are stored as 32-bit integers");
+
+//Purpose:	Returns a code describing KeyType: its size in bytes, plus 0x100 if it is signed, 0x200 if it
+//			is an integer and 0x400 if it is a floating point type.
+//Pre:		None
+//Post:		The code for KeyType has been returned.
+inline uint32_t KeyTypeCode()
+{
+	return uint32_t(sizeof(KeyType)) |
+		   (is_signed<KeyType>::value ? 0x100u : 0u) |
+		   (is_integral<KeyType>::value ? 0x200u : 0u) |
+		   (is_floating_point<KeyType>::value ? 0x400u : 0u);
+
+} // End KeyTypeCode()
+
+//Purpose:	Returns a 64-bit checksum of bytes bytes at data. Eight bytes are folded in at a time
+//			(FNV-1a over words), so checksumming a large list costs about as much as reading it. Passing
+//			the checksum of one run of bytes as basis continues it over a second run.
+//Pre:		data points to at least bytes readable bytes.
+//Post:		The checksum has been returned.
+inline uint64_t ListChecksum(/* in */ const void* data,	// The bytes to checksum
+							 /* in */ uint64_t bytes,		// # of bytes
+							 /* in */ uint64_t basis = 14695981039346656037ull)	// Where to start;
+																				//  the FNV-1a offset
+																				//  basis by default
+{
+	const uint64_t FNV_PRIME = 1099511628211ull;			// FNV-1a prime
+	const unsigned char* next = static_cast<const unsigned char*>(data);	// The next byte to fold in
+	uint64_t checksum = basis;			// Gets the checksum
+	uint64_t word;						// The next eight bytes
+
+	// Fold in each whole word
+	for(uint64_t i = 0; i < bytes / 8; i++)
+	{
+		memcpy(&word, next, sizeof(word));
+		checksum = (checksum ^ word) * FNV_PRIME;
+		next += sizeof(word);
+
+	} // End for
+
+	// Fold in the bytes left over
+	for(uint64_t i = 0; i < bytes % 8; i++)
+	{
+		checksum = (checksum ^ next[i]) * FNV_PRIME;
+
+	} // End for
+
+	// Mix in the length so that trailing zero bytes change the checksum
+	return (checksum ^ bytes) * FNV_PRIME;
+
+} // End ListChecksum(const void* data, uint64_t bytes, uint64_t basis)
+
+#endif
\ No newline at end of file
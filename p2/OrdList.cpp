@@ -13,6 +13,348 @@ PURPOSE:
 */
 
 #include "OrdList.h"	// For class declarations
+#include<climits>		// For INT_MAX
+#include<cstdio>		// For rename and remove
+#include<fstream>		// For ofstream in Save
+#include<system_error>	// For system_error, thrown when ParallelUnion cannot start a thread
+#include<thread>		// For thread, used by ParallelUnion
+#include<vector>		// For the partition bounds in ParallelUnion and the keys in Freeze
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include<windows.h>		// For CreateFileMapping, MapViewOfFile and UnmapViewOfFile
+#undef GetMessage		// windows.h renames GetMessage, which would hide the exceptions' GetMessage
+#else
+#include<fcntl.h>		// For open
+#include<sys/mman.h>	// For mmap and munmap
+#include<sys/stat.h>	// For fstat
+#include<unistd.h>		// For close
+#endif
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Implementation of File-scope Helpers
+
+//Purpose:	Maps all of fileName into memory read-only. Pages are only read from disk when they are
+//			first touched.
+//Pre:		None
+//Post:		A pointer to the mapped view has been returned. bytes is the size of the file.
+//Exceptions Thrown:	ListFileException if the file cannot be opened or mapped, or is too small to hold
+//			a ListFileHeader
+static void* MapFile(/* in */ const string& fileName,	// The file to map
+					 /* out */ size_t& bytes)			// Gets the size of the file
+{
+	void* view = NULL;	// Gets the mapped view of the file
+
+#ifdef _WIN32
+	HANDLE file;			// The open file
+	HANDLE fileMapping;		// The mapping object the view is made from
+	LARGE_INTEGER fileSize;	// The size of the file
+
+	file = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+					   FILE_ATTRIBUTE_NORMAL, NULL);
+
+	if(file == INVALID_HANDLE_VALUE)
+	{
+		throw ListFileException("ListFileException : " + fileName + " could not be opened.");
+
+	} // End if
+
+	if(!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart < LIST_FILE_HEADER_SIZE)
+	{
+		CloseHandle(file);
+		throw ListFileException("ListFileException : " + fileName + " is not a list file.");
+
+	} // End if
+
+	bytes = size_t(fileSize.QuadPart);
+
+	// The view keeps the file and the mapping object open, so both handles can be closed once it exists
+	fileMapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+	CloseHandle(file);
+
+	if(fileMapping != NULL)
+	{
+		view = MapViewOfFile(fileMapping, FILE_MAP_READ, 0, 0, 0);
+		CloseHandle(fileMapping);
+
+	} // End if
+#else
+	int file;				// The open file
+	struct stat fileInfo;	// Holds the size of the file
+
+	file = open(fileName.c_str(), O_RDONLY);
+
+	if(file < 0)
+	{
+		throw ListFileException("ListFileException : " + fileName + " could not be opened.");
+
+	} // End if
+
+	if(fstat(file, &fileInfo) != 0 || fileInfo.st_size < LIST_FILE_HEADER_SIZE)
+	{
+		close(file);
+		throw ListFileException("ListFileException : " + fileName + " is not a list file.");
+
+	} // End if
+
+	bytes = size_t(fileInfo.st_size);
+
+	// The mapping keeps the file open, so it can be closed once the mapping exists
+	view = mmap(NULL, bytes, PROT_READ, MAP_PRIVATE, file, 0);
+	close(file);
+
+	if(view == MAP_FAILED)
+	{
+		view = NULL;
+
+	} // End if
+#endif
+
+	// If the file could not be mapped
+	if(view == NULL)
+	{
+		throw ListFileException("ListFileException : " + fileName + " could not be mapped into memory.");
+
+	} // End if
+
+	return view;
+
+} // End MapFile(const string& fileName, size_t& bytes)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+//Purpose:	Unmaps a view returned by MapFile.
+//Pre:		view was returned by MapFile, which set bytes.
+//Post:		The view has been unmapped.
+static void UnmapFile(/* in */ void* view,		// The view to unmap
+					  /* in */ size_t bytes)	// The size of the view
+{
+#ifdef _WIN32
+	UnmapViewOfFile(view);
+#else
+	munmap(view, bytes);
+#endif
+
+} // End UnmapFile(void* view, size_t bytes)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+//Purpose:	Returns the position of the first item of list whose key is less than or equal to key,
+//			searching outward from start. Steps of 1, 2, 4, ... are taken from start toward key until an
+//			item on the far side of key is passed, and the bracket found is binary searched.
+//Pre:		list holds length items in descending order of key.
+//Post:		The position of the first item whose key <= key has been returned, or length if there is
+//			none.
+static int GallopLowerBound(/* in */ const ItemType list[],	// The list to search
+							/* in */ int length,			// # of items in list
+							/* in */ int start,				// The position to search from
+							/* in */ KeyType key)			// The key to bound
+{
+	int first;	// The first position that could be the bound
+	int last;	// One past the last position that could be the bound
+	int step;	// Distance from start of the next item tested
+	int half;	// Half of the bracket; the position first + half is tested
+
+	// Keep start inside the list
+	if(start < 0)
+	{
+		start = 0;
+
+	} // End if
+	else if(start > length)
+	{
+		start = length;
+
+	} // End else if
+
+	// If the item at start has a key greater than key, the bound is after start
+	if(start < length && list[start].key > key)
+	{
+		first = start + 1;
+		step = 1;
+
+		// Gallop forward while the items tested are still greater than key
+		while(start + step < length && list[start + step].key > key)
+		{
+			first = start + step + 1;
+			step *= 2;
+
+		} // End while
+
+		last = (start + step < length) ? start + step : length;
+
+	} // End if
+	// Else the bound is at or before start
+	else
+	{
+		last = start;
+		step = 1;
+
+		// Gallop backward while the items tested are still less than or equal to key
+		while(start - step >= 0 && list[start - step].key <= key)
+		{
+			last = start - step;
+			step *= 2;
+
+		} // End while
+
+		first = (start - step >= 0) ? start - step + 1 : 0;
+
+	} // End else
+
+	// Binary search the bracket, as LowerBound does
+	while(first < last)
+	{
+		half = (last - first) / 2;
+
+		// If the item at first + half has a key greater than key, the bound is after it
+		if(list[first + half].key > key)
+		{
+			first += half + 1;
+
+		} // End if
+		// Else the bound is at or before first + half
+		else
+		{
+			last = first + half;
+
+		} // End else
+
+	} // End while
+
+	return first;
+
+} // End GallopLowerBound(const ItemType list[], int length, int start, KeyType key)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+//Purpose:	Co-ranks position diagonal of the merge of left and right: finds how many of the first
+//			diagonal merged items come from left. When keys are equal, left's item is merged first.
+//Pre:		left holds leftLength and right holds rightLength items, each in descending order of key
+//			with no duplicates. 0 <= diagonal <= leftLength + rightLength
+//Post:		The # of items of left among the first diagonal merged items has been returned.
+static int CoRank(/* in */ const ItemType left[],	// The first list
+				  /* in */ int leftLength,			// # of items in left
+				  /* in */ const ItemType right[],	// The second list
+				  /* in */ int rightLength,			// # of items in right
+				  /* in */ int diagonal)			// # of merged items before the cut
+{
+	int low = (diagonal > rightLength) ? diagonal - rightLength : 0;	// Fewest items left can give
+	int high = (diagonal < leftLength) ? diagonal : leftLength;		// Most items left can give
+	int fromLeft;	// The # of items from left being tried
+	int fromRight;	// The # of items from right that goes with it
+
+	for(;;)
+	{
+		fromLeft = low + (high - low) / 2;
+		fromRight = diagonal - fromLeft;
+
+		// If the last item taken from left should come after the next item of right, take fewer
+		if(fromLeft > 0 && fromRight < rightLength && left[fromLeft - 1].key < right[fromRight].key)
+		{
+			high = fromLeft - 1;
+
+		} // End if
+		// Else if the last item taken from right should come after the next item of left, take more
+		else if(fromRight > 0 && fromLeft < leftLength &&
+				right[fromRight - 1].key <= left[fromLeft].key)
+		{
+			low = fromLeft + 1;
+
+		} // End else if
+		// Else the cut is consistent with the merged order
+		else
+		{
+			return fromLeft;
+
+		} // End else
+
+	} // End for
+
+} // End CoRank(const ItemType left[], int leftLength, const ItemType right[], int rightLength,
+//				int diagonal)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+//Purpose:	Merges left[leftFirst, leftLast) with right[rightFirst, rightLast), keeping one item for
+//			each key. The item merged just before the partition is checked too, so that a key whose
+//			two copies are split between partitions is kept only by the partition that merges it
+//			first.
+//Pre:		The bounds were found by CoRank. If merged is not NULL, it has room for every item kept.
+//Post:		If merged is not NULL, the items kept are in merged, in descending order. If kept is not
+//			NULL, it holds the # of items kept.
+static void MergePartition(/* in */ const ItemType left[],	// The first list
+						   /* in */ const ItemType right[],	// The second list
+						   /* in */ int leftFirst,			// First item of left to merge
+						   /* in */ int leftLast,			// One past the last item of left to merge
+						   /* in */ int rightFirst,			// First item of right to merge
+						   /* in */ int rightLast,			// One past the last item of right to merge
+						   /* out */ ItemType merged[],		// Gets the items kept, or NULL
+						   /* out */ int* kept)				// Gets the # of items kept, or NULL
+{
+	const ItemType* next;				// The next item in the merged order
+	bool havePrevious = false;			// True once previousKey holds a key
+	KeyType previousKey = KeyType();	// The key merged last, which the next item must not repeat
+	int count = 0;						// # of items kept so far
+
+	// If an item is merged before this partition, it is the later of the items just before each
+	//  list's slice: the one with the lower key, or right's if the keys are equal
+	if(rightFirst > 0 && (leftFirst == 0 || right[rightFirst - 1].key <= left[leftFirst - 1].key))
+	{
+		previousKey = right[rightFirst - 1].key;
+		havePrevious = true;
+
+	} // End if
+	else if(leftFirst > 0)
+	{
+		previousKey = left[leftFirst - 1].key;
+		havePrevious = true;
+
+	} // End else if
+
+	// While either slice has items left
+	while(leftFirst < leftLast || rightFirst < rightLast)
+	{
+		// Take from left when its key is at least right's, so that left's copy of a duplicate leads
+		if(rightFirst == rightLast || (leftFirst < leftLast && left[leftFirst].key >= right[rightFirst].key))
+		{
+			next = &left[leftFirst++];
+
+		} // End if
+		else
+		{
+			next = &right[rightFirst++];
+
+		} // End else
+
+		// If the item is not the second copy of a key
+		if(!havePrevious || next->key != previousKey)
+		{
+			if(merged != NULL)
+			{
+				merged[count] = *next;
+
+			} // End if
+
+			count++;
+			previousKey = next->key;
+			havePrevious = true;
+
+		} // End if
+
+	} // End while
+
+	if(kept != NULL)
+	{
+		*kept = count;
+
+	} // End if
+
+} // End MergePartition(const ItemType left[], const ItemType right[], int leftFirst, int leftLast,
+//						int rightFirst, int rightLast, ItemType merged[], int* kept)
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
@@ -20,19 +362,138 @@ PURPOSE:
 
 OrdListClass::OrdListClass()
 {
-	// Initialize size to MAX_ENTRIES
-	SetSize(MAX_ENTRIES);
+	// Use the default capacity policy
+	policy = DEFAULT_CAPACITY_POLICY;
+
+	// The list is not mapped from a file
+	mapping = NULL;
+	mappingBytes = 0;
+
+	// Reject duplicates, which needs no counts
+	duplicates = REJECT_DUPLICATES;
+	counts = NULL;
+
+	// Allocate the list from the heap
+	resource = NULL;
+
+	// Return the list allocated by ListClass() back to the heap; every list owned by an OrdListClass
+	//  object is allocated by AllocateList so that Reallocate can resize it
+	delete [] GetListPtr();
+	SetListPtr(NULL);
+	SetSize(EMPTY);
+
+	// Allocate a list of MAX_ENTRIES items
+	Reallocate(policy.minCapacity);
 
 } // End OrdListClass()
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 
+OrdListClass::OrdListClass(/* In */ const CapacityPolicy& newPolicy)	// Policy used to grow and shrink
+{
+	// If newPolicy would let the list thrash between growing and shrinking
+	if(!IsValidPolicy(newPolicy))
+	{
+		// Return the list allocated by ListClass() back to the heap before giving up
+		delete [] GetListPtr();
+		SetListPtr(NULL);
+
+		throw InvalidCapacityPolicyException("InvalidCapacityPolicyException : The capacity policy is "
+											 "not valid.");
+
+	} // End if
+
+	// Use newPolicy
+	policy = newPolicy;
+
+	// The list is not mapped from a file
+	mapping = NULL;
+	mappingBytes = 0;
+
+	// Reject duplicates, which needs no counts
+	duplicates = REJECT_DUPLICATES;
+	counts = NULL;
+
+	// Allocate the list from the heap
+	resource = NULL;
+
+	// Replace the list allocated by ListClass() with one allocated by AllocateList
+	delete [] GetListPtr();
+	SetListPtr(NULL);
+	SetSize(EMPTY);
+
+	// Allocate a list of minCapacity items
+	Reallocate(policy.minCapacity);
+
+} // End OrdListClass(const CapacityPolicy& newPolicy)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+OrdListClass::OrdListClass(/* In */ DuplicatePolicy newDuplicates)	// How duplicate keys are handled
+{
+	// Use the default capacity policy
+	policy = DEFAULT_CAPACITY_POLICY;
+
+	// The list is not mapped from a file
+	mapping = NULL;
+	mappingBytes = 0;
+
+	// Start out rejecting duplicates; SetDuplicatePolicy creates the counts if they are needed
+	duplicates = REJECT_DUPLICATES;
+	counts = NULL;
+
+	// Allocate the list from the heap
+	resource = NULL;
+
+	// Replace the list allocated by ListClass() with one allocated by AllocateList
+	delete [] GetListPtr();
+	SetListPtr(NULL);
+	SetSize(EMPTY);
+
+	// Allocate a list of MAX_ENTRIES items
+	Reallocate(policy.minCapacity);
+
+	SetDuplicatePolicy(newDuplicates);
+
+} // End OrdListClass(DuplicatePolicy newDuplicates)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+OrdListClass::OrdListClass(/* In */ pmr::memory_resource* newResource)	// Where the items are allocated
+{
+	// Use the default capacity policy
+	policy = DEFAULT_CAPACITY_POLICY;
+
+	// The list is not mapped from a file
+	mapping = NULL;
+	mappingBytes = 0;
+
+	// Reject duplicates, which needs no counts
+	duplicates = REJECT_DUPLICATES;
+	counts = NULL;
+
+	// Allocate the list from newResource
+	resource = newResource;
+
+	// Replace the list allocated by ListClass() with one allocated by AllocateList
+	delete [] GetListPtr();
+	SetListPtr(NULL);
+	SetSize(EMPTY);
+
+	// Allocate a list of MAX_ENTRIES items
+	Reallocate(policy.minCapacity);
+
+} // End OrdListClass(pmr::memory_resource* newResource)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
 OrdListClass::~OrdListClass()
 {
-	ItemType* list = GetListPtr();	// Points to the list
+	// Return the list back to the heap, or unmap it if it is mapped from a file
+	ReleaseList();
 
-	// Return the dynamic memory allocated to the list back to the heap
-	delete [] list;
+	// Return the duplicate counts, if any, back to the heap
+	free(counts);
 
 } // End ~OrdListClass()
 
@@ -40,11 +501,61 @@ OrdListClass::~OrdListClass()
 
 OrdListClass::OrdListClass(/* In */ const OrdListClass& orig)	// The original OrdListClass object
 {
+	// Use orig's capacity policy
+	policy = orig.policy;
+
+	// The list is not mapped from a file
+	mapping = NULL;
+	mappingBytes = 0;
+
+	// Reject duplicates, which needs no counts
+	duplicates = REJECT_DUPLICATES;
+	counts = NULL;
+
+	// Allocate the copy from the same memory resource as orig
+	resource = orig.resource;
+
+	// Return the list allocated by ListClass() back to the heap; operator= allocates one the size of
+	//  orig's list
+	delete [] GetListPtr();
+	SetListPtr(NULL);
+	SetSize(EMPTY);
+
 	// Make a deep copy of orig
 	operator=(orig);
 
 } // End OrdListClass(const OrdListClass& orig)
 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+OrdListClass::OrdListClass(/* In/Out */ OrdListClass&& orig)	// The OrdListClass object to take the
+																//  list from
+{
+	// Use orig's capacity policy
+	policy = orig.policy;
+
+	// The list is not mapped from a file
+	mapping = NULL;
+	mappingBytes = 0;
+
+	// Reject duplicates, which needs no counts
+	duplicates = REJECT_DUPLICATES;
+	counts = NULL;
+
+	// Use orig's memory resource, which Swap leaves with orig too
+	resource = orig.resource;
+
+	// Return the list allocated by ListClass() back to the heap. A list with no memory and a size of
+	//  zero is a valid empty list; it allocates on its first Insert.
+	delete [] GetListPtr();
+	SetListPtr(NULL);
+	SetSize(EMPTY);
+
+	// Take orig's list, leaving orig as an empty list with no memory
+	Swap(orig);
+
+} // End OrdListClass(OrdListClass&& orig)
+
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 // Implementation of Methods that were Overridden
@@ -141,115 +652,80 @@ bool OrdListClass::Find(/* in */ KeyType key)	// The key to search for
 
 void OrdListClass::Insert(/* in */ ItemType target)	// The target to insert
 {
-	ItemType* list = NULL;	// Gets pointed to the list
-
-	// If the list is empty
-	if(IsEmpty())
+	// If target is a duplicate and the list rejects duplicates
+	if(TryInsert(target) == DUPLICATE_REJECTED)
 	{
-		// Point list to the list
-		list = GetListPtr();
+		throw DuplicateKeyException(target.key,
+			"DuplicateKeyException: Attempt to insert a duplicate key failed.");
 
-		// Insert target into the current position in the list
-		list[GetCurrPos()] = target;
+	} // End if
 
-		// Increment the length of the list by one
-		SetLength(GetLength() + 1);
+} // End Insert(ItemType target)
 
-	} // End if
-	// Else the list is not empty
-	else
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+InsertStatus OrdListClass::TryInsert(/* in */ ItemType target)	// The target to insert
+{
+	ItemType* list = GetListPtr();	// Points to the list
+
+	// If target is already in the list
+	if(GetCurrPos() < GetLength() && list[GetCurrPos()].key == target.key)
 	{
-		// If there's no room in the list
-		if(NoRoom())
+		// If the list keeps duplicates, count this one
+		if(counts != NULL)
 		{
-			// If the current position in the list is set to the length of the list
-			if(GetCurrPos() == GetLength())
-			{
-				// Expand the size of the array
-				Expand();
+			counts[GetCurrPos()]++;
 
-				// Point list to the list
-				list = GetListPtr();
+			return DUPLICATE_COUNTED;
 
-				// Copy each item in the list from currPos to the end of the list up one position
-				memcpy(&list[GetCurrPos() + 1],											  // Destination
-					   &list[GetCurrPos()],												  // Source
-					   GetLength() * sizeof(ItemType) - GetCurrPos() * sizeof(ItemType)); // # of bytes
-																						  //  to copy
-			
-				// Insert target into the current position in the list
-				list[GetCurrPos()] = target;
+		} // End if
 
-				// Increment the length of the list by one
-				SetLength(GetLength() + 1);
+		return DUPLICATE_REJECTED;
 
-			} // End if
-			// Else if target is not already in the list
-			else if(Retrieve().key != target.key)
-			{
-				// Expand the size of the array
-				Expand();
-
-				// Point list to the list
-				list = GetListPtr();
-				
-				// Copy each item in the list from currPos to the end of the list up one position
-				memcpy(&list[GetCurrPos() + 1],											  // Destination
-					   &list[GetCurrPos()],												  // Source
-					   GetLength() * sizeof(ItemType) - GetCurrPos() * sizeof(ItemType)); // # of bytes
-																						  //  to copy
-				
-				// Insert target into the current position in the list
-				list[GetCurrPos()] = target;
-
-				// Increment the length of the list by one
-				SetLength(GetLength() + 1);
+	} // End if
 
-			} // End if
-			// Else target is alreay in the list
-			else
-			{
-				throw DuplicateKeyException(target.key,
-					"DuplicateKeyException: Attempt to insert a duplicate key failed.");
+	// If there's no room in the list
+	if(NoRoom())
+	{
+		// Expand the size of the array
+		Expand();
 
-			} // End else
+	} // End if
+	// Else if the list is mapped from a file, copy it into memory that can be changed
+	else
+	{
+		Promote();
 
-		} // End if
-		// Else there is no room in the list
-		else
-		{
-			// If target is not already in the list
-			if(Retrieve().key != target.key)
-			{
-				// Point list to the list
-				list = GetListPtr();
+	} // End else
 
-				// Copy each item in the list from currPos to the end of the list up one position
-				memcpy(&list[GetCurrPos() + 1],											  // Destination
-					   &list[GetCurrPos()],												  // Source
-					   GetLength() * sizeof(ItemType) - GetCurrPos() * sizeof(ItemType)); // # of bytes
-																						  //  to copy
-			
-				// Insert target into the current position in the list
-				list[GetCurrPos()] = target;
+	// Point list to the list, which Expand or Promote may have moved
+	list = GetListPtr();
 
-				// Increment the length of the list by one
-				SetLength(GetLength() + 1);
+	// Move each item in the list from currPos to the end of the list up one position
+	memmove(&list[GetCurrPos() + 1],							// Destination
+			&list[GetCurrPos()],								// Source
+			(GetLength() - GetCurrPos()) * sizeof(ItemType));	// # of bytes to move
 
-			} // End if
-			// Else target is alreay in the list
-			else
-			{
-				throw DuplicateKeyException(target.key,
-					"DuplicateKeyException: Attempt to insert a duplicate key failed.");
+	// Insert target into the current position in the list
+	list[GetCurrPos()] = target;
 
-			} // End else
+	// If the list keeps duplicates, move the counts the same way and give target a count of 1
+	if(counts != NULL)
+	{
+		memmove(&counts[GetCurrPos() + 1],						// Destination
+				&counts[GetCurrPos()],							// Source
+				(GetLength() - GetCurrPos()) * sizeof(int));	// # of bytes to move
 
-		} // End else
+		counts[GetCurrPos()] = 1;
 
-	} // End else
+	} // End if
 
-} // End Insert(ItemType target)
+	// Increment the length of the list by one
+	SetLength(GetLength() + 1);
+
+	return INSERTED;
+
+} // End TryInsert(ItemType target)
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 
@@ -258,7 +734,21 @@ void OrdListClass::Delete()
 	// If the list is not empty
 	if(!IsEmpty())
 	{
-		ItemType* list = GetListPtr();	// Points to the list
+		ItemType* list;	// Points to the list
+
+		// If the item has more than one copy, delete just one
+		if(counts != NULL && counts[GetCurrPos()] > 1)
+		{
+			counts[GetCurrPos()]--;
+
+			return;
+
+		} // End if
+
+		// If the list is mapped from a file, copy it into memory that can be changed
+		Promote();
+
+		list = GetListPtr();
 
 		// Decrement the length of the list by one
 		SetLength(GetLength() - 1);
@@ -266,16 +756,25 @@ void OrdListClass::Delete()
 		// If currPos != length
 		if(!EndOfList())
 		{
-			// Copy each item in the list from currPos + 1 to the end of the list down one position
-			memcpy(&list[GetCurrPos()],											   // Destination
-				&list[GetCurrPos() + 1],										   // Source
-				GetLength() * sizeof(ItemType) - GetCurrPos() * sizeof(ItemType)); // # of bytes to copy
+			// Move each item in the list from currPos + 1 to the end of the list down one position
+			memmove(&list[GetCurrPos()],							// Destination
+					&list[GetCurrPos() + 1],						// Source
+					(GetLength() - GetCurrPos()) * sizeof(ItemType));	// # of bytes to move
+
+			// If the list keeps duplicates, move the counts the same way
+			if(counts != NULL)
+			{
+				memmove(&counts[GetCurrPos()],						// Destination
+						&counts[GetCurrPos() + 1],					// Source
+						(GetLength() - GetCurrPos()) * sizeof(int));	// # of bytes to move
+
+			} // End if
 
 		} // End if
 		
-		// If the size of the list is greater than MAX_ENTRIES and the length of the list is less than
-		//  OCCUPANCY_TRIGGER times the size of the list
-		if(GetSize() > MAX_ENTRIES && GetLength() < OCCUPANCY_TRIGGER * GetSize())
+		// If the size of the list is greater than the policy's minimum and the length of the list is
+		//  less than shrinkTrigger times the size of the list
+		if(GetSize() > policy.minCapacity && GetLength() < policy.shrinkTrigger * GetSize())
 		{
 			// Contract the size of the list
 			Contract();
@@ -290,27 +789,728 @@ void OrdListClass::Delete()
 
 void OrdListClass::Clear()
 {
-	ItemType* list = GetListPtr();	// Points to the list
-
-	// Return the dynamic memory allocated to the list back to the heap
-	delete [] list;
-
-	// Allocate enough memory for an array of MAX_ENTRIES items from the heap
-	list = new ItemType[MAX_ENTRIES];
-
-	// Set the pointer to the list to the new dynamic array
-	SetListPtr(list);
-
-	// Set the size of the list to MAX_ENTRIES
-	SetSize(MAX_ENTRIES);
-
 	// Set the current position in the list to FIRST_POSITION
 	SetCurrPos(FIRST_POSITION);
 
 	// Set the length of the list to EMPTY
 	SetLength(EMPTY);
 
-} // End Clear()
+} // End Clear()
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+void OrdListClass::Clear(/* in */ bool shrink)	// True if the list should return to its minimum size
+{
+	// Empty the list, keeping its size
+	Clear();
+
+	// If the caller asked to shrink and the list has grown past its minimum size
+	if(shrink && GetSize() > policy.minCapacity)
+	{
+		// Return the list to its minimum size
+		Reallocate(policy.minCapacity);
+
+	} // End if
+
+} // End Clear(bool shrink)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+void OrdListClass::Swap(/* in/out */ OrdListClass& other) noexcept	// The list to exchange contents with
+{
+	ItemType* tempList = GetListPtr();		// The applying object's list
+	int tempSize = GetSize();				// The applying object's size
+	int tempLength = GetLength();			// The applying object's length
+	int tempCurrPos = GetCurrPos();			// The applying object's current position
+	CapacityPolicy tempPolicy = policy;		// The applying object's capacity policy
+	void* tempMapping = mapping;			// The applying object's mapped file, if any
+	size_t tempMappingBytes = mappingBytes;	// The size of the applying object's mapped file
+	DuplicatePolicy tempDuplicates = duplicates;	// The applying object's duplicate policy
+	int* tempCounts = counts;				// The applying object's duplicate counts
+	pmr::memory_resource* tempResource = resource;	// Where the applying object's list was allocated
+
+	// Give the applying object other's list and PDMs
+	SetListPtr(other.GetListPtr());
+	SetSize(other.GetSize());
+	SetLength(other.GetLength());
+	SetCurrPos(other.GetCurrPos());
+	policy = other.policy;
+	mapping = other.mapping;
+	mappingBytes = other.mappingBytes;
+	duplicates = other.duplicates;
+	counts = other.counts;
+	resource = other.resource;
+
+	// Give other the applying object's former list and PDMs
+	other.SetListPtr(tempList);
+	other.SetSize(tempSize);
+	other.SetLength(tempLength);
+	other.SetCurrPos(tempCurrPos);
+	other.policy = tempPolicy;
+	other.mapping = tempMapping;
+	other.mappingBytes = tempMappingBytes;
+	other.duplicates = tempDuplicates;
+	other.counts = tempCounts;
+	other.resource = tempResource;
+
+} // End Swap(OrdListClass& other)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+void OrdListClass::Reserve(/* in */ int capacity)	// # of items the list must be able to hold
+{
+	// If the list cannot already hold capacity items
+	if(capacity > GetSize())
+	{
+		// Grow the list to exactly capacity items
+		Reallocate(capacity);
+
+	} // End if
+
+} // End Reserve(int capacity)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+void OrdListClass::ShrinkToFit()
+{
+	int newSize = GetLength();	// The size that exactly fits the items in the list
+
+	// A list always has room for at least one item
+	if(newSize < 1)
+	{
+		newSize = 1;
+
+	} // End if
+
+	// If the list is not already that size
+	if(newSize != GetSize())
+	{
+		Reallocate(newSize);
+
+	} // End if
+
+} // End ShrinkToFit()
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+int OrdListClass::GetCapacity() const
+{
+	return GetSize();
+
+} // End GetCapacity()
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+void OrdListClass::SetCapacityPolicy(/* in */ const CapacityPolicy& newPolicy)	// Policy to use
+{
+	// If newPolicy would let the list thrash between growing and shrinking
+	if(!IsValidPolicy(newPolicy))
+	{
+		throw InvalidCapacityPolicyException("InvalidCapacityPolicyException : The capacity policy is "
+											 "not valid.");
+
+	} // End if
+
+	policy = newPolicy;
+
+} // End SetCapacityPolicy(const CapacityPolicy& newPolicy)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+CapacityPolicy OrdListClass::GetCapacityPolicy() const
+{
+	return policy;
+
+} // End GetCapacityPolicy()
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+int OrdListClass::GetCount() const
+{
+	// If currPos is past the last item
+	if(GetCurrPos() >= GetLength())
+	{
+		return 0;
+
+	} // End if
+
+	return (counts != NULL) ? counts[GetCurrPos()] : 1;
+
+} // End GetCount()
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+void OrdListClass::SetDuplicatePolicy(/* in */ DuplicatePolicy newDuplicates)	// How duplicate keys
+																				//  are handled
+{
+	// If the list starts counting duplicates
+	if(newDuplicates == COUNT_DUPLICATES && counts == NULL)
+	{
+		// Create a count for every position in the list
+		ResizeCounts((GetSize() > 0) ? GetSize() : 1);
+
+		// Every key in the list has been inserted once
+		for(int i = 0; i < GetLength(); i++)
+		{
+			counts[i] = 1;
+
+		} // End for
+
+	} // End if
+	// Else if the list stops counting duplicates
+	else if(newDuplicates == REJECT_DUPLICATES && counts != NULL)
+	{
+		free(counts);
+		counts = NULL;
+
+	} // End else if
+
+	duplicates = newDuplicates;
+
+} // End SetDuplicatePolicy(DuplicatePolicy newDuplicates)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+DuplicatePolicy OrdListClass::GetDuplicatePolicy() const
+{
+	return duplicates;
+
+} // End GetDuplicatePolicy()
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+pmr::memory_resource* OrdListClass::GetMemoryResource() const
+{
+	return resource;
+
+} // End GetMemoryResource()
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+OrdListClass::const_iterator OrdListClass::begin() const
+{
+	return GetListPtr();
+
+} // End begin()
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+OrdListClass::const_iterator OrdListClass::end() const
+{
+	return GetListPtr() + GetLength();
+
+} // End end()
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+OrdListClass::const_iterator OrdListClass::cbegin() const
+{
+	return begin();
+
+} // End cbegin()
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+OrdListClass::const_iterator OrdListClass::cend() const
+{
+	return end();
+
+} // End cend()
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+ItemSpan OrdListClass::GetItems() const
+{
+	ItemSpan items;	// The view of the whole list
+
+	items.first = begin();
+	items.last = end();
+
+	return items;
+
+} // End GetItems()
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+const ItemType& OrdListClass::At(/* in */ int position) const	// The position of the item
+{
+	return GetListPtr()[position];
+
+} // End At(int position)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+const ItemType& OrdListClass::Current() const
+{
+	return GetListPtr()[GetCurrPos()];
+
+} // End Current()
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+int OrdListClass::LowerBound(/* in */ KeyType key) const	// The key to bound
+{
+	ItemType* list = GetListPtr();	// Points to the list
+	int first = FIRST_POSITION;		// The first position that could be the bound
+	int count = GetLength();		// # of positions that could be the bound
+	int half;						// Half of count; the position first + half is tested
+
+	// While more than one position could be the bound
+	while(count > 0)
+	{
+		half = count / 2;
+
+		// If the item at first + half has a key greater than key, the bound is after it
+		if(key < list[first + half].key)
+		{
+			first += half + 1;
+			count -= half + 1;
+
+		} // End if
+		// Else the bound is at or before first + half
+		else
+		{
+			count = half;
+
+		} // End else
+
+	} // End while
+
+	return first;
+
+} // End LowerBound(KeyType key)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+int OrdListClass::UpperBound(/* in */ KeyType key) const	// The key to bound
+{
+	ItemType* list = GetListPtr();	// Points to the list
+	int first = FIRST_POSITION;		// The first position that could be the bound
+	int count = GetLength();		// # of positions that could be the bound
+	int half;						// Half of count; the position first + half is tested
+
+	// While more than one position could be the bound
+	while(count > 0)
+	{
+		half = count / 2;
+
+		// If the item at first + half has a key greater than or equal to key, the bound is after it
+		if(!(list[first + half].key < key))
+		{
+			first += half + 1;
+			count -= half + 1;
+
+		} // End if
+		// Else the bound is at or before first + half
+		else
+		{
+			count = half;
+
+		} // End else
+
+	} // End while
+
+	return first;
+
+} // End UpperBound(KeyType key)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+bool OrdListClass::FindFrom(/* in */ KeyType key)	// The key to search for
+{
+	int position = GallopLowerBound(GetListPtr(), GetLength(), GetCurrPos(), key);	// Where key is, or
+																					//  would be
+
+	SetCurrPos(position);
+
+	return position < GetLength() && GetListPtr()[position].key == key;
+
+} // End FindFrom(KeyType key)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+int OrdListClass::LookupSorted(/* in */ const KeyType keys[],		// The keys to search for
+							   /* in */ int count,					// # of keys
+							   /* out */ int positions[]) const	// Gets the position of each key
+{
+	const ItemType* list = GetListPtr();	// Points to the list
+	int position = FIRST_POSITION;			// Where the last key searched for is, or would be
+	int numFound = 0;						// # of keys found
+
+	// Search for each key, starting from where the last search ended
+	for(int i = 0; i < count; i++)
+	{
+		position = GallopLowerBound(list, GetLength(), position, keys[i]);
+
+		// If the key is in the list
+		if(position < GetLength() && list[position].key == keys[i])
+		{
+			positions[i] = position;
+			numFound++;
+
+		} // End if
+		else
+		{
+			positions[i] = NOT_FOUND;
+
+		} // End else
+
+	} // End for
+
+	return numFound;
+
+} // End LookupSorted(const KeyType keys[], int count, int positions[])
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+int OrdListClass::CountInRange(/* in */ KeyType lo,			// Smallest key in the range
+							   /* in */ KeyType hi) const	// Key just above the range
+{
+	int count = EMPTY;	// # of items in the range
+
+	// If the range is not empty
+	if(lo < hi)
+	{
+		// Keys below hi start at UpperBound(hi); keys below lo start at UpperBound(lo)
+		count = UpperBound(lo) - UpperBound(hi);
+
+	} // End if
+
+	return count;
+
+} // End CountInRange(KeyType lo, KeyType hi)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+ItemSpan OrdListClass::GetRange(/* in */ KeyType lo,		// Smallest key in the range
+								/* in */ KeyType hi) const	// Key just above the range
+{
+	ItemType* list = GetListPtr();	// Points to the list
+	ItemSpan range;					// The view of the items in the range
+
+	range.first = list + UpperBound(hi);
+	range.last = range.first;
+
+	// If the range is not empty
+	if(lo < hi)
+	{
+		range.last = list + UpperBound(lo);
+
+	} // End if
+
+	return range;
+
+} // End GetRange(KeyType lo, KeyType hi)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+int OrdListClass::DeleteRange(/* in */ KeyType lo,	// Smallest key in the range
+							  /* in */ KeyType hi)	// Key just above the range
+{
+	ItemType* list;						// Points to the list
+	int start = UpperBound(hi);			// The position of the first item in the range
+	int count = CountInRange(lo, hi);	// # of items in the range
+	int newSize = GetSize();			// The size the policy calls for once the range is deleted
+
+	// If there are items in the range
+	if(count > 0)
+	{
+		// If the list is mapped from a file, copy it into memory that can be changed
+		Promote();
+
+		list = GetListPtr();
+
+		// Move every item after the range down over it in a single move
+		memmove(&list[start],											// Destination
+				&list[start + count],									// Source
+				(GetLength() - start - count) * sizeof(ItemType));		// # of bytes to move
+
+		// If the list keeps duplicates, move the counts the same way
+		if(counts != NULL)
+		{
+			memmove(&counts[start],										// Destination
+					&counts[start + count],								// Source
+					(GetLength() - start - count) * sizeof(int));		// # of bytes to move
+
+		} // End if
+
+		SetLength(GetLength() - count);
+
+		// Set the current position in the list to where the range was
+		SetCurrPos(start);
+
+		// Apply the policy's contraction until the list is occupied enough, as repeated calls to
+		//  Delete would have
+		while(newSize > policy.minCapacity && GetLength() < policy.shrinkTrigger * newSize)
+		{
+			newSize = int(newSize * policy.shrinkFactor);
+
+		} // End while
+
+		// Never shrink to less than the policy's minimum size or the length of the list
+		if(newSize < policy.minCapacity)
+		{
+			newSize = policy.minCapacity;
+
+		} // End if
+
+		if(newSize < GetLength())
+		{
+			newSize = GetLength();
+
+		} // End if
+
+		// If the list actually gets smaller
+		if(newSize < GetSize())
+		{
+			// Resize the list once, keeping only its occupied part
+			Reallocate(newSize);
+
+		} // End if
+
+	} // End if
+
+	return count;
+
+} // End DeleteRange(KeyType lo, KeyType hi)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+FrozenOrdListClass OrdListClass::Freeze() const
+{
+	ItemType* list = GetListPtr();	// Points to the list
+	vector<KeyType> keys;			// Gets the keys of the list, in order; freed even if the
+									//  FrozenOrdListClass constructor throws
+
+	try
+	{
+		keys.resize(GetLength() + 1);
+
+	} // End try
+	catch(bad_alloc e)	// Failed to allocate memory
+	{
+		throw OutOfMemoryException("OutOfMemoryException : Not enough memory to complete operation.");
+
+	} // End catch(bad_alloc e)
+
+	// Copy the key of each item in the list
+	for(int i = 0; i < GetLength(); i++)
+	{
+		keys[i] = list[i].key;
+
+	} // End for
+
+	return FrozenOrdListClass(keys.data(), GetLength());
+
+} // End Freeze()
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+void OrdListClass::Save(/* in */ const string& fileName) const	// The file to write
+{
+	string tempName = fileName + ".tmp";	// The file written before it replaces fileName
+	ListFileHeader header;					// Describes the list to Open
+	ofstream file;							// The file being written
+
+	// If the items cannot be stored as raw bytes
+	if(!is_trivially_copyable<ItemType>::value)
+	{
+		throw ListFileException("ListFileException : This ItemType cannot be stored in a list file.");
+
+	} // End if
+
+	// Describe the list
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, LIST_FILE_MAGIC, sizeof(header.magic));
+	header.version = LIST_FILE_VERSION;
+	header.headerSize = LIST_FILE_HEADER_SIZE;
+	header.itemSize = uint32_t(sizeof(ItemType));
+	header.keyType = KeyTypeCode();
+	header.length = GetLength();
+	header.checksum = ListChecksum(GetListPtr(), uint64_t(GetLength()) * sizeof(ItemType));
+
+	// If the list counts duplicates, the counts follow the items and the checksum covers them too
+	if(counts != NULL)
+	{
+		header.flags = LIST_FILE_HAS_COUNTS;
+		header.checksum = ListChecksum(counts, uint64_t(GetLength()) * sizeof(int), header.checksum);
+
+	} // End if
+
+	// Write the header and then the items in one contiguous run
+	file.open(tempName.c_str(), ios::out | ios::binary | ios::trunc);
+	file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+	// If there are items to write
+	if(!IsEmpty())
+	{
+		file.write(reinterpret_cast<const char*>(GetListPtr()), streamsize(GetLength()) * sizeof(ItemType));
+
+		// If the list counts duplicates, write the counts after the items
+		if(counts != NULL)
+		{
+			file.write(reinterpret_cast<const char*>(counts), streamsize(GetLength()) * sizeof(int));
+
+		} // End if
+
+	} // End if
+
+	file.close();
+
+	// If the file could not be opened or written
+	if(file.fail())
+	{
+		remove(tempName.c_str());
+		throw ListFileException("ListFileException : " + fileName + " could not be written.");
+
+	} // End if
+
+	// Replace fileName only once the new file is complete. rename replaces an existing file on POSIX,
+	//  even one that is mapped; Windows requires it to be removed first.
+#ifdef _WIN32
+	remove(fileName.c_str());
+#endif
+
+	if(rename(tempName.c_str(), fileName.c_str()) != 0)
+	{
+		remove(tempName.c_str());
+		throw ListFileException("ListFileException : " + fileName + " could not be replaced.");
+
+	} // End if
+
+} // End Save(const string& fileName)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+void OrdListClass::Open(/* in */ const string& fileName)	// The file to open
+{
+	Open(fileName, true);
+
+} // End Open(const string& fileName)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+void OrdListClass::Open(/* in */ const string& fileName,	// The file to open
+						/* in */ bool verify)				// True if the checksum should be checked
+{
+	void* view;						// The mapped view of the file
+	size_t bytes;					// The size of the file
+	const ListFileHeader* header;	// The header at the start of the file
+	ItemType* items;				// The items that follow the header
+	bool hasCounts;					// True if the duplicate counts follow the items
+	uint64_t itemBytes;				// # of bytes of items in the file
+	uint64_t countBytes;			// # of bytes of counts in the file
+	string problem;					// Gets why the file cannot be used, if it cannot
+
+	// If the items cannot be stored as raw bytes
+	if(!is_trivially_copyable<ItemType>::value)
+	{
+		throw ListFileException("ListFileException : This ItemType cannot be stored in a list file.");
+
+	} // End if
+
+	view = MapFile(fileName, bytes);
+	header = static_cast<const ListFileHeader*>(view);
+	items = reinterpret_cast<ItemType*>(static_cast<char*>(view) + LIST_FILE_HEADER_SIZE);
+	hasCounts = (header->flags & LIST_FILE_HAS_COUNTS) != 0;
+	itemBytes = uint64_t(header->length) * sizeof(ItemType);
+	countBytes = hasCounts ? uint64_t(header->length) * sizeof(int) : 0;
+
+	// Check the header against this build's ItemType and against the size of the file
+	if(memcmp(header->magic, LIST_FILE_MAGIC, sizeof(header->magic)) != 0)
+	{
+		problem = " is not a list file.";
+
+	} // End if
+	else if(header->version < 1 || header->version > LIST_FILE_VERSION ||
+			(header->flags & ~LIST_FILE_HAS_COUNTS) != 0)
+	{
+		problem = " was written in an unsupported version of the list file format.";
+
+	} // End else if
+	else if(header->headerSize != uint32_t(LIST_FILE_HEADER_SIZE) ||
+			header->itemSize != uint32_t(sizeof(ItemType)) || header->keyType != KeyTypeCode())
+	{
+		problem = " was written for a different ItemType.";
+
+	} // End else if
+	else if(header->length < 0 || header->length > INT_MAX ||
+			uint64_t(bytes) != LIST_FILE_HEADER_SIZE + itemBytes + countBytes)
+	{
+		problem = " is truncated or damaged.";
+
+	} // End else if
+	else if(verify &&
+			(hasCounts ? ListChecksum(items + header->length, countBytes, ListChecksum(items, itemBytes))
+					   : ListChecksum(items, itemBytes)) != header->checksum)
+	{
+		problem = " is damaged; its checksum does not match.";
+
+	} // End else if
+
+	// If the file cannot be used, leave the list as it was
+	if(!problem.empty())
+	{
+		UnmapFile(view, bytes);
+		throw ListFileException("ListFileException : " + fileName + problem);
+
+	} // End if
+
+	// If the file holds counts, the list counts duplicates and takes them. Otherwise, if the list keeps
+	//  duplicates, every key in the file starts with a count of 1.
+	if(counts != NULL || hasCounts)
+	{
+		try
+		{
+			ResizeCounts((header->length > 0) ? int(header->length) : 1);
+
+		} // End try
+		catch(OutOfMemoryException e)	// Failed to allocate the counts
+		{
+			UnmapFile(view, bytes);
+			throw;
+
+		} // End catch(OutOfMemoryException e)
+
+		if(hasCounts)
+		{
+			// The counts follow the last item
+			memcpy(counts, items + header->length, size_t(countBytes));
+			duplicates = COUNT_DUPLICATES;
+
+		} // End if
+		else
+		{
+			for(int i = 0; i < int(header->length); i++)
+			{
+				counts[i] = 1;
+
+			} // End for
+
+		} // End else
+
+	} // End if
+
+	// Replace the list with the mapped items
+	ReleaseList();
+
+	mapping = view;
+	mappingBytes = bytes;
+
+	SetListPtr(items);
+	SetSize(int(header->length));
+	SetLength(int(header->length));
+	SetCurrPos(FIRST_POSITION);
+
+} // End Open(const string& fileName, bool verify)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+bool OrdListClass::IsMapped() const
+{
+	return mapping != NULL;
+
+} // End IsMapped()
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
@@ -362,16 +1562,17 @@ bool OrdListClass::operator!=(const OrdListClass& rtOp)const	// List to test equ
 
 OrdListClass OrdListClass::operator*(const OrdListClass& rtOp)const	// List to intersect with
 {
-	OrdListClass left;				// left.list gets pointed to the applying object's list
-	OrdListClass right;				// right.list gets pointed to rtOp's list
-	OrdListClass ordIntersection;	// Gets the intersection of the applying object's list and rtOp's
-									//  list
-	bool moreToSearch;				// Determines whether to keep iterating through the loop; Gets true
-									//  if the current position in either the applying object's list or
-									//  rtOp's list is not equal to the length of their list
-
-	// Return the memory allocated to left's list back to the heap
-	delete [] left.GetListPtr();
+	OrdListClass left(resource);			// left.list gets pointed to the applying object's list
+	OrdListClass right(resource);			// right.list gets pointed to rtOp's list
+	OrdListClass ordIntersection(resource);	// Gets the intersection of the applying object's list and
+											//  rtOp's list
+	bool moreToSearch;						// Determines whether to keep iterating through the loop; Gets
+											//  true if the current position in either the applying
+											//  object's list or rtOp's list is not equal to the length
+											//  of their list
+
+	// Return the memory allocated to left's list
+	left.ReleaseList();
 
 	// Point left.list to the applying object's list
 	left.SetListPtr(GetListPtr());
@@ -379,8 +1580,8 @@ OrdListClass OrdListClass::operator*(const OrdListClass& rtOp)const	// List to i
 	// Set left's length to the length of the applying object
 	left.SetLength(GetLength());
 
-	// Return the memory allocated to right's list back to the heap
-	delete [] right.GetListPtr();
+	// Return the memory allocated to right's list
+	right.ReleaseList();
 
 	// Point right.list to rtOp's list
 	right.SetListPtr(rtOp.GetListPtr());
@@ -448,15 +1649,31 @@ OrdListClass OrdListClass::operator*(const OrdListClass& rtOp)const	// List to i
 
 OrdListClass OrdListClass::operator+(const OrdListClass& rtOp)const
 {
-	OrdListClass left;		// left.list gets pointed to the applying object's list
-	OrdListClass right;		// right.list gets pointed to rtOp's list
-	OrdListClass ordUnion;	// Gets the union of the applying object's list and rtOp's list
+	int numPartitions = int(thread::hardware_concurrency());	// # of threads to merge on
+
+	// Give each thread at least MIN_PARTITION_ITEMS items
+	if(numPartitions > (GetLength() + rtOp.GetLength()) / MIN_PARTITION_ITEMS)
+	{
+		numPartitions = (GetLength() + rtOp.GetLength()) / MIN_PARTITION_ITEMS;
+
+	} // End if
+
+	// If the lists are large enough to be worth merging on several threads
+	if(GetLength() + rtOp.GetLength() >= PARALLEL_MERGE_THRESHOLD && numPartitions > 1)
+	{
+		return ParallelUnion(rtOp, numPartitions);
+
+	} // End if
+
+	OrdListClass left(resource);		// left.list gets pointed to the applying object's list
+	OrdListClass right(resource);		// right.list gets pointed to rtOp's list
+	OrdListClass ordUnion(resource);	// Gets the union of the applying object's list and rtOp's list
 	bool moreToSearch;		// Determines whether to keep iterating through the loop; Gets true if the
 							//  current position in either the applying object's list or rtOp's list is
 							//  not equal to the length of their list
 
-	// Return the memory allocated to left's list back to the heap
-	delete [] left.GetListPtr();
+	// Return the memory allocated to left's list
+	left.ReleaseList();
 
 	// Point left.list to the applying object's list
 	left.SetListPtr(GetListPtr());
@@ -464,8 +1681,8 @@ OrdListClass OrdListClass::operator+(const OrdListClass& rtOp)const
 	// Set left's length to the length of the applying object
 	left.SetLength(GetLength());
 
-	// Return the memory allocated to right's list back to the heap
-	delete [] right.GetListPtr();
+	// Return the memory allocated to right's list
+	right.ReleaseList();
 
 	// Point right.list to rtOp's list
 	right.SetListPtr(rtOp.GetListPtr());
@@ -579,28 +1796,188 @@ OrdListClass OrdListClass::operator+(const OrdListClass& rtOp)const
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 
-void OrdListClass::operator=(const OrdListClass& orig)	// Object to aggregately assign
+OrdListClass OrdListClass::ParallelUnion(/* in */ const OrdListClass& rtOp,	// List to merge with
+										 /* in */ int numPartitions) const	// # of threads to merge on
 {
-	try
+	const ItemType* leftList = GetListPtr();		// Points to the applying object's list
+	const ItemType* rightList = rtOp.GetListPtr();	// Points to rtOp's list
+	int total = GetLength() + rtOp.GetLength();		// # of items in both lists
+	vector<int> leftCuts(numPartitions + 1);		// leftCuts[p] is the first item of the applying
+													//  object's list that partition p merges
+	vector<int> rightCuts(numPartitions + 1);		// rightCuts[p] is the same for rtOp's list
+	vector<int> offsets(numPartitions);				// offsets[p] is where partition p's keys go in
+													//  ordUnion; first the # of keys it keeps
+	vector<thread> workers;							// Merge every partition but the first
+	int numStarted;									// # of partitions started on a thread, plus the
+													//  first
+	OrdListClass ordUnion(resource);				// Gets the union of the two lists
+
+	// Cut the merged order into numPartitions equal pieces and co-rank each cut
+	for(int p = 0; p <= numPartitions; p++)
+	{
+		leftCuts[p] = CoRank(leftList, GetLength(), rightList, rtOp.GetLength(),
+							 int((long long)total * p / numPartitions));
+		rightCuts[p] = int((long long)total * p / numPartitions) - leftCuts[p];
+
+	} // End for
+
+	// Reserve the workers first, so that a failed push_back cannot destroy a running thread
+	workers.reserve(numPartitions - 1);
+
+	// First pass: count the keys each partition keeps once duplicates are dropped
+	for(numStarted = 1; numStarted < numPartitions; numStarted++)
+	{
+		try
+		{
+			workers.push_back(thread(MergePartition, leftList, rightList, leftCuts[numStarted],
+									 leftCuts[numStarted + 1], rightCuts[numStarted],
+									 rightCuts[numStarted + 1], (ItemType*)NULL, &offsets[numStarted]));
+
+		} // End try
+		catch(system_error e)
+		{
+			// The system will not start another thread; the rest are merged on this one
+			break;
+
+		} // End catch
+
+	} // End for
+
+	MergePartition(leftList, rightList, leftCuts[0], leftCuts[1], rightCuts[0], rightCuts[1], NULL,
+				   &offsets[0]);
+
+	for(int p = numStarted; p < numPartitions; p++)
+	{
+		MergePartition(leftList, rightList, leftCuts[p], leftCuts[p + 1], rightCuts[p],
+					   rightCuts[p + 1], NULL, &offsets[p]);
+
+	} // End for
+
+	for(size_t i = 0; i < workers.size(); i++)
+	{
+		workers[i].join();
+
+	} // End for
+
+	workers.clear();
+
+	// Turn the counts into the position where each partition's first key goes
+	total = 0;
+
+	for(int p = 0; p < numPartitions; p++)
+	{
+		int kept = offsets[p];	// # of keys partition p keeps
+
+		offsets[p] = total;
+		total += kept;
+
+	} // End for
+
+	// Size the result once
+	ordUnion.Reserve(total);
+
+	// Second pass: each partition writes its keys straight to their final positions
+	for(numStarted = 1; numStarted < numPartitions; numStarted++)
+	{
+		try
+		{
+			workers.push_back(thread(MergePartition, leftList, rightList, leftCuts[numStarted],
+									 leftCuts[numStarted + 1], rightCuts[numStarted],
+									 rightCuts[numStarted + 1],
+									 ordUnion.GetListPtr() + offsets[numStarted], (int*)NULL));
+
+		} // End try
+		catch(system_error e)
+		{
+			// The system will not start another thread; the rest are merged on this one
+			break;
+
+		} // End catch
+
+	} // End for
+
+	MergePartition(leftList, rightList, leftCuts[0], leftCuts[1], rightCuts[0], rightCuts[1],
+				   ordUnion.GetListPtr(), NULL);
+
+	for(int p = numStarted; p < numPartitions; p++)
+	{
+		MergePartition(leftList, rightList, leftCuts[p], leftCuts[p + 1], rightCuts[p],
+					   rightCuts[p + 1], ordUnion.GetListPtr() + offsets[p], NULL);
+
+	} // End for
+
+	for(size_t i = 0; i < workers.size(); i++)
+	{
+		workers[i].join();
+
+	} // End for
+
+	// Leave the result as the serial merge does, with currPos at the end of the list
+	ordUnion.SetLength(total);
+	ordUnion.SetCurrPos(total);
+
+	return ordUnion;
+
+} // End ParallelUnion(const OrdListClass& rtOp, int numPartitions) const
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+OrdListClass& OrdListClass::operator=(const OrdListClass& orig)	// Object to aggregately assign
+{
+	// If orig is not the applying object
+	if(this != &orig)
 	{
 		ItemType* newList = GetListPtr();	// Points to the applying object's list
+		int origSize = (orig.GetSize() > 0) ? orig.GetSize() : 1;	// The size of a list copied from orig
+
+		// If orig keeps duplicates, make room for its counts first, so that a failure leaves the
+		//  applying object unchanged. The counts must cover the list at its current or new size.
+		if(orig.counts != NULL)
+		{
+			ResizeCounts((GetSize() > origSize) ? GetSize() : origSize);
+
+			memcpy(counts,								// Destination
+				   orig.counts,							// Source
+				   orig.GetLength() * sizeof(int));		// # of bytes to copy
+
+		} // End if
+		// Else the applying object no longer needs counts
+		else
+		{
+			free(counts);
+			counts = NULL;
+
+		} // End else
+
+		duplicates = orig.duplicates;
+
+		// If the applying object's list is too small to hold orig's items, or is a read-only mapping
+		//  of a file
+		if(GetSize() < orig.GetLength() || IsMapped())
+		{
+			// Allocate memory for a new list the size of orig's list (at least one item)
+			newList = AllocateList(origSize);
 
-		// Return the memory allocated to the list back to the heap
-		delete [] newList;
+			// Return the old list back to the heap, or unmap it
+			ReleaseList();
 
-		// Allocate memory for a new list the size of orig's list
-		newList = new ItemType[orig.GetSize()];
+			// Set the applying object's list pointer to the list pointed to by newList
+			SetListPtr(newList);
 
-		// Set the applying object's size to orig's size
-		SetSize(orig.GetSize());
+			// Set the applying object's size to the size of the new list
+			SetSize(origSize);
 
-		// Copy orig's list to the list pointed to by newList
-		memcpy(newList,							// Destination
-			   orig.GetListPtr(),				// Source
-			   GetSize() * sizeof(ItemType));	// # of bytes to copy
+		} // End if
+
+		// If orig has items to copy
+		if(!orig.IsEmpty())
+		{
+			// Copy orig's items to the list pointed to by newList
+			memcpy(newList,								// Destination
+				   orig.GetListPtr(),					// Source
+				   orig.GetLength() * sizeof(ItemType));	// # of bytes to copy
 
-		// Set the applying object's list pointer to the list pointed to by newList
-		SetListPtr(newList);
+		} // End if
 
 		// Set the current position of the applying object to the current position of orig
 		SetCurrPos(orig.GetCurrPos());
@@ -608,51 +1985,63 @@ void OrdListClass::operator=(const OrdListClass& orig)	// Object to aggregately
 		// Set the length of the applying object to the length of orig
 		SetLength(orig.GetLength());
 
-	} // End try
-	catch(bad_alloc e)	// Failed to allocate memory
-	{
-		throw OutOfMemoryException("OutOfMemoryException : Not enough memory to complete operation.");
+	} // End if
 
-	} // End catch(bad_alloc e)
+	return *this;
 
 } // End operator=(const OrdListClass& orig)
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+const ItemType& OrdListClass::operator[](/* in */ int position) const	// The position of the item
+{
+	return GetListPtr()[position];
+
+} // End operator[](int position)
+
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-// Implementation of Protected Methods
 
-void OrdListClass::Expand()
+OrdListClass& OrdListClass::operator=(OrdListClass&& orig) noexcept	// Object to take the list from
 {
-	try
+	// If orig is not the applying object
+	if(this != &orig)
 	{
-		// Allocate memory for an array twice the size of the applying object's list
-		ItemType* newList = new ItemType[EXPANSION_FACTOR * GetSize()];	// Points to the expanded list
+		// Exchange lists with orig
+		Swap(orig);
+
+		// Empty orig, which now holds the applying object's former list
+		orig.Clear();
 
-		ItemType* oldList = GetListPtr();	// Points to the applying object's list
+	} // End if
 
-		// Copy each item from the applying object's list into the list pointed to by newList
-		memcpy(newList,							// Destination
-			   oldList,							// Source
-			   GetSize() * sizeof(ItemType));	// # of bytes to copy
+	return *this;
 
-		// Return the memory allocated to the applying object's list back to the heap
-		delete [] oldList;
+} // End operator=(OrdListClass&& orig)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Implementation of Protected Methods
 
-		// Point oldList to NULL
-		oldList = NULL;
+void OrdListClass::Expand()
+{
+	int newSize = int(GetSize() * policy.growthFactor);	// The size of the expanded list
 
-		// Set the applying object's list pointer to the list pointed to by newList
-		SetListPtr(newList);
+	// Always grow by at least one item
+	if(newSize <= GetSize())
+	{
+		newSize = GetSize() + 1;
 
-		// Set the applying object's size to twice its original size
-		SetSize(EXPANSION_FACTOR * GetSize());
+	} // End if
 
-	} // End try
-	catch(bad_alloc e)	// Failed to allocate memory
+	// Never grow to less than the policy's minimum size
+	if(newSize < policy.minCapacity)
 	{
-		throw OutOfMemoryException("OutOfMemoryException : Not enough memory to complete operation.");
+		newSize = policy.minCapacity;
 
-	} // End catch(bad_alloc e)
+	} // End if
+
+	// Resize the list, keeping its items
+	Reallocate(newSize);
 
 } // End Expand()
 
@@ -660,37 +2049,29 @@ void OrdListClass::Expand()
 
 void OrdListClass::Contract()
 {
-	try
-	{
-		// Allocate memory for an array half the size of the applying object's list
-		ItemType* newList = new ItemType[int(GetSize() * CONTRACTION_FACTOR)];	// Points to the
-																				//  expanded list
+	int newSize = int(GetSize() * policy.shrinkFactor);	// The size of the contracted list
 
-		ItemType* oldList = GetListPtr();	// Points to the applying object's list
-
-		// Set the applying object's size to half its original size
-		SetSize(int(GetSize() * CONTRACTION_FACTOR));
-
-		// Copy each item from the applying object's list into the list pointed to by newList
-		memcpy(newList,							// Destination
-			   oldList,							// Source
-			   GetSize() * sizeof(ItemType));	// # of bytes to copy
+	// Never shrink to less than the policy's minimum size
+	if(newSize < policy.minCapacity)
+	{
+		newSize = policy.minCapacity;
 
-		// Return the memory allocated to the applying object's list back to the heap
-		delete [] oldList;
+	} // End if
 
-		// Point oldList to NULL
-		oldList = NULL;
+	// Never shrink to less than the length of the list
+	if(newSize < GetLength())
+	{
+		newSize = GetLength();
 
-		// Set the applying object's list pointer to the list pointed to by newList
-		SetListPtr(newList);
+	} // End if
 
-	} // End try
-	catch(bad_alloc e)	// Failed to allocate memory
+	// If the list actually gets smaller
+	if(newSize < GetSize())
 	{
-		throw OutOfMemoryException("OutOfMemoryException : Not enough memory to complete operation.");
+		// Resize the list, keeping only its occupied part
+		Reallocate(newSize);
 
-	} // End catch(bad_alloc e)
+	} // End if
 
 } // End Contract()
 
@@ -702,6 +2083,249 @@ bool OrdListClass::NoRoom()
 
 } // End NoRoom()
 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+void OrdListClass::Reallocate(/* in */ int newSize)	// The new size of the list
+{
+	ItemType* oldList = GetListPtr();	// Points to the applying object's list
+	ItemType* newList;					// Points to the resized list
+	int oldSize = GetSize();			// The size of the list before it is resized
+	int* fewerCounts;					// Points to the shrunken counts
+
+	// If the list keeps duplicates and is growing, grow the counts first, so that a failure leaves the
+	//  list unchanged
+	if(counts != NULL && newSize > GetSize())
+	{
+		ResizeCounts(newSize);
+
+	} // End if
+
+	// If the list is a read-only mapping of a file
+	if(IsMapped())
+	{
+		// Copy the items out of the mapping into a list that can be changed
+		newList = AllocateList(newSize);
+
+		memcpy(newList,								// Destination
+			   oldList,								// Source
+			   GetLength() * sizeof(ItemType));		// # of bytes to copy
+
+		// Unmap the file
+		ReleaseList();
+
+	} // End if
+	// Else if the list is on the heap and items can be moved with a byte copy
+	else if(resource == NULL && is_trivially_copyable<ItemType>::value)
+	{
+		// Resize the list with realloc, which grows it in place when the memory after it is free and,
+		//  for large lists, remaps its pages instead of copying them
+		newList = static_cast<ItemType*>(realloc(oldList, size_t(newSize) * sizeof(ItemType)));
+
+		// If realloc failed, the old list is still valid and still owned by the applying object
+		if(newList == NULL)
+		{
+			throw OutOfMemoryException("OutOfMemoryException : Not enough memory to complete operation.");
+
+		} // End if
+
+	} // End if
+	// Else items must be copied to a new block
+	else
+	{
+		// Allocate memory for the resized list
+		newList = AllocateList(newSize);
+
+		// Copy each item in the list into the resized list
+		for(int i = 0; i < GetLength(); i++)
+		{
+			newList[i] = oldList[i];
+
+		} // End for
+
+		// Return the memory allocated to the old list
+		FreeList(oldList, oldSize);
+
+	} // End else
+
+	// Set the applying object's list pointer and size to those of the resized list
+	SetListPtr(newList);
+	SetSize(newSize);
+
+	// If the list keeps duplicates and has shrunk, shrink the counts too. If realloc fails, the larger
+	//  counts are kept, which still cover the list.
+	if(counts != NULL && newSize < oldSize && newSize > 0)
+	{
+		fewerCounts = static_cast<int*>(realloc(counts, size_t(newSize) * sizeof(int)));
+
+		if(fewerCounts != NULL)
+		{
+			counts = fewerCounts;
+
+		} // End if
+
+	} // End if
+
+} // End Reallocate(int newSize)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+ItemType* OrdListClass::AllocateList(/* in */ int newSize)	// # of items to allocate memory for
+{
+	ItemType* newList = NULL;	// Points to the allocated list
+
+	// If the list has a memory resource
+	if(resource != NULL)
+	{
+		try
+		{
+			newList = static_cast<ItemType*>(resource->allocate(size_t(newSize) * sizeof(ItemType),
+																 alignof(ItemType)));
+
+		} // End try
+		catch(bad_alloc e)	// Failed to allocate memory
+		{
+			throw OutOfMemoryException("OutOfMemoryException : Not enough memory to complete operation.");
+
+		} // End catch(bad_alloc e)
+
+		// If items need their constructors run
+		if(!is_trivially_copyable<ItemType>::value)
+		{
+			uninitialized_value_construct_n(newList, newSize);
+
+		} // End if
+
+	} // End if
+	// Else if items can be moved with a byte copy
+	else if(is_trivially_copyable<ItemType>::value)
+	{
+		// Allocate with malloc so that Reallocate can later use realloc
+		newList = static_cast<ItemType*>(malloc(size_t(newSize) * sizeof(ItemType)));
+
+		// If malloc failed
+		if(newList == NULL)
+		{
+			throw OutOfMemoryException("OutOfMemoryException : Not enough memory to complete operation.");
+
+		} // End if
+
+	} // End if
+	// Else items need their constructors run
+	else
+	{
+		try
+		{
+			newList = new ItemType[newSize];
+
+		} // End try
+		catch(bad_alloc e)	// Failed to allocate memory
+		{
+			throw OutOfMemoryException("OutOfMemoryException : Not enough memory to complete operation.");
+
+		} // End catch(bad_alloc e)
+
+	} // End else
+
+	return newList;
+
+} // End AllocateList(int newSize)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+void OrdListClass::FreeList(/* in */ ItemType* oldList,	// List to return to the heap
+							 /* in */ int oldSize)			// # of items oldList was allocated for
+{
+	// If the list was allocated from the list's memory resource
+	if(resource != NULL)
+	{
+		// If there is a list to return
+		if(oldList != NULL)
+		{
+			// If items need their destructors run
+			if(!is_trivially_copyable<ItemType>::value)
+			{
+				destroy_n(oldList, oldSize);
+
+			} // End if
+
+			resource->deallocate(oldList, size_t(oldSize) * sizeof(ItemType), alignof(ItemType));
+
+		} // End if
+
+	} // End if
+	// Else if the list was allocated with malloc
+	else if(is_trivially_copyable<ItemType>::value)
+	{
+		free(oldList);
+
+	} // End else if
+	// Else the list was allocated with new
+	else
+	{
+		delete [] oldList;
+
+	} // End else
+
+} // End FreeList(ItemType* oldList, int oldSize)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+void OrdListClass::Promote()
+{
+	// If the list is a read-only mapping of a file
+	if(IsMapped())
+	{
+		// Copy it into a list of the same size (at least one item), which unmaps the file
+		Reallocate((GetSize() > 0) ? GetSize() : 1);
+
+	} // End if
+
+} // End Promote()
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+void OrdListClass::ReleaseList()
+{
+	// If the list is a mapping of a file
+	if(IsMapped())
+	{
+		UnmapFile(mapping, mappingBytes);
+
+		mapping = NULL;
+		mappingBytes = 0;
+
+	} // End if
+	// Else the list was allocated by AllocateList
+	else
+	{
+		FreeList(GetListPtr(), GetSize());
+
+	} // End else
+
+	SetListPtr(NULL);
+
+} // End ReleaseList()
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+void OrdListClass::ResizeCounts(/* in */ int newSize)	// # of counts the array must hold
+{
+	int* newCounts;	// Points to the resized counts
+
+	// Resize the counts with realloc, which allocates them when counts is NULL
+	newCounts = static_cast<int*>(realloc(counts, size_t(newSize) * sizeof(int)));
+
+	// If realloc failed, the old counts are still valid
+	if(newCounts == NULL)
+	{
+		throw OutOfMemoryException("OutOfMemoryException : Not enough memory to complete operation.");
+
+	} // End if
+
+	counts = newCounts;
+
+} // End ResizeCounts(int newSize)
+
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 // Implementation of PVF's
@@ -733,3 +2357,14 @@ void OrdListClass::Print()
 		 << "Size: " << GetSize() << endl;
 
 } // End Print()
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Implementation of Non-member Functions
+
+void swap(/* in/out */ OrdListClass& left,				// List to exchange with right
+		  /* in/out */ OrdListClass& right) noexcept	// List to exchange with left
+{
+	left.Swap(right);
+
+} // End swap(OrdListClass& left, OrdListClass& right)
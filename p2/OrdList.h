@@ -6,8 +6,11 @@
 //
 //				BE SURE TO DOCUMENT THIS CLASS FULLY!!! 
 //Purpose: This file contains the specification for an expandable/contractable ordered list(descending)
-//   class. It inherits basic properties and actions from the abstract base ListClass. Duplicates are
-//	 not allowed to be inserted into the list.
+//   class. It inherits basic properties and actions from the abstract base ListClass. By default,
+//	 duplicates are not allowed to be inserted into the list. A list given the COUNT_DUPLICATES policy
+//	 instead keeps a count of how many times each key has been inserted. A list given a memory
+//	 resource allocates its items from that resource instead of the heap, so that many short-lived
+//	 lists can share an arena that is released all at once.
 //
 //                         SUMMARY OF METHODS
 //
@@ -17,10 +20,18 @@
 //	OrdListClass();
 //		Instantiates an OrdListClass object. Sets length and currPos to zero. Sets size to MAX_ENTRIES.
 //		Sets list to the address of the list.
+//	OrdListClass(const CapacityPolicy& newPolicy);
+//		Instantiates an OrdListClass object that grows and shrinks its list according to newPolicy.
+//	OrdListClass(DuplicatePolicy newDuplicates);
+//		Instantiates an OrdListClass object that handles duplicate keys according to newDuplicates.
+//	OrdListClass(pmr::memory_resource* newResource);
+//		Instantiates an OrdListClass object that allocates its items from newResource.
 //	~OrdListClass();
 //		Deallocates memory from an OrdListClass object
 //	OrdListClass(const OrdListClass& orig);
 //		Instantiates a deep copy of orig.
+//	OrdListClass(OrdListClass&& orig);
+//		Instantiates an OrdListClass object that takes over orig's list without copying it.
 //
 //To provide the ability to order the list, the following functions must be OVERIDDEN:
 //  
@@ -35,9 +46,68 @@
 //
 //	void NextPosition();
 //		Sets currPos to next element in list
+//	InsertStatus TryInsert(ItemType target);
+//		Inserts target at currPos, returning a status instead of throwing when its key is a duplicate.
+//	int GetCount() const;
+//		Returns the number of times the key at currPos has been inserted.
+//	const_iterator begin() const / end() const;
+//		Return contiguous, random-access iterators over the items, for STL algorithms and range-for.
+//	const_iterator cbegin() const / cend() const;
+//		The same as begin() and end().
+//	ItemSpan GetItems() const;
+//		Returns a read-only view of every item in the list.
+//	const ItemType& At(int position) const;
+//		Returns the item at position without copying it or changing currPos.
+//	const ItemType& Current() const;
+//		Returns the item at currPos without copying it.
+//	void SetDuplicatePolicy(DuplicatePolicy newDuplicates);
+//		Sets how the list handles duplicate keys.
+//	DuplicatePolicy GetDuplicatePolicy() const;
+//		Returns how the list handles duplicate keys.
+//	pmr::memory_resource* GetMemoryResource() const;
+//		Returns the memory resource the list allocates its items from, or NULL for the heap.
 //	void Clear();
-//		Clears the list returning it to its original state. Sets size equal to MAX_ENTRIES. Sets length
-//		to EMPTY. Sets currPos to FIRST_POSITION.
+//		Clears the list. Sets length to EMPTY and currPos to FIRST_POSITION. The allocated size of the
+//		list is kept so that refilling the list does not reallocate.
+//	void Clear(bool shrink);
+//		Clears the list. If shrink is true, the list is also returned to its original size of
+//		MAX_ENTRIES.
+//	void Swap(OrdListClass& other);
+//		Exchanges the contents of the applying object and other without copying either list.
+//	void Reserve(int capacity);
+//		Grows the list so that it can hold at least capacity items without expanding.
+//	void ShrinkToFit();
+//		Shrinks the list so that its size equals its length.
+//	int GetCapacity() const;
+//		Returns the number of items the list can hold before it must expand.
+//	void SetCapacityPolicy(const CapacityPolicy& newPolicy);
+//		Sets the policy used to grow and shrink the list.
+//	CapacityPolicy GetCapacityPolicy() const;
+//		Returns the policy used to grow and shrink the list.
+//	int LowerBound(KeyType key) const;
+//		Returns the position of the first item whose key is less than or equal to key.
+//	int UpperBound(KeyType key) const;
+//		Returns the position of the first item whose key is less than key.
+//	bool FindFrom(KeyType key);
+//		Finds position of key as Find does, searching outward from currPos instead of over the list.
+//	int LookupSorted(const KeyType keys[], int count, int positions[]) const;
+//		Finds the position of each of a sorted set of keys, each search starting where the last ended.
+//	int CountInRange(KeyType lo, KeyType hi) const;
+//		Returns the number of items whose keys are in [lo, hi).
+//	ItemSpan GetRange(KeyType lo, KeyType hi) const;
+//		Returns a view of the items whose keys are in [lo, hi) without copying them.
+//	int DeleteRange(KeyType lo, KeyType hi);
+//		Deletes every item whose key is in [lo, hi) with a single move of the items after them.
+//	FrozenOrdListClass Freeze() const;
+//		Returns an immutable, compressed copy of the keys in the list.
+//	void Save(const string& fileName) const;
+//		Writes the list to fileName in the format described in ListFile.h.
+//	void Open(const string& fileName);
+//		Replaces the list with the one saved in fileName, mapping the file instead of reading it.
+//	void Open(const string& fileName, bool verify);
+//		As Open(fileName), but the checksum of the items is only checked if verify is true.
+//	bool IsMapped() const;
+//		Returns true if the list is still the read-only mapping of a file opened by Open.
 //
 //The following methods are also implemented as required by the Abstract Base Class:
 //
@@ -56,20 +126,41 @@
 //		Joins/intersects the contents of rtOp with that ListClass (only keys appearing in both will
 //		appear in the resultant class)
 //	virtual OrdListClass operator+(const OrdListClass& rtOp) const;
-//		Merges lists (if duplicates encountered, only 1 ends up in list)
-//	virtual void operator=(const OrdListClass& orig);
-//		Assigns orig to applying class object.
+//		Merges lists (if duplicates encountered, only 1 ends up in list). The results of operator*
+//		and operator+ reject duplicates and hold each key once, whatever the operands' policies, and
+//		are allocated from the applying object's memory resource.
+//	virtual OrdListClass& operator=(const OrdListClass& orig);
+//		Assigns orig to applying class object. The applying object's list is reused if it is large
+//		enough to hold orig's items.
+//	const ItemType& operator[](int position) const;
+//		Returns the item at position without copying it or changing currPos.
+//	OrdListClass& operator=(OrdListClass&& orig);
+//		Assigns orig to applying class object by exchanging lists with orig.
 //
 //The following private methods have been added to allow expansion and contraction:
 //
 //	virtual void Expand();
-//		Creates a new list twice the size of the original and copies the info from the smaller list to
-//		the larger one.
+//		Grows the list by the policy's growthFactor.
 //	virtual void Contract();
-//		Creates a new list half the size of the original and copies the info from the old list to the
-//		new one.
+//		Shrinks the list by the policy's shrinkFactor.
 //	virtual bool NoRoom();
 //		Returns true if list has no empty locations, false otherwise.
+//	void Reallocate(int newSize);
+//		Changes the size of the list, keeping its items. Trivially copyable items on the heap are
+//		moved with realloc, which can grow the list in place (or, for large lists, remap its pages)
+//		instead of copying it.
+//	ItemType* AllocateList(int newSize);
+//		Allocates memory for a list of newSize items from the list's memory resource, or the heap.
+//	void FreeList(ItemType* oldList, int oldSize);
+//		Returns the memory of a list allocated by AllocateList back to where it came from.
+//	void ResizeCounts(int newSize);
+//		Resizes the array of duplicate counts kept in COUNT_DUPLICATES mode.
+//	OrdListClass ParallelUnion(const OrdListClass& rtOp, int numPartitions) const;
+//		Merges the applying object's list with rtOp's on numPartitions threads, for operator+.
+//	void Promote();
+//		Copies a mapped list into memory from AllocateList so that it can be changed.
+//	void ReleaseList();
+//		Unmaps or frees the list, whichever way it is held.
 //
 //ASSUMPTIONS: 
 // (1): The definition of the struct ItemType will be supplied by the client in a file called ItemType.h
@@ -80,10 +171,19 @@
 // TO ENSURE PROPER CLASS FUNCTION:
 // (3): On an INSERTION, method Find() must be called immediately before using Insert().
 // (4): On a DELETION, method Find() must be called before using Delete().
+// (5): A memory resource given to a list must outlive the list and every list copied or built from
+//		it, since copies and the results of operator* and operator+ allocate from the same resource.
 //
 //Exception Handling:
-//	bad_alloc is caught in methods operator=, Expand, and Contract if an attempt to allocate dynamic
-//		memory fails 
+//	bad_alloc is caught in method AllocateList if an attempt to allocate dynamic memory fails, and
+//		Reallocate throws OutOfMemoryException if realloc fails. Every method that changes the size of
+//		the list can therefore throw OutOfMemoryException.
+//	InvalidCapacityPolicyException is thrown when a CapacityPolicy that IsValidPolicy rejects is given
+//		to the list.
+//	ListFileException is thrown by Save and Open when the file cannot be written, opened or mapped, or
+//		is not a valid list file for this ItemType.
+//	DuplicateKeyException is thrown by Insert when the list rejects duplicates and the key of the
+//		target is already in the list. TryInsert never throws it.
 //
 
 
@@ -92,15 +192,59 @@
 
 #include<iostream>			// For cout in Print()
 #include<cstddef>			// For NULL
+#include<cstdlib>			// For malloc, realloc and free
+#include<cstring>			// For memcpy and memmove
+#include<new>				// For bad_alloc
+#include<memory>			// For uninitialized_value_construct_n and destroy_n
+#include<memory_resource>	// For pmr::memory_resource
+#include<type_traits>		// For is_trivially_copyable
+#include<string>			// For file names
 #include "ABCListClass.h"	// For base class, ListClass
+#include "CapacityPolicy.h"	// For CapacityPolicy and DEFAULT_CAPACITY_POLICY
+#include "DuplicatePolicy.h"	// For DuplicatePolicy and InsertStatus
+#include "FrozenOrdList.h"	// For FrozenOrdListClass, returned by Freeze()
+#include "ListFile.h"		// For ListFileHeader, the format used by Save and Open
 #include "Exceptions.h"		// For custom exceptions, DuplicateKeyException and OutOfMemoryException
 using namespace std;
 using namespace nmspcExceptions;
 
+const int PARALLEL_MERGE_THRESHOLD = 1 << 18;	// operator+ merges in parallel when the two lists hold at
+												//  least this many items between them
+const int MIN_PARTITION_ITEMS = 1 << 16;		// Fewest items a parallel merge gives each thread
+const int NOT_FOUND = -1;						// Position LookupSorted gives a key not in the list
+
+// A read-only view of consecutive items in an OrdListClass list. The items are in descending order
+//  of key. The view is only valid until the list is next changed. Its iterators are pointers into
+//  the list, so they are contiguous, random-access iterators that any STL algorithm can use.
+struct ItemSpan
+{
+	typedef ItemType value_type;				// For STL algorithms
+	typedef const ItemType* const_iterator;		// For STL algorithms
+	typedef const ItemType* iterator;			// The view is read-only, so both iterators are const
+
+	const ItemType* first;	// Points to the first item in the view
+	const ItemType* last;	// Points one past the last item in the view
+
+	const ItemType* begin() const { return first; }		// For range-based for loops
+	const ItemType* end() const { return last; }		// For range-based for loops
+	const ItemType* data() const { return first; }		// Points to the first item in the view
+	size_t size() const { return size_t(last - first); }	// # of items in the view, for STL code
+	bool empty() const { return first == last; }		// True if the view holds no items
+	int Length() const { return int(last - first); }	// # of items in the view
+
+	const ItemType& operator[](int position) const { return first[position]; }	// Item at position
+
+}; // End ItemSpan
+
 // Class Declarations 
 class OrdListClass : public ListClass	// Uses ListClass as template for further derivations
 {
 	public: 
+
+		typedef ItemType value_type;				// For STL algorithms
+		typedef const ItemType* const_iterator;		// Iterates over the list without changing currPos
+		typedef const ItemType* iterator;			// Items are read-only, since changing a key could
+													//  break the order of the list
 		
 		OrdListClass(); 
 		//Purpose:				Instantiates an OrdListClass object. Sets length and currPos to zero.
@@ -112,6 +256,40 @@ class OrdListClass : public ListClass	// Uses ListClass as template for further
 		//Order of Magnitude:	O(1)
 
 
+		explicit OrdListClass(const CapacityPolicy& newPolicy);	// Policy used to grow and shrink
+		//Purpose:				Instantiates an OrdListClass object that grows and shrinks its list
+		//						according to newPolicy. Sets length and currPos to zero. Sets size to
+		//						newPolicy.minCapacity.
+		//Pre:					None
+		//Post:					An empty OrdListClass object using newPolicy has been instantiated.
+		//Classification:		Non-default Constructor
+		//Order of Magnitude:	O(1)
+		//Exceptions Thrown:	InvalidCapacityPolicyException, OutOfMemoryException
+
+
+		explicit OrdListClass(DuplicatePolicy newDuplicates);	// How duplicate keys are handled
+		//Purpose:				Instantiates an empty OrdListClass object that handles duplicate keys
+		//						according to newDuplicates, using the default capacity policy.
+		//Pre:					None
+		//Post:					An empty OrdListClass object using newDuplicates has been instantiated.
+		//Classification:		Non-default Constructor
+		//Order of Magnitude:	O(1)
+		//Exceptions Thrown:	OutOfMemoryException
+
+
+		explicit OrdListClass(pmr::memory_resource* newResource);	// Where the items are allocated
+		//Purpose:				Instantiates an empty OrdListClass object that allocates its items from
+		//						newResource instead of the heap, using the default capacity policy. With
+		//						a pmr::monotonic_buffer_resource, every list built for a request can be
+		//						allocated from one arena, without locking the heap, and released at once
+		//						when the arena is. If newResource is NULL, the heap is used.
+		//Pre:					newResource outlives the list.
+		//Post:					An empty OrdListClass object using newResource has been instantiated.
+		//Classification:		Non-default Constructor
+		//Order of Magnitude:	O(1)
+		//Exceptions Thrown:	OutOfMemoryException
+
+
 		~OrdListClass();
 		//Purpose:				Deallocates memory from an OrdListClass object
 		//Pre:					An OrdListClass object exists
@@ -121,11 +299,24 @@ class OrdListClass : public ListClass	// Uses ListClass as template for further
 		
 
 		OrdListClass(const OrdListClass& orig);	// The original OrdListClass object
-		//Purpose:				Instantiates a deep copy of orig.
+		//Purpose:				Instantiates a deep copy of orig, allocated from orig's memory resource.
 		//Pre:					orig exists
 		//Post:					A deep copy of orig has been instantiated
 		//Classification:		Copy Constructor
-		//Order of Magnitude:	O(1), operator= is called, which is O(1)
+		//Order of Magnitude:	O(N), operator= is called, which is O(N), where N is the length of orig's
+		//						list
+
+		
+		OrdListClass(OrdListClass&& orig);	// The OrdListClass object to take the list from
+		//Purpose:				Instantiates an OrdListClass object that takes over orig's list without
+		//						copying it. orig is left as an empty list with no memory, which
+		//						allocates on its first Insert.
+		//Pre:					orig exists
+		//Post:					The applying object holds the list, length, size, currPos, duplicate
+		//						policy and counts that orig held. orig's list is NULL, its size, length
+		//						and currPos are 0, and it rejects duplicates.
+		//Classification:		Move Constructor
+		//Order of Magnitude:	O(1)
 
 
 		void NextPosition(); 
@@ -160,8 +351,23 @@ class OrdListClass : public ListClass	// Uses ListClass as template for further
 		//Exceptions Thrown:	DuplicateKeyException, OutOfMemoryException
 
 
+		InsertStatus TryInsert(/* in */ ItemType target);	// The target to insert
+		//Purpose:				Inserts target into OrdList at position specified by PDM currPos. If the
+		//						key of target is already there, the list's DuplicatePolicy decides what
+		//						happens, and the result is returned instead of thrown.
+		//Pre:					currPos contains location at which to insert new element, where
+		//						(0 <= currPos <= length), as set by Find(target.key).
+		//Post:					INSERTED has been returned if target has been inserted at currPos.
+		//						DUPLICATE_COUNTED has been returned if the count of target's key has been
+		//						increased. DUPLICATE_REJECTED has been returned if the list is unchanged.
+		//Classification:		Mutator
+		//Order of Magnitude:	O(N) worst case, where N is the length of the list
+		//Exceptions Thrown:	OutOfMemoryException
+
+
 		void Delete(); 
-		//Purpose:				Deletes list element specified by currPos.
+		//Purpose:				Deletes list element specified by currPos. In COUNT_DUPLICATES mode, a key
+		//						inserted more than once only has its count reduced by one.
 		//Pre:					currPos contains the location of the element to be deleted, where
 		//						(O <= position < length).
 	    //Post:					The list element specified by currPos has been deleted from list. If
@@ -172,13 +378,339 @@ class OrdListClass : public ListClass	// Uses ListClass as template for further
 
 
 		void Clear(); 
-		//Purpose:				Clears the list returning it to its original state. Sets size equal to
-		//						MAX_ENTRIES. Sets length to EMPTY. Sets currPos to FIRST_POSITION.
+		//Purpose:				Clears the list. Sets length to EMPTY and currPos to FIRST_POSITION. The
+		//						size of the list is kept, so no memory is freed or allocated.
+		//Pre:					List has been instantiated.
+		//Post:					List has been cleared. length equals EMPTY. currPos equals
+		//						FIRST_POSITION. size is unchanged.
+		//Classification:		Mutator
+		//Order of Magnitude:	O(1)
+
+
+		void Clear(/* in */ bool shrink);	// True if the list should return to its minimum size
+		//Purpose:				Clears the list. If shrink is true and size is greater than the policy's
+		//						minCapacity, the list is also returned to minCapacity (MAX_ENTRIES by
+		//						default).
+		//Pre:					List has been instantiated.
+		//Post:					List has been cleared. length equals EMPTY. currPos equals
+		//						FIRST_POSITION. If shrink is true, size equals minCapacity, otherwise
+		//						size is unchanged.
+		//Classification:		Mutator
+		//Order of Magnitude:	O(1)
+		//Exceptions Thrown:	OutOfMemoryException
+
+
+		void Swap(/* in/out */ OrdListClass& other) noexcept;	// The list to exchange contents with
+		//Purpose:				Exchanges the list, length, size, currPos, capacity policy and duplicate
+		//						policy of the applying object with those of other. Neither list is
+		//						copied.
+		//Pre:					List has been instantiated. other exists.
+		//Post:					The applying object holds what other held and other holds what the
+		//						applying object held.
+		//Classification:		Mutator
+		//Order of Magnitude:	O(1)
+
+
+		void Reserve(/* in */ int capacity);	// # of items the list must be able to hold
+		//Purpose:				Grows the list so that it can hold at least capacity items without
+		//						expanding. Does nothing if the list is already that large.
+		//Pre:					List has been instantiated.
+		//Post:					size >= capacity. The items in the list are unchanged.
+		//Classification:		Mutator
+		//Order of Magnitude:	O(N) worst case, where N is the length of the list; O(1) when realloc
+		//						can grow the list in place
+		//Exceptions Thrown:	OutOfMemoryException
+
+
+		void ShrinkToFit();
+		//Purpose:				Shrinks the list so that its size equals its length (or 1 if the list
+		//						is empty). The list may still grow again on a later Insert.
+		//Pre:					List has been instantiated.
+		//Post:					size equals the greater of length and 1. The items in the list are
+		//						unchanged.
+		//Classification:		Mutator
+		//Order of Magnitude:	O(N) worst case, where N is the length of the list
+		//Exceptions Thrown:	OutOfMemoryException
+
+
+		int GetCapacity() const;
+		//Purpose:				Returns the number of items the list can hold before it must expand.
 		//Pre:					List has been instantiated.
-		//Post:					List has been cleared(returned to its original empty state). size equals
-		//						MAX_ENTRIES. length equals EMPTY. currPos equals FIRST_POSITION.
+		//Post:					size has been returned.
+		//Classification:		Observer / Accessor
+		//Order of Magnitude:	O(1)
+
+
+		void SetCapacityPolicy(/* in */ const CapacityPolicy& newPolicy);	// Policy to use
+		//Purpose:				Sets the policy used to grow and shrink the list. The current size of the
+		//						list is not changed until the next Expand or Contract.
+		//Pre:					List has been instantiated. IsValidPolicy(newPolicy) is true.
+		//Post:					The list grows and shrinks according to newPolicy.
 		//Classification:		Mutator
 		//Order of Magnitude:	O(1)
+		//Exceptions Thrown:	InvalidCapacityPolicyException
+
+
+		CapacityPolicy GetCapacityPolicy() const;
+		//Purpose:				Returns the policy used to grow and shrink the list.
+		//Pre:					List has been instantiated.
+		//Post:					A copy of the list's CapacityPolicy has been returned.
+		//Classification:		Observer / Accessor
+		//Order of Magnitude:	O(1)
+
+
+		int GetCount() const;
+		//Purpose:				Returns the number of times the key at currPos has been inserted and not
+		//						yet deleted. In REJECT_DUPLICATES mode this is always 1.
+		//Pre:					List has been instantiated.
+		//Post:					The count of the item at currPos has been returned, or 0 if currPos
+		//						equals length.
+		//Classification:		Observer / Accessor
+		//Order of Magnitude:	O(1)
+
+
+		void SetDuplicatePolicy(/* in */ DuplicatePolicy newDuplicates);	// How duplicate keys are
+																			//  handled
+		//Purpose:				Sets how the list handles duplicate keys. Switching to COUNT_DUPLICATES
+		//						gives every key a count of 1; switching to REJECT_DUPLICATES drops the
+		//						counts, keeping one copy of each key.
+		//Pre:					List has been instantiated.
+		//Post:					The list handles duplicate keys according to newDuplicates.
+		//Classification:		Mutator
+		//Order of Magnitude:	O(N) when switching to COUNT_DUPLICATES, where N is the size of the list;
+		//						O(1) otherwise
+		//Exceptions Thrown:	OutOfMemoryException
+
+
+		DuplicatePolicy GetDuplicatePolicy() const;
+		//Purpose:				Returns how the list handles duplicate keys.
+		//Pre:					List has been instantiated.
+		//Post:					The list's DuplicatePolicy has been returned.
+		//Classification:		Observer / Accessor
+		//Order of Magnitude:	O(1)
+
+
+		pmr::memory_resource* GetMemoryResource() const;
+		//Purpose:				Returns the memory resource the list allocates its items from.
+		//Pre:					List has been instantiated.
+		//Post:					The list's memory resource has been returned, or NULL if the list
+		//						allocates from the heap.
+		//Classification:		Observer / Accessor
+		//Order of Magnitude:	O(1)
+
+
+		const_iterator begin() const;
+		//Purpose:				Returns an iterator to the first (highest) item of the list. The iterator
+		//						is a pointer into the list, so it is contiguous and random-access, and
+		//						using it never changes currPos. It is only valid until the list is next
+		//						changed.
+		//Pre:					List has been instantiated.
+		//Post:					A pointer to the first item has been returned.
+		//Classification:		Observer / Accessor
+		//Order of Magnitude:	O(1)
+
+
+		const_iterator end() const;
+		//Purpose:				Returns an iterator one past the last item of the list.
+		//Pre:					List has been instantiated.
+		//Post:					A pointer one past the last item has been returned.
+		//Classification:		Observer / Accessor
+		//Order of Magnitude:	O(1)
+
+
+		const_iterator cbegin() const;
+		//Purpose:				Returns begin().
+		//Pre:					List has been instantiated.
+		//Post:					A pointer to the first item has been returned.
+		//Classification:		Observer / Accessor
+		//Order of Magnitude:	O(1)
+
+
+		const_iterator cend() const;
+		//Purpose:				Returns end().
+		//Pre:					List has been instantiated.
+		//Post:					A pointer one past the last item has been returned.
+		//Classification:		Observer / Accessor
+		//Order of Magnitude:	O(1)
+
+
+		ItemSpan GetItems() const;
+		//Purpose:				Returns a read-only view of every item in the list, valid until the list
+		//						is next changed.
+		//Pre:					List has been instantiated.
+		//Post:					An ItemSpan over the whole list has been returned.
+		//Classification:		Observer / Accessor
+		//Order of Magnitude:	O(1)
+
+
+		const ItemType& At(/* in */ int position) const;	// The position of the item
+		//Purpose:				Returns the item at position without copying it. Unlike Retrieve,
+		//						currPos is neither used nor changed.
+		//Pre:					0 <= position < length
+		//Post:					A reference to the item at position has been returned. It is only valid
+		//						until the list is next changed.
+		//Classification:		Observer / Accessor
+		//Order of Magnitude:	O(1)
+
+
+		const ItemType& Current() const;
+		//Purpose:				Returns the item at currPos without copying it, as Retrieve does.
+		//Pre:					0 <= currPos < length
+		//Post:					A reference to the item at currPos has been returned. It is only valid
+		//						until the list is next changed.
+		//Classification:		Observer / Accessor
+		//Order of Magnitude:	O(1)
+
+
+		int LowerBound(/* in */ KeyType key) const;	// The key to bound
+		//Purpose:				Returns the position of the first item whose key is less than or equal
+		//						to key. Since the list is in descending order, this is where key is, or
+		//						where it would be inserted.
+		//Pre:					List has been instantiated.
+		//Post:					The position of the first item whose key <= key has been returned, or
+		//						length if there is none. currPos is unchanged.
+		//Classification:		Observer / Accessor
+		//Order of Magnitude:	O(logN)
+
+
+		int UpperBound(/* in */ KeyType key) const;	// The key to bound
+		//Purpose:				Returns the position of the first item whose key is less than key, which
+		//						is the position just after key if key is in the list.
+		//Pre:					List has been instantiated.
+		//Post:					The position of the first item whose key < key has been returned, or
+		//						length if there is none. currPos is unchanged.
+		//Classification:		Observer / Accessor
+		//Order of Magnitude:	O(logN)
+
+
+		bool FindFrom(/* in */ KeyType key);	// The key to search for
+		//Purpose:				Finds position of key within the OrdList, as Find does, but starting
+		//						from currPos: it gallops away from currPos toward key in steps of 1, 2,
+		//						4, ... until key is bracketed, then binary searches the bracket. A key
+		//						near the last one found is therefore found without searching the whole
+		//						list.
+		//Pre:					List has been instantiated.
+		//Post:					If key is found within the OrdList, true is returned and currPos is set
+		//						to the element's location in the list. If key is not found, false is
+		//						returned and currPos is set to the location where the record would have
+		//						appeared had it been in the list.
+		//Classification:		Mutator / Observer / Predicator
+		//Order of Magnitude:	O(log D), where D is the distance between currPos and the position found
+
+
+		int LookupSorted(/* in */ const KeyType keys[],		// The keys to search for
+						 /* in */ int count,				// # of keys
+						 /* out */ int positions[]) const;	// Gets the position of each key
+		//Purpose:				Finds the position of each of count keys. Each search gallops from where
+		//						the last one ended, as FindFrom does, so a set of keys sorted in either
+		//						direction is found in one sweep of the list.
+		//Pre:					List has been instantiated. positions has room for count positions.
+		//						The keys are fastest to find in descending or ascending order, but may be
+		//						in any order.
+		//Post:					positions[i] holds the position of keys[i] in the list, or NOT_FOUND if it
+		//						is not in the list. The number of keys found has been returned. currPos
+		//						is unchanged.
+		//Classification:		Observer / Accessor
+		//Order of Magnitude:	O(K log(N / K)) for K sorted keys, and O(K logN) worst case
+
+
+		int CountInRange(/* in */ KeyType lo,			// Smallest key in the range
+						 /* in */ KeyType hi) const;	// Key just above the range
+		//Purpose:				Returns the number of items whose keys are in [lo, hi). Each key is
+		//						counted once, however many times it has been inserted.
+		//Pre:					List has been instantiated.
+		//Post:					The number of items where lo <= key < hi has been returned. If hi <= lo,
+		//						0 has been returned.
+		//Classification:		Observer / Summarizer
+		//Order of Magnitude:	O(logN)
+
+
+		ItemSpan GetRange(/* in */ KeyType lo,			// Smallest key in the range
+						  /* in */ KeyType hi) const;	// Key just above the range
+		//Purpose:				Returns a view of the items whose keys are in [lo, hi). The items are not
+		//						copied; the view points into the list and is only valid until the list
+		//						is next changed.
+		//Pre:					List has been instantiated.
+		//Post:					An ItemSpan over the items where lo <= key < hi, highest key first, has
+		//						been returned. If hi <= lo, the span is empty.
+		//Classification:		Observer / Accessor
+		//Order of Magnitude:	O(logN)
+
+
+		int DeleteRange(/* in */ KeyType lo,	// Smallest key in the range
+						/* in */ KeyType hi);	// Key just above the range
+		//Purpose:				Deletes every item whose key is in [lo, hi), with all of its copies. The
+		//						items after the range are moved down once, and the list is contracted at
+		//						most once, straight to the size the capacity policy calls for at the new
+		//						length.
+		//Pre:					List has been instantiated.
+		//Post:					No item with lo <= key < hi remains in the list. currPos is the position
+		//						where the range was. The number of items deleted has been returned.
+		//Classification:		Mutator
+		//Order of Magnitude:	O(logN + M), where M is the number of items after the range
+		//Exceptions Thrown:	OutOfMemoryException
+
+
+		FrozenOrdListClass Freeze() const;
+		//Purpose:				Returns an immutable, compressed copy of the keys in the list (see
+		//						FrozenOrdList.h). The list itself is unchanged.
+		//Pre:					List has been instantiated. KeyType is a 4-byte integer type.
+		//Post:					A FrozenOrdListClass object holding the keys of the list has been
+		//						returned.
+		//Classification:		Observer / Accessor
+		//Order of Magnitude:	O(N), where N is the length of the list
+		//Exceptions Thrown:	OutOfMemoryException
+
+
+		void Save(/* in */ const string& fileName) const;	// The file to write
+		//Purpose:				Writes the list to fileName: a ListFileHeader followed by the items of the
+		//						list, stored contiguously (see ListFile.h). An existing file is replaced.
+		//						If the list counts duplicates, the count of each item is stored too.
+		//Pre:					List has been instantiated. ItemType is trivially copyable.
+		//Post:					fileName holds the list. The list is unchanged.
+		//Classification:		Observer / Accessor
+		//Order of Magnitude:	O(N), where N is the length of the list
+		//Exceptions Thrown:	ListFileException
+
+
+		void Open(/* in */ const string& fileName);	// The file to open
+		//Purpose:				Replaces the list with the one saved in fileName, verifying its checksum.
+		//						Calls Open(fileName, true).
+		//Pre:					List has been instantiated. ItemType is trivially copyable.
+		//Post:					See Open(const string& fileName, bool verify).
+		//Classification:		Mutator
+		//Order of Magnitude:	O(N), where N is the length of the saved list
+		//Exceptions Thrown:	ListFileException
+
+
+		void Open(/* in */ const string& fileName,	// The file to open
+				  /* in */ bool verify);				// True if the checksum should be checked
+		//Purpose:				Replaces the list with the one saved in fileName. The file is mapped into
+		//						memory read-only and the list points straight at the items in it, so no
+		//						item is read until it is used. The first method that changes the list
+		//						copies it into memory from AllocateList (copy-on-write) and unmaps the
+		//						file. Checking the checksum reads every item once; pass false to skip it
+		//						for files that are trusted.
+		//Pre:					List has been instantiated. ItemType is trivially copyable. fileName was
+		//						written by Save.
+		//Post:					The list holds the items saved in fileName. length and size equal the
+		//						number of items. currPos equals FIRST_POSITION. IsMapped() is true. If
+		//						the file holds duplicate counts, the list counts duplicates and has
+		//						them; otherwise a list that counts duplicates gives each key a count of
+		//						1. If an exception is thrown, the list is unchanged.
+		//Classification:		Mutator
+		//Order of Magnitude:	O(1) if verify is false; O(N) otherwise, where N is the length of the
+		//						saved list
+		//Exceptions Thrown:	ListFileException, OutOfMemoryException
+
+
+		bool IsMapped() const;
+		//Purpose:				Determines whether the list is still the read-only mapping of a file
+		//						opened by Open.
+		//Pre:					List has been instantiated.
+		//Post:					True has been returned if the list is mapped, false otherwise.
+		//Classification:		Observer / Predicator
+		//Order of Magnitude:	O(1)
 
 
 		//NOTE: This is the implementation of the PVF in the Base ListCLass
@@ -225,44 +757,72 @@ class OrdListClass : public ListClass	// Uses ListClass as template for further
 
 
 		virtual OrdListClass operator+(const OrdListClass& rtOp) const;	// List to merge with
-		//Purpose:				Merges lists (if duplicates encountered, only 1 ends up in list)
+		//Purpose:				Merges lists (if duplicates encountered, only 1 ends up in list). When
+		//						the lists hold PARALLEL_MERGE_THRESHOLD items or more between them and
+		//						more than one hardware thread is available, ParallelUnion merges them on
+		//						several threads; otherwise they are merged one item at a time.
 		//Pre:					List has been instantiated.
 		//Post:					An OrdListClass object has been returned whose keys are the keys found
 		//						in both the applying object's list and rtOp's list (there are no
 		//						duplicate keys).
 		//Classification:		Observer / Accessor / Summarizer
 		//Order of Magnitude:	O(N + M), where N is the length of the applying object's list and M is
-		//						the length of rtOp's list.
+		//						the length of rtOp's list. O((N + M) / P + P log(N + M)) with P threads.
+		//Exceptions Thrown:	OutOfMemoryException
 
 
-		virtual void operator=(const OrdListClass& orig);	// Object to aggregately assign
-		//Purpose:				Assigns orig to applying class object.
+		virtual OrdListClass& operator=(const OrdListClass& orig);	// Object to aggregately assign
+		//Purpose:				Assigns orig to applying class object. If the applying object's list is
+		//						large enough to hold orig's items, it is reused and no memory is
+		//						allocated. Otherwise a new list the size of orig's list is allocated.
+		//						The applying object takes orig's duplicate policy and counts.
 		//Pre:					List has been instantiated.
-		//Post:					orig has been aggregately assigned to the applying object.
+		//Post:					orig has been aggregately assigned to the applying object. A reference
+		//						to the applying object has been returned.
 		//Classification:		Mutator
-		//Order of Magnitude:	O(1)
+		//Order of Magnitude:	O(N), where N is the length of orig's list
 		//Exceptions Thrown:	OutOfMemoryException
 
 
+		const ItemType& operator[](/* in */ int position) const;	// The position of the item
+		//Purpose:				Returns the item at position without copying it or changing currPos.
+		//						The same as At(position).
+		//Pre:					0 <= position < length
+		//Post:					A reference to the item at position has been returned.
+		//Classification:		Observer / Accessor
+		//Order of Magnitude:	O(1)
+
+
+		OrdListClass& operator=(OrdListClass&& orig) noexcept;	// Object to take the list from
+		//Purpose:				Assigns orig to applying class object by exchanging lists with orig.
+		//						orig is left empty, holding the applying object's former list.
+		//Pre:					List has been instantiated.
+		//Post:					The applying object holds what orig held. orig is empty. A reference to
+		//						the applying object has been returned.
+		//Classification:		Mutator
+		//Order of Magnitude:	O(1)
+
+
 	protected: 
 		
 		virtual void Expand();
-		//Purpose:				Creates a new list twice the size of the original and copies the info
-		//						from the smaller list to the larger one.
+		//Purpose:				Grows the list by the policy's growthFactor (at least one item, and never
+		//						to less than minCapacity), keeping its items.
 		//Pre:					List is full and needs to be enlarged
-		//Post:					List size has been doubled.
+		//Post:					List size has been multiplied by growthFactor.
 		//Classification:		Mutator
-		//Order of Magnitude:	O(1)
+		//Order of Magnitude:	O(N) worst case, where N is the length of the list; O(1) when realloc
+		//						can grow the list in place
 		//Exceptions Thrown:	OutOfMemoryException
 
 		
 		virtual void Contract();
-		//Purpose:				Creates a new list half the size of the original and copies the info
-		//						from the old list to the new one.
-		//Pre:					List has less than 25% occupancy
-		//Post:					List size has been cut in half
+		//Purpose:				Shrinks the list by the policy's shrinkFactor, never to less than
+		//						minCapacity or length. Only the occupied part of the list is kept.
+		//Pre:					List occupancy is less than the policy's shrinkTrigger
+		//Post:					List size has been multiplied by shrinkFactor
 		//Classification:		Mutator
-		//Order of Magnitude:	O(1)
+		//Order of Magnitude:	O(N) worst case, where N is the length of the list
 		//Exceptions Thrown:	OutOfMemoryException
 
 	
@@ -274,10 +834,113 @@ class OrdListClass : public ListClass	// Uses ListClass as template for further
 		//Order of Magnitude:	O(1)
 
 
+		void Reallocate(/* in */ int newSize);	// The new size of the list
+		//Purpose:				Changes the size of the list to newSize, keeping its items. Trivially
+		//						copyable items on the heap are moved with realloc, so the list can grow
+		//						in place (glibc remaps the pages of large lists) instead of being
+		//						copied. A list with a memory resource is copied to a new block.
+		//Pre:					List has been instantiated. length <= newSize. newSize >= 1.
+		//Post:					size equals newSize. The items in the list are unchanged.
+		//Classification:		Mutator
+		//Order of Magnitude:	O(N) worst case, where N is the length of the list
+		//Exceptions Thrown:	OutOfMemoryException
+
+
+		ItemType* AllocateList(/* in */ int newSize);	// # of items to allocate memory for
+		//Purpose:				Allocates memory for a list of newSize items from the list's memory
+		//						resource, or from the heap if it has none. Every list owned by an
+		//						OrdListClass object is allocated here so that Reallocate and FreeList
+		//						can tell how it was allocated.
+		//Pre:					newSize >= 1
+		//Post:					A pointer to memory for newSize items has been returned.
+		//Classification:		Mutator
+		//Order of Magnitude:	O(1)
+		//Exceptions Thrown:	OutOfMemoryException
+
+
+		void FreeList(/* in */ ItemType* oldList,	// List to return to the heap
+					  /* in */ int oldSize);		// # of items oldList was allocated for
+		//Purpose:				Returns the memory of a list allocated by AllocateList back to the list's
+		//						memory resource, or to the heap if it has none.
+		//Pre:					oldList was returned by AllocateList or Reallocate of this list, for
+		//						oldSize items, or is NULL.
+		//Post:					The memory pointed to by oldList has been returned.
+		//Classification:		Mutator
+		//Order of Magnitude:	O(1)
+
+
+		void Promote();
+		//Purpose:				If the list is mapped from a file, copies it into memory from
+		//						AllocateList and unmaps the file, so that it can be changed. Every
+		//						method that writes to the items of the list calls Promote first.
+		//Pre:					List has been instantiated.
+		//Post:					IsMapped() is false. The items in the list are unchanged.
+		//Classification:		Mutator
+		//Order of Magnitude:	O(N) if the list was mapped, where N is the length of the list; O(1)
+		//						otherwise
+		//Exceptions Thrown:	OutOfMemoryException
+
+
+		void ReleaseList();
+		//Purpose:				Returns the list to the system: unmaps it if it is mapped from a file,
+		//						otherwise frees it with FreeList.
+		//Pre:					List has been instantiated.
+		//Post:					The list pointer is NULL. IsMapped() is false.
+		//Classification:		Mutator
+		//Order of Magnitude:	O(1)
+
+
+		void ResizeCounts(/* in */ int newSize);	// # of counts the array must hold
+		//Purpose:				Resizes the array of duplicate counts with realloc, keeping the counts of
+		//						the items in the list. The array is never smaller than the list, so
+		//						every method that moves items can move their counts the same way.
+		//Pre:					counts is not NULL, or is NULL and the counts are being created.
+		//Post:					counts holds at least newSize counts.
+		//Classification:		Mutator
+		//Order of Magnitude:	O(N) worst case, where N is newSize
+		//Exceptions Thrown:	OutOfMemoryException
+
+
  	private:
-		// maybe we need something here maybe not.. let me know, 
-		//BUT you may not add anything unless we agree upon it as a class. 
+
+		OrdListClass ParallelUnion(/* in */ const OrdListClass& rtOp,	// List to merge with
+								   /* in */ int numPartitions) const;	// # of threads to merge on
+		//Purpose:				Merges the applying object's list with rtOp's on numPartitions threads
+		//						(merge path). The merged order is cut into numPartitions equal pieces;
+		//						a binary search along each cut finds how many items of each list come
+		//						before it (co-ranking), so every thread merges its own slices of the two
+		//						lists independently. A first pass counts the keys each thread keeps
+		//						after dropping duplicates, including a duplicate split across a cut, and
+		//						a second pass writes them straight to their final positions in a result
+		//						sized once. A partition that no thread can be started for is merged on
+		//						the calling thread.
+		//Pre:					Both lists have been instantiated. numPartitions >= 1
+		//Post:					An OrdListClass object has been returned holding each key found in
+		//						either list once, in descending order.
+		//Classification:		Observer / Summarizer
+		//Order of Magnitude:	O((N + M) / P + P log(N + M)), where N and M are the lengths of the lists
+		//						and P is numPartitions
+		//Exceptions Thrown:	OutOfMemoryException
+
+
+		CapacityPolicy policy;	// How the list grows and shrinks
+		void* mapping;			// The mapped view of the file opened by Open, or NULL
+		size_t mappingBytes;	// # of bytes in the mapped view
+		DuplicatePolicy duplicates;	// How the list handles duplicate keys
+		int* counts;			// counts[i] is the # of copies of the item at position i, in
+								//  COUNT_DUPLICATES mode; NULL otherwise
+		pmr::memory_resource* resource;	// Where the items are allocated, or NULL for the heap
 
 }; //end OrdListClass 
 
+
+void swap(/* in/out */ OrdListClass& left,		// List to exchange with right
+		  /* in/out */ OrdListClass& right) noexcept;	// List to exchange with left
+//Purpose:				Exchanges the contents of left and right. Allows std::swap and the standard
+//						algorithms to exchange lists without copying them.
+//Pre:					left and right exist.
+//Post:					left holds what right held and right holds what left held.
+//Classification:		Mutator
+//Order of Magnitude:	O(1)
+
 #endif
\ No newline at end of file
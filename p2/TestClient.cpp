@@ -34,7 +34,30 @@ PROCESSING:
 	operator!=. list1 is also compared for equallity against list3 when list1 is empty and when it is
 	not empty using operator== and operator!=. list1 gets assigned the values 0-5 and list2 gets
 	assigned the values 3-8 and the intersection of those lists is assigned to list3. Finally, using
-	the same values for list1 and list2, the union is now assigned to list3.
+	the same values for list1 and list2, the union is now assigned to list3. list5 is instantiated by
+	taking over the union of list1 and list2, is moved into list4, is swapped back out of list4, and is
+	cleared once keeping its size and once returning it to MAX_ENTRIES. list4 reserves room for
+	MAX_INSERTS items, is shrunk to fit, and is given a capacity policy with no hysteresis, which must be
+	rejected. The keys inserted into list3 are also inserted into a TieredOrdListClass using each tier
+	policy, and a second tiered list is filled past several blocks and has every even key deleted before
+	its intersection and union with the first are printed. list4 is refilled with the keys 0 to
+	MAX_INSERTS - 1, its bounds and range counts are printed along with the keys in a range, and a range
+	of keys is deleted, contracting the list once. list3 and list4 are frozen, and the frozen copies are
+	printed, intersected, and searched for each key in RANGE. list3 is saved to a list file, which is
+	opened into list6 and compared against list3 before a key is inserted into list6, and opening a
+	file that does not exist must be rejected. A ConcurrentOrdListClass is filled by a batch insert,
+	and snapshots taken before and after deleting its even keys are printed side by side. list7 counts
+	duplicates: random keys are inserted into it with TryInsert, its keys are printed with their
+	counts, and one copy of its highest key is deleted. A duplicate is then given to TryInsert on list3,
+	which must reject it without throwing. list7 is saved to a list file and opened into list14, which
+	must take its counts. list3 is traversed with a range-based for, searched with
+	lower_bound and summed with accumulate through its iterators, and indexed with operator[] and At.
+	list8 and list9 are filled with even keys and multiples of 3, PARALLEL_MERGE_THRESHOLD keys between
+	them, so that their union is merged in parallel, and the union is checked for descending order.
+	list11 is allocated from a monotonic arena on the stack that cannot fall back to the heap, filled
+	with the keys of list3, and its union and intersection with list4 are built in the same arena.
+	Every key in RANGE is searched for in list3 with FindFrom, highest first, and then all at once with
+	LookupSorted, whose positions are printed (NOT_FOUND for a missing key).
 
 OUTPUT:
 	A prompt notifying the client when a test is starting and when the test has finished is printed to
@@ -58,6 +81,7 @@ EXCEPTION HANDLING:
 	DuplicateKeyException is caught whenever an item is attempted to be inserted into a list when the
 		key of the item is already in the list.
 	OutOfMemoryException is caught whenever an attempt to allocate dynamic memory fails.
+	ListFileException is caught when a list file cannot be opened.
 
 SUMMARY OF METHODS:
 	None.
@@ -67,7 +91,13 @@ SUMMARY OF METHODS:
 #include<iostream>		// For input/output
 #include<string>		// For string datatype
 #include<cstdlib>		// For exit
+#include<utility>		// For move
+#include<algorithm>		// For lower_bound
+#include<numeric>		// For accumulate
+#include<memory_resource>	// For pmr::monotonic_buffer_resource
 #include "OrdList.h"	// For OrdListClass objects
+#include "TieredOrdList.h"	// For TieredOrdListClass objects
+#include "ConcurrentOrdList.h"	// For ConcurrentOrdListClass objects
 using namespace std;
 
 // Constants
@@ -75,6 +105,10 @@ const int MAX_INSERTS = 20;	// Maximum # of inserts to test
 const int SEED = 123456789;	// Seed value for random # generator
 const int RANGE = 10;		// # of unique keys that can be inserted into a list
 
+// Function Prototypes
+bool KeyComesBefore(const ItemType& listItem, KeyType key);
+int AddKey(int sum, const ItemType& listItem);
+
 //BE SURE TO DOCUMENT THE TEST CLIENT FULLY, Design tests for each method independently , then integration test
 void main()
 {
@@ -749,6 +783,685 @@ void main()
 		system("pause");
 		system("cls");
 
+		//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+		// Testing OrdListClass(OrdListClass&&), operator=(OrdListClass&&), Swap(OrdListClass&) and
+		//  Clear(bool)
+
+		cout << "Testing OrdListClass(OrdListClass&&)..." << endl << endl;
+
+		// Instantiate list5 by taking over the union of list1 and list2
+		OrdListClass list5(list1 + list2);
+
+		cout << "List5 after taking over the union of list1 and list2:" << endl << endl;
+
+		// Print list5 and its PDMs
+		list5.Print();
+
+		cout << endl << "OrdListClass(OrdListClass&&) tested successfully." << endl;
+
+		system("pause");
+		system("cls");
+
+		cout << "Testing operator=(OrdListClass&&)..." << endl << endl;
+
+		// Move list5 into list4
+		list4 = std::move(list5);
+
+		cout << "List4 after moving list5 into it:" << endl << endl;
+
+		// Print list4 and its PDMs
+		list4.Print();
+
+		cout << endl << "List5 after being moved from:" << endl << endl;
+
+		// Print list5 and its PDMs
+		list5.Print();
+
+		cout << endl << "operator=(OrdListClass&&) tested successfully." << endl;
+
+		system("pause");
+		system("cls");
+
+		cout << "Testing Swap(OrdListClass&)..." << endl << endl;
+
+		// Exchange the contents of list4 and list5
+		list4.Swap(list5);
+
+		cout << "List4 after swapping with list5:" << endl << endl;
+
+		// Print list4 and its PDMs
+		list4.Print();
+
+		cout << endl << "List5 after swapping with list4:" << endl << endl;
+
+		// Print list5 and its PDMs
+		list5.Print();
+
+		cout << endl << "Swap(OrdListClass&) tested successfully." << endl;
+
+		system("pause");
+		system("cls");
+
+		cout << "Testing Clear(bool)..." << endl << endl;
+
+		// Clear list5 keeping its size
+		list5.Clear(false);
+
+		cout << "List5 after Clear(false):" << endl << endl;
+
+		// Print list5 and its PDMs
+		list5.Print();
+
+		// Clear list5 and return it to MAX_ENTRIES
+		list5.Clear(true);
+
+		cout << endl << "List5 after Clear(true):" << endl << endl;
+
+		// Print list5 and its PDMs
+		list5.Print();
+
+		cout << endl << "Clear(bool) tested successfully." << endl;
+
+		system("pause");
+		system("cls");
+
+		//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+		// Testing Reserve(int), ShrinkToFit() and SetCapacityPolicy(const CapacityPolicy&)
+
+		cout << "Testing Reserve(int) and ShrinkToFit()..." << endl << endl;
+
+		// Make room for MAX_INSERTS items in list4 up front
+		list4.Reserve(MAX_INSERTS);
+
+		cout << "List4 after Reserve(" << MAX_INSERTS << "):" << endl << endl;
+
+		// Print list4 and its PDMs
+		list4.Print();
+
+		// Shrink list4 to exactly its length
+		list4.ShrinkToFit();
+
+		cout << endl << "List4 after ShrinkToFit():" << endl << endl;
+
+		// Print list4 and its PDMs
+		list4.Print();
+
+		cout << endl << "Reserve(int) and ShrinkToFit() tested successfully." << endl;
+
+		system("pause");
+		system("cls");
+
+		cout << "Testing SetCapacityPolicy(const CapacityPolicy&)..." << endl << endl;
+
+		try
+		{
+			CapacityPolicy thrashing = DEFAULT_CAPACITY_POLICY;	// A policy with no hysteresis
+
+			// Shrink as soon as the list drops below half full, right where a doubled list starts
+			thrashing.shrinkTrigger = CONTRACTION_FACTOR;
+
+			// Try to give list4 the thrashing policy
+			list4.SetCapacityPolicy(thrashing);
+
+			cout << "SetCapacityPolicy(const CapacityPolicy&) does not work correctly." << endl;
+
+		} // End try
+		catch(InvalidCapacityPolicyException e)	// The policy was rejected
+		{
+			cout << e.GetMessage() << endl;
+
+		} // End catch(InvalidCapacityPolicyException e)
+
+		cout << endl << "SetCapacityPolicy(const CapacityPolicy&) tested successfully." << endl;
+
+		system("pause");
+		system("cls");
+
+		//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+		// Testing TieredOrdListClass<SqrtTierPolicy> and TieredOrdListClass<FixedTierPolicy<4> >
+
+		cout << "Testing TieredOrdListClass<SqrtTierPolicy>..." << endl << endl;
+
+		TieredOrdListClass<> tiered1, tiered2;	// Lists stored in blocks of about sqrt(N) items
+		TieredOrdListClass< FixedTierPolicy<4> > tiered3;	// List stored in blocks of 4 items
+
+		// Seed the random number generator
+		srand(SEED);
+
+		// Insert the same random keys into tiered1 and tiered3 that were inserted into list3
+		for(int i = 0; i < MAX_INSERTS; i++)
+		{
+			// Assign a random value to item.key
+			item.key = rand() % RANGE;
+
+			// If the key is not in tiered1 yet
+			if(!tiered1.Find(item.key))
+			{
+				tiered1.Insert(item);
+
+			} // End if
+
+			// If the key is not in tiered3 yet
+			if(!tiered3.Find(item.key))
+			{
+				tiered3.Insert(item);
+
+			} // End if
+
+		} // End for
+
+		cout << "Tiered1 (block size " << tiered1.GetBlockSize() << "):" << endl << endl;
+
+		// Print tiered1 and its PDMs
+		tiered1.Print();
+
+		// Insert the keys 0 to MAX_INSERTS - 1 into tiered2, forcing it to add blocks
+		for(int i = 0; i < MAX_INSERTS; i++)
+		{
+			item.key = (KeyType)i;
+
+			// If the key is not in tiered2 yet
+			if(!tiered2.Find(item.key))
+			{
+				tiered2.Insert(item);
+
+			} // End if
+
+		} // End for
+
+		cout << endl << "Tiered2 after inserting 0 to " << MAX_INSERTS - 1 << " (block size "
+			 << tiered2.GetBlockSize() << "):" << endl << endl;
+
+		// Print tiered2 and its PDMs
+		tiered2.Print();
+
+		// Delete every even key from tiered2, which carries items back across its blocks
+		for(int i = 0; i < MAX_INSERTS; i += 2)
+		{
+			// If the key is found in tiered2
+			if(tiered2.Find((KeyType)i))
+			{
+				tiered2.Delete();
+
+			} // End if
+
+		} // End for
+
+		cout << endl << "Tiered2 after deleting every even key:" << endl << endl;
+
+		// Print tiered2 and its PDMs
+		tiered2.Print();
+
+		cout << endl << "Tiered1 * Tiered2:" << endl << endl;
+
+		// Print the intersection of tiered1 and tiered2
+		(tiered1 * tiered2).Print();
+
+		cout << endl << "Tiered1 + Tiered2:" << endl << endl;
+
+		// Print the union of tiered1 and tiered2
+		(tiered1 + tiered2).Print();
+
+		cout << endl << "Tiered3 (block size " << tiered3.GetBlockSize() << "):" << endl << endl;
+
+		// Print tiered3 and its PDMs
+		tiered3.Print();
+
+		cout << endl << "TieredOrdListClass tested successfully." << endl;
+
+		system("pause");
+		system("cls");
+
+		//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+		// Testing LowerBound(KeyType), UpperBound(KeyType), CountInRange(KeyType, KeyType),
+		//  GetRange(KeyType, KeyType) and DeleteRange(KeyType, KeyType)
+
+		cout << "Testing range queries..." << endl << endl;
+
+		list4.Clear();
+
+		// Insert the keys 0 to MAX_INSERTS - 1 into list4
+		for(int i = 0; i < MAX_INSERTS; i++)
+		{
+			item.key = (KeyType)i;
+			list4.Find(item.key);
+			list4.Insert(item);
+
+		} // End for
+
+		// Print list4 and its PDMs
+		list4.Print();
+
+		cout << endl << "LowerBound(" << RANGE << "): " << list4.LowerBound(RANGE) << endl
+			 << "UpperBound(" << RANGE << "): " << list4.UpperBound(RANGE) << endl
+			 << "CountInRange(5, " << RANGE << "): " << list4.CountInRange(5, RANGE) << endl
+			 << "CountInRange(" << RANGE << ", 5): " << list4.CountInRange(RANGE, 5) << endl
+			 << endl << "Keys in GetRange(5, " << RANGE << "):";
+
+		// For each item in the range
+		for(const ItemType& rangeItem : list4.GetRange(5, RANGE))
+		{
+			cout << " " << rangeItem.key;
+
+		} // End for
+
+		cout << endl << endl << "DeleteRange(2, " << MAX_INSERTS - 2 << ") deleted "
+			 << list4.DeleteRange(2, MAX_INSERTS - 2) << " items:" << endl << endl;
+
+		// Print list4 and its PDMs
+		list4.Print();
+
+		cout << endl << "Range queries tested successfully." << endl;
+
+		system("pause");
+		system("cls");
+
+		//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+		// Testing Freeze() and FrozenOrdListClass
+
+		cout << "Testing Freeze()..." << endl << endl;
+
+		FrozenOrdListClass frozen3 = list3.Freeze();	// Compressed copy of list3's keys
+		FrozenOrdListClass frozen4 = list4.Freeze();	// Compressed copy of list4's keys
+
+		cout << "Frozen copy of List3:" << endl << endl;
+
+		// Print frozen3 and its size
+		frozen3.Print();
+
+		cout << endl << "Frozen copy of List4:" << endl << endl;
+
+		// Print frozen4 and its size
+		frozen4.Print();
+
+		cout << endl << "Frozen List3 * Frozen List4:" << endl << endl;
+
+		// Print the intersection of frozen3 and frozen4
+		(frozen3 * frozen4).Print();
+
+		cout << endl;
+
+		// For each key that could have been inserted into list3
+		for(int i = 0; i < RANGE; i++)
+		{
+			// If the frozen copy agrees with list3 about whether the key is in the list
+			if(frozen3.Find((KeyType)i) == list3.Find((KeyType)i))
+			{
+				cout << i << (frozen3.Find((KeyType)i) ? " was found in List3 and"
+													   : " was not found in List3 or")
+					 << " its frozen copy." << endl;
+
+			} // End if
+			// Else the frozen copy disagrees with list3
+			else
+			{
+				cout << "Find(KeyType) does not work correctly on the frozen copy." << endl;
+
+			} // End else
+
+		} // End for
+
+		cout << endl << "CountInRange(2, " << RANGE - 2 << ") on the frozen copy of List3: "
+			 << frozen3.CountInRange(2, RANGE - 2) << endl;
+
+		cout << endl << "Freeze() tested successfully." << endl;
+
+		system("pause");
+		system("cls");
+
+		//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+		// Testing Save(const string&) and Open(const string&)
+
+		cout << "Testing Save(const string&) and Open(const string&)..." << endl << endl;
+
+		// Write list3 to a list file
+		list3.Save("list3.dat");
+
+		OrdListClass list6;	// Maps the list file written from list3
+
+		// Map the list file into list6
+		list6.Open("list3.dat");
+
+		cout << "List6 after opening the file saved from List3 ("
+			 << (list6.IsMapped() ? "mapped" : "not mapped") << "):" << endl << endl;
+
+		// Print list6 and its PDMs
+		list6.Print();
+
+		cout << endl << "List6 " << ((list6 == list3) ? "==" : "!=") << " List3" << endl << endl;
+
+		// Insert a key that is not in list6, which copies it out of the file
+		item.key = RANGE;
+		list6.Find(item.key);
+		list6.Insert(item);
+
+		cout << "List6 after inserting " << item.key << " ("
+			 << (list6.IsMapped() ? "mapped" : "not mapped") << "):" << endl << endl;
+
+		// Print list6 and its PDMs
+		list6.Print();
+
+		cout << endl;
+
+		try
+		{
+			// Try to open a file that does not exist
+			list6.Open("missing.dat");
+
+			cout << "Open(const string&) does not work correctly." << endl;
+
+		} // End try
+		catch(ListFileException e)	// The file could not be opened
+		{
+			cout << e.GetMessage() << endl;
+
+		} // End catch(ListFileException e)
+
+		cout << endl << "Save(const string&) and Open(const string&) tested successfully." << endl;
+
+		system("pause");
+		system("cls");
+
+		//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+		// Testing ConcurrentOrdListClass
+
+		cout << "Testing ConcurrentOrdListClass..." << endl << endl;
+
+		ConcurrentOrdListClass sharedList;	// A list that can be searched while it is changed
+		ItemType batch[RANGE];				// Items inserted into sharedList in one batch
+
+		// Fill the batch with the keys RANGE - 1 down to 0
+		for(int i = 0; i < RANGE; i++)
+		{
+			batch[i].key = RANGE - 1 - i;
+
+		} // End for
+
+		cout << "InsertBatch inserted " << sharedList.InsertBatch(batch, RANGE) << " items." << endl;
+		cout << "InsertBatch inserted " << sharedList.InsertBatch(batch, RANGE)
+			 << " items the second time." << endl << endl;
+
+		ListSnapshot before = sharedList.GetSnapshot();	// The list before it is changed
+
+		// Delete the even keys and insert a new key
+		for(int i = 0; i < RANGE; i += 2)
+		{
+			sharedList.Delete((KeyType)i);
+
+		} // End for
+
+		item.key = RANGE;
+		sharedList.Insert(item);
+
+		ListSnapshot after = sharedList.GetSnapshot();	// The list after it is changed
+
+		cout << "Snapshot of version " << before.GetVersion() << ":";
+
+		// Print each key in the snapshot taken before the changes
+		for(const ItemType& snapshotItem : before)
+		{
+			cout << " " << snapshotItem.key;
+
+		} // End for
+
+		cout << endl << "Snapshot of version " << after.GetVersion() << ":";
+
+		// Print each key in the snapshot taken after the changes
+		for(const ItemType& snapshotItem : after)
+		{
+			cout << " " << snapshotItem.key;
+
+		} // End for
+
+		cout << endl << endl << "CountInRange(2, " << RANGE - 2 << ") is "
+			 << before.CountInRange(2, RANGE - 2) << " in the first snapshot and "
+			 << after.CountInRange(2, RANGE - 2) << " in the second." << endl;
+		cout << "GetLength is " << sharedList.GetLength() << ", with two snapshots held." << endl;
+
+		cout << endl << "ConcurrentOrdListClass tested successfully." << endl;
+
+		system("pause");
+		system("cls");
+
+		//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+		// Testing TryInsert(ItemType) and COUNT_DUPLICATES
+
+		cout << "Testing TryInsert(ItemType) and COUNT_DUPLICATES..." << endl << endl;
+
+		OrdListClass list7(COUNT_DUPLICATES);	// A list that counts duplicate keys
+
+		srand(SEED);
+
+		// Insert MAX_INSERTS random keys into list7, which keeps every duplicate as a count
+		for(int i = 0; i < MAX_INSERTS; i++)
+		{
+			item.key = rand() % RANGE;
+
+			list7.Find(item.key);
+
+			// If the key was already in list7
+			if(list7.TryInsert(item) == DUPLICATE_COUNTED)
+			{
+				cout << item.key << " was counted again." << endl;
+
+			} // End if
+			// Else the key was inserted
+			else
+			{
+				cout << item.key << " was inserted." << endl;
+
+			} // End else
+
+		} // End for
+
+		cout << endl << "Keys in List7 and their counts:";
+
+		// Print each key in list7 with its count
+		for(list7.FirstPosition(); !list7.EndOfList(); list7.NextPosition())
+		{
+			cout << " " << list7.Retrieve().key << "(" << list7.GetCount() << ")";
+
+		} // End for
+
+		// Delete one copy of the highest key
+		list7.FirstPosition();
+		list7.Delete();
+
+		cout << endl << endl << "After one Delete, the highest key has a count of " << list7.GetCount()
+			 << "." << endl;
+
+		// Try to insert the first key of list3 again; list3 rejects duplicates
+		list3.FirstPosition();
+		item = list3.Retrieve();
+		list3.Find(item.key);
+
+		cout << "TryInsert of " << item.key << " into List3 "
+			 << ((list3.TryInsert(item) == DUPLICATE_REJECTED) ? "was" : "was not")
+			 << " rejected without an exception." << endl;
+
+		// Save list7 and open it into a list that rejects duplicates, which takes the saved counts
+		list7.Save("list7.dat");
+
+		OrdListClass list14;	// Maps the list file written from list7
+
+		list14.Open("list7.dat");
+
+		cout << endl << "Keys in List14, opened from the file saved from List7, and their counts:";
+
+		// Print each key in list14 with its count
+		for(list14.FirstPosition(); !list14.EndOfList(); list14.NextPosition())
+		{
+			cout << " " << list14.Retrieve().key << "(" << list14.GetCount() << ")";
+
+		} // End for
+
+		cout << endl << endl << "List14 " << ((list14.GetDuplicatePolicy() == COUNT_DUPLICATES) ? "counts"
+			 : "does not count") << " duplicates." << endl;
+
+		cout << endl << "TryInsert(ItemType) and COUNT_DUPLICATES tested successfully." << endl;
+
+		system("pause");
+		system("cls");
+
+		//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+		// Testing begin(), end(), At(int) and operator[]
+
+		cout << "Testing begin(), end(), At(int) and operator[]..." << endl << endl;
+
+		cout << "Keys in List3 by range-based for:";
+
+		// Print each key in list3 without using its cursor
+		for(const ItemType& listItem : list3)
+		{
+			cout << " " << listItem.key;
+
+		} // End for
+
+		// Find where RANGE / 2 is, or would be, with the STL's binary search
+		index = int(lower_bound(list3.begin(), list3.end(), (KeyType)(RANGE / 2), KeyComesBefore)
+					- list3.begin());
+
+		cout << endl << endl << "lower_bound of " << RANGE / 2 << " in List3: " << index
+			 << " (LowerBound gives " << list3.LowerBound(RANGE / 2) << ")" << endl;
+
+		cout << "Sum of the keys in List3: "
+			 << accumulate(list3.begin(), list3.end(), 0, AddKey) << endl;
+
+		cout << "List3[0]: " << list3[0].key << ", List3.At(" << list3.GetLength() - 1 << "): "
+			 << list3.At(list3.GetLength() - 1).key << endl;
+
+		cout << endl << "begin(), end(), At(int) and operator[] tested successfully." << endl;
+
+		system("pause");
+		system("cls");
+
+		//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+		// Testing operator+ on large lists
+
+		cout << "Testing operator+ on large lists..." << endl << endl;
+
+		OrdListClass list8, list9;	// Large lists whose union is merged in parallel
+		bool inOrder = true;		// Gets false if the union is out of order
+
+		list8.Reserve(PARALLEL_MERGE_THRESHOLD / 2);
+		list9.Reserve(PARALLEL_MERGE_THRESHOLD / 2);
+
+		// Fill list8 with even keys and list9 with multiples of 3, highest first
+		for(index = PARALLEL_MERGE_THRESHOLD / 2 - 1; index >= 0; index--)
+		{
+			item.key = 2 * index;
+			list8.Find(item.key);
+			list8.Insert(item);
+
+			item.key = 3 * index;
+			list9.Find(item.key);
+			list9.Insert(item);
+
+		} // End for
+
+		OrdListClass list10(list8 + list9);	// The union of list8 and list9
+
+		// Check that every key of the union is lower than the one before it
+		for(index = 1; index < list10.GetLength(); index++)
+		{
+			if(list10[index].key >= list10[index - 1].key)
+			{
+				inOrder = false;
+
+			} // End if
+
+		} // End for
+
+		cout << "Length of List8: " << list8.GetLength() << ", length of List9: " << list9.GetLength()
+			 << endl << "Length of List8 + List9: " << list10.GetLength()
+			 << ", in descending order with no duplicates: " << (inOrder ? "yes" : "no") << endl;
+
+		cout << endl << "operator+ on large lists tested successfully." << endl;
+
+		system("pause");
+		system("cls");
+
+		//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+		// Testing OrdListClass(pmr::memory_resource*)
+
+		cout << "Testing OrdListClass(pmr::memory_resource*)..." << endl << endl;
+
+		{
+			char arenaBuffer[16384];	// The memory every list in the arena is allocated from
+			pmr::monotonic_buffer_resource arena(arenaBuffer, sizeof(arenaBuffer),
+												 pmr::null_memory_resource());
+				// An arena that never falls back to the heap, so running out of it throws
+
+			OrdListClass list11(&arena);	// A list allocated from arena
+
+			// Insert the keys of list3 into list11, growing it inside the arena
+			for(index = 0; index < list3.GetLength(); index++)
+			{
+				list11.Find(list3[index].key);
+				list11.Insert(list3[index]);
+
+			} // End for
+
+			OrdListClass list12(list11 + list4);	// Also allocated from arena
+			OrdListClass list13(list11 * list4);	// Also allocated from arena
+
+			cout << "List11, allocated from the arena:" << endl << endl;
+			list11.Print();
+
+			cout << endl << "Length of List11 + List4: " << list12.GetLength()
+				 << ", length of List11 * List4: " << list13.GetLength() << endl
+				 << "Results allocated from the arena: "
+				 << ((list12.GetMemoryResource() == &arena && list13.GetMemoryResource() == &arena) ?
+					 "yes" : "no") << endl;
+
+		} // The lists and then the arena are released here
+
+		cout << endl << "OrdListClass(pmr::memory_resource*) tested successfully." << endl;
+
+		system("pause");
+		system("cls");
+
+		//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+		// Testing FindFrom(KeyType) and LookupSorted(const KeyType[], int, int[])
+
+		cout << "Testing FindFrom(KeyType) and LookupSorted(const KeyType[], int, int[])..." << endl
+			 << endl;
+
+		{
+			KeyType probes[RANGE];		// Every key that can be in list3, highest first
+			int positions[RANGE];		// Gets the position of each probe in list3
+
+			list3.FirstPosition();
+
+			// Search list3 for each key, highest first, each search starting where the last ended
+			for(index = 0; index < RANGE; index++)
+			{
+				probes[index] = RANGE - 1 - index;
+
+				cout << "FindFrom(" << probes[index] << "): "
+					 << (list3.FindFrom(probes[index]) ? "found" : "not found") << endl;
+
+			} // End for
+
+			cout << endl << "LookupSorted found " << list3.LookupSorted(probes, RANGE, positions)
+				 << " of " << RANGE << " keys:";
+
+			for(index = 0; index < RANGE; index++)
+			{
+				cout << " " << positions[index];
+
+			} // End for
+
+			cout << endl;
+
+		}
+
+		cout << endl << "FindFrom(KeyType) and LookupSorted(const KeyType[], int, int[]) tested "
+			 << "successfully." << endl;
+
+		system("pause");
+		system("cls");
+
 		//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 		//	Integration Test
 
@@ -1023,4 +1736,28 @@ void main()
 
 	} // End catch(OutOfMemoryException e)
 
-} // End main()
\ No newline at end of file
+} // End main()
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+//Purpose:	Orders items the way an OrdListClass list does, for STL binary searches.
+//Pre:		None
+//Post:		True has been returned if listItem comes before key in a list (descending order).
+bool KeyComesBefore(/* in */ const ItemType& listItem,	// An item in the list
+					/* in */ KeyType key)				// The key being searched for
+{
+	return listItem.key > key;
+
+} // End KeyComesBefore(const ItemType& listItem, KeyType key)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+//Purpose:	Adds the key of listItem to sum, for accumulate.
+//Pre:		None
+//Post:		sum plus the key of listItem has been returned.
+int AddKey(/* in */ int sum,					// The sum so far
+		   /* in */ const ItemType& listItem)	// The item to add
+{
+	return sum + listItem.key;
+
+} // End AddKey(int sum, const ItemType& listItem)
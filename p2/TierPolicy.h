@@ -0,0 +1,73 @@
+/*
+AUTHOR:
+	Chris Pray
+
+DATE:
+	10/19/26
+
+FILENAME:
+	TierPolicy.h
+
+PURPOSE:
+	A tier policy is a struct that tells a TieredOrdListClass object how many items to store in each of
+	its blocks. It is passed to TieredOrdListClass as a template parameter and must provide one static
+	method:
+
+		static int BlockSizeFor(int length);
+			Returns the block size (a power of 2) that a list holding length items should use.
+
+	SqrtTierPolicy keeps the block size near the square root of the length of the list, which bounds
+	every Insert and Delete to O(sqrt N) item moves. FixedTierPolicy always uses BLOCK_SIZE items per
+	block, which suits lists whose length is known ahead of time.
+*/
+
+#ifndef TierPolicy_h
+#define TierPolicy_h
+
+#include "ABCListClass.h"	// For MAX_ENTRIES
+
+const int MIN_BLOCK_SIZE = MAX_ENTRIES;	// Smallest block a tier policy may choose (a power of 2)
+
+struct SqrtTierPolicy
+{
+	//Purpose:	Returns the smallest power of 2, no less than MIN_BLOCK_SIZE, whose square is at least
+	//			length, so that the number of blocks and the size of each block both stay near sqrt(N).
+	//Pre:		length >= 0
+	//Post:		The block size for a list of length items has been returned.
+	static int BlockSizeFor(/* in */ int length)	// # of items the list holds
+	{
+		int blockSize = MIN_BLOCK_SIZE;	// Gets the block size for length items
+
+		// While blocks of blockSize items would need more than blockSize blocks
+		while(blockSize * blockSize < length)
+		{
+			blockSize *= 2;
+
+		} // End while
+
+		return blockSize;
+
+	} // End BlockSizeFor(int length)
+
+}; // End SqrtTierPolicy
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+template <int BLOCK_SIZE>
+struct FixedTierPolicy
+{
+	static_assert(BLOCK_SIZE > 0 && (BLOCK_SIZE & (BLOCK_SIZE - 1)) == 0,
+				  "FixedTierPolicy: BLOCK_SIZE must be a power of 2");
+
+	//Purpose:	Returns BLOCK_SIZE regardless of length.
+	//Pre:		None
+	//Post:		BLOCK_SIZE has been returned.
+	static int BlockSizeFor(/* in */ int /*length*/)	// # of items the list holds (unused)
+	{
+		return BLOCK_SIZE;
+
+	} // End BlockSizeFor(int length)
+
+}; // End FixedTierPolicy
+
+#endif
\ No newline at end of file
@@ -0,0 +1,786 @@
+/*
+AUTHOR:
+	Chris Pray
+
+DATE:
+	10/19/26
+
+FILENAME:
+	TieredOrdList.cpp
+
+PURPOSE:
+	This file contains the implementation for all of the methods declared in TieredOrdList.h
+*/
+
+#pragma once
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Implementation of Constructors/Destructors
+
+template <class TierPolicy>
+TieredOrdListClass<TierPolicy>::TieredOrdListClass()
+{
+	// Return the list allocated by ListClass() back to the heap; the items are kept in blocks instead
+	delete [] GetListPtr();
+	SetListPtr(NULL);
+
+	tiers = NULL;
+	numBlocks = EMPTY;
+	maxBlocks = EMPTY;
+
+	// Allocate a single block of the policy's initial block size
+	Retier(*this, TierPolicy::BlockSizeFor(EMPTY));
+
+} // End TieredOrdListClass()
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+template <class TierPolicy>
+TieredOrdListClass<TierPolicy>::~TieredOrdListClass()
+{
+	// Return every block and the block directory to the heap
+	FreeTiers();
+
+} // End ~TieredOrdListClass()
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+template <class TierPolicy>
+TieredOrdListClass<TierPolicy>::TieredOrdListClass
+	(const TieredOrdListClass<TierPolicy>& orig)	// The original list
+{
+	// Return the list allocated by ListClass() back to the heap; the items are kept in blocks instead
+	delete [] GetListPtr();
+	SetListPtr(NULL);
+
+	tiers = NULL;
+	numBlocks = EMPTY;
+	maxBlocks = EMPTY;
+
+	// Store a deep copy of orig in the applying object
+	operator=(orig);
+
+} // End TieredOrdListClass(const TieredOrdListClass<TierPolicy>& orig)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Implementation of Methods that were Overridden
+
+template <class TierPolicy>
+void TieredOrdListClass<TierPolicy>::NextPosition()
+{
+	// If the current position in the list is less than the length of the list
+	if(GetCurrPos() < GetLength())
+	{
+		// Increment the current position in the list by one
+		SetCurrPos(GetCurrPos() + 1);
+
+	} // End if
+
+} // End NextPosition()
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+template <class TierPolicy>
+bool TieredOrdListClass<TierPolicy>::Find(/* in */ KeyType key)	// The key to search for
+{
+	int mid;								// The position of the item in the list whose key is
+											//  compared with key
+	int first = 0;							// The position of the first item in the section of the list
+											//  being searched
+	int last = GetLength() - 1;				// The position of the last item in the section of the list
+											//  being searched
+	bool found = false;						// Gets true if an item in the list whose key equals key has
+											//  been found, false otherwise
+
+	// Until the section being searched is empty, key would be inserted at first
+	SetCurrPos(first);
+
+	// While there are more items in the list to search and there has not been an item in the list whose
+	//  key equals key found
+	while(first <= last && !found)
+	{
+		// Calculate mid
+		mid = (first + last) / 2;
+
+		// If key is less than the key of the item in the list at position mid
+		if(key < At(mid).key)
+		{
+			// Search the items after mid
+			first = mid + 1;
+
+			SetCurrPos(first);
+
+		} // End if
+		// Else if key is greater than the key of the item in the list at position mid
+		else if(key > At(mid).key)
+		{
+			// Search the items before mid
+			last = mid - 1;
+
+		} // End else if
+		// Else key is equal to the key of the item in the list at position mid
+		else
+		{
+			// The key was found
+			found = true;
+
+			// Set the current position in the list to mid
+			SetCurrPos(mid);
+
+		} // End else
+
+	} // End while
+
+	return found;
+
+} // End Find(KeyType key)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+template <class TierPolicy>
+void TieredOrdListClass<TierPolicy>::Insert(/* in */ ItemType target)	// The target to insert
+{
+	int position = GetCurrPos();	// The position to insert target at
+	int block;						// The block target goes into
+	int lastBlock;					// The block that receives the new last item of the list
+	int mask;						// Block size - 1; maps an index onto a block's circular buffer
+
+	// If target is already in the list
+	if(position < GetLength() && At(position).key == target.key)
+	{
+		throw DuplicateKeyException(target.key,
+			"DuplicateKeyException: Attempt to insert a duplicate key failed.");
+
+	} // End if
+
+	// If every block is full
+	if(NoRoom())
+	{
+		// Add a block, or move the items into larger blocks
+		Expand();
+
+	} // End if
+
+	block = position >> blockShift;
+	lastBlock = GetLength() >> blockShift;
+	mask = GetBlockSize() - 1;
+
+	// Working back from the last block, carry the last item of each full block into the front of the
+	//  block after it, so that target's block has a free slot
+	for(int to = lastBlock; to > block; to--)
+	{
+		TierBlock& next = tiers[to];			// Block receiving the carried item
+		TierBlock& full = tiers[to - 1];		// Full block giving up its last item
+
+		next.head = (next.head - 1) & mask;
+		next.items[next.head] = full.items[(full.head + mask) & mask];
+
+	} // End for
+
+	// Insert target into its block; the block holds a full block less one item unless it is the last
+	ShiftIn(tiers[block], position & mask,
+			(block == lastBlock) ? GetLength() - (block << blockShift) : mask,
+			target);
+
+	// Increment the length of the list by one
+	SetLength(GetLength() + 1);
+
+} // End Insert(ItemType target)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+template <class TierPolicy>
+void TieredOrdListClass<TierPolicy>::Delete()
+{
+	// If the list is not empty
+	if(!IsEmpty())
+	{
+		int position = GetCurrPos();					// The position of the item to delete
+		int block = position >> blockShift;				// The block holding the item
+		int lastBlock = (GetLength() - 1) >> blockShift;	// The block holding the last item of the list
+		int mask = GetBlockSize() - 1;					// Maps an index onto a block's circular buffer
+
+		// Remove the item from its block
+		ShiftOut(tiers[block], position & mask,
+				 (block == lastBlock) ? GetLength() - (block << blockShift) : GetBlockSize());
+
+		// Carry the first item of each following block into the back of the block before it, so that
+		//  every block but the last is full again
+		for(int from = block + 1; from <= lastBlock; from++)
+		{
+			TierBlock& prev = tiers[from - 1];	// Block missing its last item
+			TierBlock& next = tiers[from];		// Block giving up its first item
+
+			prev.items[(prev.head + mask) & mask] = next.items[next.head];
+			next.head = (next.head + 1) & mask;
+
+		} // End for
+
+		// Decrement the length of the list by one
+		SetLength(GetLength() - 1);
+
+		// If two or more blocks' worth of room is unused, or the policy calls for blocks a quarter of
+		//  the current size or smaller
+		if(GetSize() - GetLength() >= 2 * GetBlockSize() ||
+		   TierPolicy::BlockSizeFor(GetLength()) * 4 <= GetBlockSize())
+		{
+			// Contract the list
+			Contract();
+
+		} // End if
+
+	} // End if
+
+} // End Delete()
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+template <class TierPolicy>
+ItemType TieredOrdListClass<TierPolicy>::Retrieve() const
+{
+	return At(GetCurrPos());
+
+} // End Retrieve()
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+template <class TierPolicy>
+void TieredOrdListClass<TierPolicy>::Clear()
+{
+	// Set the current position in the list to FIRST_POSITION
+	SetCurrPos(FIRST_POSITION);
+
+	// Set the length of the list to EMPTY
+	SetLength(EMPTY);
+
+	// Return the list to a single block of the policy's initial block size
+	Retier(*this, TierPolicy::BlockSizeFor(EMPTY));
+
+} // End Clear()
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+template <class TierPolicy>
+int TieredOrdListClass<TierPolicy>::GetCapacity() const
+{
+	return GetSize();
+
+} // End GetCapacity()
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+template <class TierPolicy>
+int TieredOrdListClass<TierPolicy>::GetBlockSize() const
+{
+	return 1 << blockShift;
+
+} // End GetBlockSize()
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Implementation of Operators that were Overloaded
+
+template <class TierPolicy>
+bool TieredOrdListClass<TierPolicy>::operator==
+	(const TieredOrdListClass<TierPolicy>& rtOp)const	// List to test equallity against
+{
+	bool isEqual = false;	// Gets true if the calling object is equal to rtOp, otherwise false
+
+	// If the length of the applying object's list is equal to the length of rtOp's list
+	if(GetLength() == rtOp.GetLength())
+	{
+		int index = FIRST_POSITION;	// The position in the list
+
+		isEqual = true;
+
+		// While the position in the list is within the bounds of the list and each key compared so far
+		//  is equal
+		while(index < GetLength() && isEqual)
+		{
+			// If the keys are not equal
+			if(!(At(index).key == rtOp.At(index).key))
+			{
+				isEqual = false;
+
+			} // End if
+
+			index++;
+
+		} // End while
+
+	} // End if
+
+	return isEqual;
+
+} // End operator== (const TieredOrdListClass<TierPolicy>& rtOp)const
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+template <class TierPolicy>
+bool TieredOrdListClass<TierPolicy>::operator!=
+	(const TieredOrdListClass<TierPolicy>& rtOp)const	// List to test equallity against
+{
+	return !operator==(rtOp);
+
+} // End operator!= (const TieredOrdListClass<TierPolicy>& rtOp)const
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+template <class TierPolicy>
+TieredOrdListClass<TierPolicy> TieredOrdListClass<TierPolicy>::operator*
+	(const TieredOrdListClass<TierPolicy>& rtOp)const	// List to intersect with
+{
+	TieredOrdListClass<TierPolicy> ordIntersection;	// Gets the intersection of the applying object's
+													//  list and rtOp's list
+	int left = FIRST_POSITION;						// The position in the applying object's list
+	int right = FIRST_POSITION;						// The position in rtOp's list
+
+	// While neither list has been walked to its end
+	while(left < GetLength() && right < rtOp.GetLength())
+	{
+		// If the key in the applying object's list is greater than the key in rtOp's list
+		if(At(left).key > rtOp.At(right).key)
+		{
+			left++;
+
+		} // End if
+		// Else if the key in the applying object's list is less than the key in rtOp's list
+		else if(At(left).key < rtOp.At(right).key)
+		{
+			right++;
+
+		} // End else if
+		// Else the keys are equal
+		else
+		{
+			// Append the item to ordIntersection, which stays in descending order
+			ordIntersection.Insert(At(left));
+
+			// Increment the current position of ordIntersection by one
+			ordIntersection.NextPosition();
+
+			left++;
+			right++;
+
+		} // End else
+
+	} // End while
+
+	return ordIntersection;
+
+} // End operator* (const TieredOrdListClass<TierPolicy>& rtOp)const
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+template <class TierPolicy>
+TieredOrdListClass<TierPolicy> TieredOrdListClass<TierPolicy>::operator+
+	(const TieredOrdListClass<TierPolicy>& rtOp)const	// List to merge with
+{
+	TieredOrdListClass<TierPolicy> ordUnion;	// Gets the union of the applying object's list and rtOp's
+												//  list
+	int left = FIRST_POSITION;					// The position in the applying object's list
+	int right = FIRST_POSITION;					// The position in rtOp's list
+
+	// While either list has items left to merge
+	while(left < GetLength() || right < rtOp.GetLength())
+	{
+		// If rtOp is exhausted or the key in the applying object's list is greater
+		if(right == rtOp.GetLength() ||
+		   (left < GetLength() && At(left).key > rtOp.At(right).key))
+		{
+			ordUnion.Insert(At(left));
+			left++;
+
+		} // End if
+		// Else if the applying object is exhausted or the key in rtOp's list is greater
+		else if(left == GetLength() || At(left).key < rtOp.At(right).key)
+		{
+			ordUnion.Insert(rtOp.At(right));
+			right++;
+
+		} // End else if
+		// Else the keys are equal, so only one ends up in ordUnion
+		else
+		{
+			ordUnion.Insert(At(left));
+			left++;
+			right++;
+
+		} // End else
+
+		// Increment the current position of ordUnion by one
+		ordUnion.NextPosition();
+
+	} // End while
+
+	return ordUnion;
+
+} // End operator+ (const TieredOrdListClass<TierPolicy>& rtOp)const
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+template <class TierPolicy>
+TieredOrdListClass<TierPolicy>& TieredOrdListClass<TierPolicy>::operator=
+	(const TieredOrdListClass<TierPolicy>& orig)	// Object to aggregately assign
+{
+	// If the applying object is not orig
+	if(this != &orig)
+	{
+		// Copy orig's items into blocks of orig's block size
+		Retier(orig, orig.GetBlockSize());
+
+		// Set the current position of the list to orig's current position
+		SetCurrPos(orig.GetCurrPos());
+
+	} // End if
+
+	return *this;
+
+} // End operator=(const TieredOrdListClass<TierPolicy>& orig)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Implementation of Protected Methods
+
+template <class TierPolicy>
+void TieredOrdListClass<TierPolicy>::Expand()
+{
+	int newBlockSize = TierPolicy::BlockSizeFor(GetLength() + 1);	// Block size for one more item
+
+	// If the policy calls for larger blocks
+	if(newBlockSize > GetBlockSize())
+	{
+		// Move the items into blocks of the new size
+		Retier(*this, newBlockSize);
+
+	} // End if
+
+	// If every block is still full
+	if(NoRoom())
+	{
+		AddBlock();
+
+	} // End if
+
+} // End Expand()
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+template <class TierPolicy>
+void TieredOrdListClass<TierPolicy>::Contract()
+{
+	int newBlockSize = TierPolicy::BlockSizeFor(GetLength());	// Block size for the current length
+
+	// If the policy calls for blocks a quarter of the current size or smaller
+	if(newBlockSize * 4 <= GetBlockSize())
+	{
+		// Move the items into blocks of the new size
+		Retier(*this, newBlockSize);
+
+	} // End if
+	// Else free the last block, which is empty
+	else if(numBlocks > 1)
+	{
+		numBlocks--;
+		delete [] tiers[numBlocks].items;
+		tiers[numBlocks].items = NULL;
+
+		SetSize(numBlocks << blockShift);
+
+	} // End else if
+
+} // End Contract()
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+template <class TierPolicy>
+bool TieredOrdListClass<TierPolicy>::NoRoom()
+{
+	return GetLength() == GetSize();
+
+} // End NoRoom()
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+template <class TierPolicy>
+ItemType& TieredOrdListClass<TierPolicy>::At(/* in */ int position) const	// Position of the item
+{
+	const TierBlock& block = tiers[position >> blockShift];	// The block holding the item
+
+	return block.items[(block.head + position) & (GetBlockSize() - 1)];
+
+} // End At(int position)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+template <class TierPolicy>
+void TieredOrdListClass<TierPolicy>::Retier
+	(/* in */ const TieredOrdListClass<TierPolicy>& source,	// List to take items from
+	 /* in */ int newBlockSize)								// Items in each new block
+{
+	int newShift = 0;				// log2 of newBlockSize
+	int newNumBlocks;				// # of blocks needed for source's items
+	int newMaxBlocks;				// # of blocks the new directory can hold
+	TierBlock* newTiers = NULL;		// The new block directory
+	int built = 0;					// # of new blocks allocated so far
+
+	// Calculate log2 of newBlockSize
+	while((1 << newShift) < newBlockSize)
+	{
+		newShift++;
+
+	} // End while
+
+	newNumBlocks = (source.GetLength() + newBlockSize - 1) >> newShift;
+
+	// Keep at least one block so that the list always has somewhere to insert
+	if(newNumBlocks < 1)
+	{
+		newNumBlocks = 1;
+
+	} // End if
+
+	newMaxBlocks = (newNumBlocks > MAX_ENTRIES) ? newNumBlocks : MAX_ENTRIES;
+
+	try
+	{
+		newTiers = new TierBlock[newMaxBlocks];
+
+		// Allocate each block
+		for(built = 0; built < newNumBlocks; built++)
+		{
+			newTiers[built].items = AllocateBlock(newBlockSize);
+			newTiers[built].head = 0;
+
+		} // End for
+
+	} // End try
+	catch(bad_alloc e)	// Failed to allocate the directory
+	{
+		throw OutOfMemoryException("OutOfMemoryException : Not enough memory to complete operation.");
+
+	} // End catch(bad_alloc e)
+	catch(OutOfMemoryException e)	// Failed to allocate a block
+	{
+		// Return the blocks allocated so far and the directory back to the heap
+		for(int i = 0; i < built; i++)
+		{
+			delete [] newTiers[i].items;
+
+		} // End for
+
+		delete [] newTiers;
+
+		throw;
+
+	} // End catch(OutOfMemoryException e)
+
+	// Copy source's items in order; every new block starts at index 0
+	for(int i = 0; i < source.GetLength(); i++)
+	{
+		newTiers[i >> newShift].items[i & (newBlockSize - 1)] = source.At(i);
+
+	} // End for
+
+	// Only now is it safe to free the old blocks, since source may be the applying object
+	SetLength(source.GetLength());
+	FreeTiers();
+
+	tiers = newTiers;
+	numBlocks = newNumBlocks;
+	maxBlocks = newMaxBlocks;
+	blockShift = newShift;
+
+	SetSize(numBlocks << blockShift);
+
+} // End Retier(const TieredOrdListClass<TierPolicy>& source, int newBlockSize)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+template <class TierPolicy>
+void TieredOrdListClass<TierPolicy>::AddBlock()
+{
+	// If the directory is full
+	if(numBlocks == maxBlocks)
+	{
+		TierBlock* newTiers;	// The larger directory
+
+		try
+		{
+			newTiers = new TierBlock[maxBlocks * EXPANSION_FACTOR];
+
+		} // End try
+		catch(bad_alloc e)	// Failed to allocate memory
+		{
+			throw OutOfMemoryException("OutOfMemoryException : Not enough memory to complete operation.");
+
+		} // End catch(bad_alloc e)
+
+		// Copy the block pointers; the blocks themselves are not moved
+		for(int i = 0; i < numBlocks; i++)
+		{
+			newTiers[i] = tiers[i];
+
+		} // End for
+
+		delete [] tiers;
+		tiers = newTiers;
+		maxBlocks *= EXPANSION_FACTOR;
+
+	} // End if
+
+	tiers[numBlocks].items = AllocateBlock(GetBlockSize());
+	tiers[numBlocks].head = 0;
+	numBlocks++;
+
+	SetSize(numBlocks << blockShift);
+
+} // End AddBlock()
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+template <class TierPolicy>
+void TieredOrdListClass<TierPolicy>::ShiftIn(/* in/out */ TierBlock& block,		// Block to insert into
+											 /* in */ int offset,				// Position within block
+											 /* in */ int count,				// # of items in block
+											 /* in */ const ItemType& target)	// The item to insert
+{
+	int mask = GetBlockSize() - 1;	// Maps an index onto the block's circular buffer
+
+	// If fewer items precede offset than follow it
+	if(offset < count - offset)
+	{
+		// Open the slot before head and move the preceding items toward the front
+		block.head = (block.head - 1) & mask;
+
+		for(int i = 0; i < offset; i++)
+		{
+			block.items[(block.head + i) & mask] = block.items[(block.head + i + 1) & mask];
+
+		} // End for
+
+	} // End if
+	// Else move the items from offset on toward the back
+	else
+	{
+		for(int i = count; i > offset; i--)
+		{
+			block.items[(block.head + i) & mask] = block.items[(block.head + i - 1) & mask];
+
+		} // End for
+
+	} // End else
+
+	block.items[(block.head + offset) & mask] = target;
+
+} // End ShiftIn(TierBlock& block, int offset, int count, const ItemType& target)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+template <class TierPolicy>
+void TieredOrdListClass<TierPolicy>::ShiftOut(/* in/out */ TierBlock& block,	// Block to delete from
+											  /* in */ int offset,				// Position within block
+											  /* in */ int count)				// # of items in block
+{
+	int mask = GetBlockSize() - 1;	// Maps an index onto the block's circular buffer
+
+	// If fewer items precede offset than follow it
+	if(offset < count - 1 - offset)
+	{
+		// Move the preceding items toward the back and advance head past the freed slot
+		for(int i = offset; i > 0; i--)
+		{
+			block.items[(block.head + i) & mask] = block.items[(block.head + i - 1) & mask];
+
+		} // End for
+
+		block.head = (block.head + 1) & mask;
+
+	} // End if
+	// Else move the following items toward the front
+	else
+	{
+		for(int i = offset; i < count - 1; i++)
+		{
+			block.items[(block.head + i) & mask] = block.items[(block.head + i + 1) & mask];
+
+		} // End for
+
+	} // End else
+
+} // End ShiftOut(TierBlock& block, int offset, int count)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+template <class TierPolicy>
+void TieredOrdListClass<TierPolicy>::FreeTiers()
+{
+	// For each block in use
+	for(int i = 0; i < numBlocks; i++)
+	{
+		delete [] tiers[i].items;
+
+	} // End for
+
+	delete [] tiers;
+
+	tiers = NULL;
+	numBlocks = EMPTY;
+	maxBlocks = EMPTY;
+
+} // End FreeTiers()
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+template <class TierPolicy>
+ItemType* TieredOrdListClass<TierPolicy>::AllocateBlock(/* in */ int newBlockSize)	// # of items
+{
+	ItemType* newBlock = NULL;	// Points to the allocated block
+
+	try
+	{
+		newBlock = new ItemType[newBlockSize];
+
+	} // End try
+	catch(bad_alloc e)	// Failed to allocate memory
+	{
+		throw OutOfMemoryException("OutOfMemoryException : Not enough memory to complete operation.");
+
+	} // End catch(bad_alloc e)
+
+	return newBlock;
+
+} // End AllocateBlock(int newBlockSize)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Implementation of PVF's
+
+template <class TierPolicy>
+void TieredOrdListClass<TierPolicy>::Print()
+{
+	// If the list is not empty
+	if(!IsEmpty())
+	{
+		// For each item in the list
+		for(int i = 0; i < GetLength(); i++)
+		{
+			cout << "Index " << i << ": " << At(i).key << endl;
+
+		} // End for
+
+	} // End if
+	// Else the list is empty
+	else
+	{
+		cout << "The list is empty." << endl;
+
+	} // End else
+
+	cout << "Current position: " << GetCurrPos() << endl
+		 << "Length: " << GetLength() << endl
+		 << "Size: " << GetSize() << endl;
+
+} // End Print()
@@ -0,0 +1,441 @@
+//FileName:			TieredOrdList.h
+//Author:			Chris Pray
+//Date:				10/19/26
+//Project:			OrdList
+//
+//Purpose: This file contains the specification for a class template for an ordered list(descending)
+//   that stores its items in a tiered vector instead of one contiguous array. It inherits basic
+//	 properties and actions from the abstract base ListClass and offers the same interface as
+//	 OrdListClass. Duplicates are not allowed to be inserted into the list.
+//
+//   The items are kept in blocks of blockSize items, where blockSize is a power of 2 chosen by the
+//   parameterized type, TierPolicy (see TierPolicy.h). Every block except the last is full. Each block
+//   is a circular buffer with its own head, so an Insert or Delete shifts items within one block and
+//   then carries a single item across each of the blocks that follow it. With SqrtTierPolicy, both the
+//   block size and the number of blocks stay near sqrt(N), so Insert and Delete move O(sqrt N) items
+//   instead of the O(N) moved by OrdListClass. The item at any position is found in O(1), so Find
+//   remains a binary search.
+//
+//                         SUMMARY OF METHODS
+//
+//The following constructors/destructors are utilized to perform basic functions for a class which uses
+//dynamic memory allocation:
+//
+//	TieredOrdListClass();
+//		Instantiates an empty TieredOrdListClass object with one block.
+//	~TieredOrdListClass();
+//		Deallocates memory from a TieredOrdListClass object
+//	TieredOrdListClass(const TieredOrdListClass<TierPolicy>& orig);
+//		Instantiates a deep copy of orig.
+//
+//To provide the ability to order the list, the following functions must be OVERIDDEN:
+//
+//	bool Find(KeyType key);
+//		Finds position of key within the list.
+//	void Insert(ItemType target);
+//		Inserts target into the list at position specified by PDM currPos.
+//	void Delete();
+//		Deletes list element specified by currPos.
+//
+//The following public methods have been added to the class to provide additional functionality:
+//
+//	void NextPosition();
+//		Sets currPos to next element in list
+//	ItemType Retrieve() const;
+//		Returns a copy of the item specified by currPos. Hides ListClass::Retrieve, which reads the
+//		contiguous list that this class does not use.
+//	void Clear();
+//		Clears the list and returns it to a single block of the policy's initial block size.
+//	int GetCapacity() const;
+//		Returns the number of items the list can hold before it must add a block.
+//	int GetBlockSize() const;
+//		Returns the number of items stored in each block.
+//
+//The following methods are also implemented as required by the Abstract Base Class:
+//
+//	void Print();
+//		Allows users to print the contents of their struct in an appropriate manner.
+//
+//The following operators have been overloaded to provided added functionality:
+//
+//	virtual bool operator==(const TieredOrdListClass<TierPolicy>& rtOp) const;
+//		Returns true if the keys of both lists are equal, false otherwise.
+//	virtual bool operator!=(const TieredOrdListClass<TierPolicy>& rtOp) const;
+//		Returns true if the keys of both lists are not equal, false otherwise.
+//	virtual TieredOrdListClass<TierPolicy> operator*(const TieredOrdListClass<TierPolicy>& rtOp) const;
+//		Joins/intersects the contents of rtOp with that of the applying object.
+//	virtual TieredOrdListClass<TierPolicy> operator+(const TieredOrdListClass<TierPolicy>& rtOp) const;
+//		Merges lists (if duplicates encountered, only 1 ends up in list)
+//	virtual TieredOrdListClass<TierPolicy>& operator=(const TieredOrdListClass<TierPolicy>& orig);
+//		Assigns orig to applying class object.
+//
+//The following protected methods have been added to allow expansion and contraction:
+//
+//	virtual void Expand();
+//		Adds a block to the list, or moves the items into larger blocks if the policy calls for them.
+//	virtual void Contract();
+//		Frees the last block of the list, or moves the items into smaller blocks if the policy calls
+//		for them.
+//	virtual bool NoRoom();
+//		Returns true if every block is full, false otherwise.
+//	ItemType& At(int position) const;
+//		Returns the item at position.
+//	void Retier(const TieredOrdListClass<TierPolicy>& source, int newBlockSize);
+//		Replaces the blocks of the list with blocks of newBlockSize items holding source's items.
+//	void AddBlock();
+//		Appends an empty block to the list.
+//	void ShiftIn(TierBlock& block, int offset, int count, const ItemType& target);
+//		Inserts target into a block at offset, moving the shorter side of the block.
+//	void ShiftOut(TierBlock& block, int offset, int count);
+//		Removes the item at offset from a block, moving the shorter side of the block.
+//	void FreeTiers();
+//		Returns every block and the block directory to the heap.
+//	static ItemType* AllocateBlock(int newBlockSize);
+//		Allocates memory for a block of newBlockSize items.
+//
+//ASSUMPTIONS:
+// (1): The definition of the struct ItemType will be supplied by the client in a file called ItemType.h
+// (2): Struct ItemType will contain as its first field a component named key which will be of KeyType.
+//       KeyType should be a typedef found in ItemType.H The component field key will be used to search
+//		 the list.
+// (3): TierPolicy provides static int BlockSizeFor(int length), returning a power of 2.
+// (4): The list is not used through a ListClass pointer or reference when Retrieve is called, since
+//		 ListClass::Retrieve is not virtual.
+//
+// TO ENSURE PROPER CLASS FUNCTION:
+// (5): On an INSERTION, method Find() must be called immediately before using Insert().
+// (6): On a DELETION, method Find() must be called before using Delete().
+//
+//Exception Handling:
+//	bad_alloc is caught in method AllocateBlock and in Retier and AddBlock if an attempt to allocate
+//		dynamic memory fails, and OutOfMemoryException is thrown in its place. Every method that adds or
+//		frees blocks can therefore throw OutOfMemoryException.
+//	DuplicateKeyException is thrown by Insert when target's key is already in the list.
+//
+
+
+#ifndef TieredOrdList_h
+#define TieredOrdList_h
+
+#include<iostream>			// For cout in Print()
+#include<cstddef>			// For NULL
+#include<new>				// For bad_alloc
+#include "ABCListClass.h"	// For base class, ListClass
+#include "TierPolicy.h"		// For SqrtTierPolicy and FixedTierPolicy
+#include "Exceptions.h"		// For custom exceptions, DuplicateKeyException and OutOfMemoryException
+using namespace std;
+using namespace nmspcExceptions;
+
+struct TierBlock
+{
+	ItemType* items;	// Points to the items in the block, stored as a circular buffer
+	int head;			// The index in items of the block's first item
+
+}; // End TierBlock
+
+// Class Declarations
+template <class TierPolicy = SqrtTierPolicy>
+class TieredOrdListClass : public ListClass	// Uses ListClass as template for further derivations
+{
+	public:
+
+		TieredOrdListClass();
+		//Purpose:				Instantiates an empty TieredOrdListClass object. Sets length and currPos
+		//						to zero. Allocates one block of TierPolicy::BlockSizeFor(EMPTY) items.
+		//Pre:					None
+		//Post:					An empty TieredOrdListClass object has been instantiated. size equals
+		//						the block size.
+		//Classification:		Default Constructor
+		//Order of Magnitude:	O(1)
+		//Exceptions Thrown:	OutOfMemoryException
+
+
+		~TieredOrdListClass();
+		//Purpose:				Deallocates memory from a TieredOrdListClass object
+		//Pre:					A TieredOrdListClass object exists
+		//Post:					Every block and the block directory have been returned to the heap
+		//Classification:		Destructor
+		//Order of Magnitude:	O(B), where B is the number of blocks
+
+
+		TieredOrdListClass(const TieredOrdListClass<TierPolicy>& orig);	// The original list
+		//Purpose:				Instantiates a deep copy of orig.
+		//Pre:					orig exists
+		//Post:					A deep copy of orig has been instantiated
+		//Classification:		Copy Constructor
+		//Order of Magnitude:	O(N), operator= is called, which is O(N), where N is the length of orig's
+		//						list
+
+
+		void NextPosition();
+		//Purpose:				Sets currPos to next element in list
+		//Pre:					List has been instantiated
+		//Post:					currPos is set to next element in list. currPos is bound between 0 and
+		//						length
+		//Classification:		Mutator
+		//Order of Magnitude:	O(1)
+
+
+		bool Find(/* in */ KeyType key);	// The key to search for
+		//Purpose:				Finds position of key within the list.
+		//Pre:					key contains a keyType value to search the list for.
+		//Post:					If key is found within the list, true is returned and currPos is set to
+		//						the element's location in the list. If target is not found, false is
+		//						returned and currPos is set to the location where the record would have
+		//						appeared had it been in the list.
+		//Classification:		Mutator / Observer / Predicator
+		//Order of Magnitude:	O(logN)
+
+
+		void Insert(/* in */ ItemType target);	// The target to insert
+		//Purpose:				Inserts target into the list at position specified by PDM currPos. The
+		//						shorter side of currPos's block is shifted to make room, and the last
+		//						item of each full block from there on is carried into the front of the
+		//						next block.
+		//Pre:					currPos contains location at which to insert new element, where
+		//						(0 <= currPos <= length).
+		//Post:					target has been inserted into the list at the location specified by
+		//						currPos. If every block was full prior to insertion, a block has been
+		//						added.
+		//Classification:		Mutator
+		//Order of Magnitude:	O(B + N/B), where B is the block size and N is the length of the list;
+		//						O(sqrt N) with SqrtTierPolicy
+		//Exceptions Thrown:	DuplicateKeyException, OutOfMemoryException
+
+
+		void Delete();
+		//Purpose:				Deletes list element specified by currPos. The shorter side of currPos's
+		//						block is shifted to close the gap, and the first item of each block from
+		//						there on is carried into the back of the block before it.
+		//Pre:					currPos contains the location of the element to be deleted, where
+		//						(O <= position < length).
+	    //Post:					The list element specified by currPos has been deleted from list. If two
+		//						or more blocks' worth of room is unused, or the policy calls for smaller
+		//						blocks, the list has been contracted.
+		//Classification:		Mutator
+		//Order of Magnitude:	O(B + N/B), where B is the block size and N is the length of the list;
+		//						O(sqrt N) with SqrtTierPolicy
+
+
+		ItemType Retrieve() const;
+		//Purpose:				Returns a copy of the item specified by currPos.
+		//Pre:					currPos contains a valid position in the list (0 <= currPos < length).
+		//Post:					A copy of the item at currPos has been returned.
+		//Classification:		Observer / Accessor
+		//Order of Magnitude:	O(1)
+
+
+		void Clear();
+		//Purpose:				Clears the list and returns it to a single block of
+		//						TierPolicy::BlockSizeFor(EMPTY) items.
+		//Pre:					List has been instantiated.
+		//Post:					List has been cleared. length equals EMPTY. currPos equals
+		//						FIRST_POSITION. size equals the initial block size.
+		//Classification:		Mutator
+		//Order of Magnitude:	O(B), where B is the number of blocks
+		//Exceptions Thrown:	OutOfMemoryException
+
+
+		int GetCapacity() const;
+		//Purpose:				Returns the number of items the list can hold before it must add a block.
+		//Pre:					List has been instantiated.
+		//Post:					size has been returned.
+		//Classification:		Observer / Accessor
+		//Order of Magnitude:	O(1)
+
+
+		int GetBlockSize() const;
+		//Purpose:				Returns the number of items stored in each block.
+		//Pre:					List has been instantiated.
+		//Post:					The block size has been returned.
+		//Classification:		Observer / Accessor
+		//Order of Magnitude:	O(1)
+
+
+		//NOTE: This is the implementation of the PVF in the Base ListCLass
+		void Print();
+		//Purpose:				Allows users to print the contents of their struct in an appropriate
+		//						manner.
+		//Pre:					List has been instantiated.
+		//Post:					The contents of the list(ItemType) have been printed.
+		//Classification:		Observer / Accessor
+		//Order of Magnitude:	O(N), where N is the length of the applying object's list
+
+
+		// Overloaded operators
+		virtual bool operator==(const TieredOrdListClass<TierPolicy>& rtOp)const;	// List to test against
+		//Purpose:				Tests the contents of rtOp with that of the applying object for
+		//						equality. Returns true if keys are equal, false otherwise.
+		//Pre:					List has been instantiated.
+		//Post:					True has been returned if the keys of the applying object are equal to
+		//						the keys of rtOp. Otherwise, false has been returned.
+		//Classification:		Observer / Summarizer
+		//Order of Magnitude:	O(N), where N is the length of the applying object's list.
+
+
+		virtual bool operator!=(const TieredOrdListClass<TierPolicy>& rtOp)const;	// List to test against
+		//Purpose:				Tests the contents of rtOp with that of the applying object for
+		//						equality. Returns true if keys are not equal, false otherwise.
+		//Pre:					List has been instantiated.
+		//Post:					True has been returned if the keys of the applying object are not equal
+		//						to the keys of rtOp. Otherwise, false has been returned.
+		//Classification:		Observer / Summarizer
+		//Order of Magnitude:	O(N), because operator!= calls operator==, which is O(N), where N is
+		//						the length of the applying object's list.
+
+
+		virtual TieredOrdListClass<TierPolicy> operator*
+			(const TieredOrdListClass<TierPolicy>& rtOp) const;	// List to intersect with
+		//Purpose:				Joins/intersects the contents of rtOp with that of the applying object
+		//						(only keys appearing in both will appear in the resultant list)
+		//Pre:					List has been instantiated.
+		//Post:					A TieredOrdListClass object has been returned whose keys are the keys
+		//						that appear in both the applying object's list and rtOp's list
+		//Classification:		Observer / Accessor / Summarizer
+		//Order of Magnitude:	O(N + M), where N is the length of the applying object's list and M is
+		//						the length of rtOp's list.
+
+
+		virtual TieredOrdListClass<TierPolicy> operator+
+			(const TieredOrdListClass<TierPolicy>& rtOp) const;	// List to merge with
+		//Purpose:				Merges lists (if duplicates encountered, only 1 ends up in list)
+		//Pre:					List has been instantiated.
+		//Post:					A TieredOrdListClass object has been returned whose keys are the keys
+		//						found in both the applying object's list and rtOp's list (there are no
+		//						duplicate keys).
+		//Classification:		Observer / Accessor / Summarizer
+		//Order of Magnitude:	O(N + M), where N is the length of the applying object's list and M is
+		//						the length of rtOp's list.
+
+
+		virtual TieredOrdListClass<TierPolicy>& operator=
+			(const TieredOrdListClass<TierPolicy>& orig);	// Object to aggregately assign
+		//Purpose:				Assigns orig to applying class object. The applying object gets blocks of
+		//						orig's block size.
+		//Pre:					List has been instantiated.
+		//Post:					orig has been aggregately assigned to the applying object. A reference
+		//						to the applying object has been returned.
+		//Classification:		Mutator
+		//Order of Magnitude:	O(N), where N is the length of orig's list
+		//Exceptions Thrown:	OutOfMemoryException
+
+
+	protected:
+
+		virtual void Expand();
+		//Purpose:				Makes room for one more item. If TierPolicy calls for larger blocks at
+		//						the new length, the items are moved into blocks of that size. Otherwise
+		//						an empty block is added.
+		//Pre:					Every block is full
+		//Post:					The list can hold at least one more item.
+		//Classification:		Mutator
+		//Order of Magnitude:	O(1) amortized; O(N) when the block size changes
+		//Exceptions Thrown:	OutOfMemoryException
+
+
+		virtual void Contract();
+		//Purpose:				If TierPolicy calls for blocks a quarter of the current size or smaller,
+		//						the items are moved into blocks of that size. Otherwise the last block
+		//						is returned to the heap.
+		//Pre:					Two or more blocks' worth of room is unused, or the policy's block size
+		//						for the current length is a quarter of the block size or less.
+		//Post:					The list holds fewer or smaller blocks.
+		//Classification:		Mutator
+		//Order of Magnitude:	O(1) amortized; O(N) when the block size changes
+		//Exceptions Thrown:	OutOfMemoryException
+
+
+		virtual bool NoRoom();
+		//Purpose:				Returns true if every block is full, false otherwise.
+		//Pre:					List has been instantiated.
+		//Post:					True is returned if list has no available locations, false otherwise.
+		//Classification:		Observer / Predicator
+		//Order of Magnitude:	O(1)
+
+
+		ItemType& At(/* in */ int position) const;	// Position of the item in the list
+		//Purpose:				Returns the item at position by locating its block and its index within
+		//						the block's circular buffer.
+		//Pre:					0 <= position < size
+		//Post:					A reference to the item at position has been returned.
+		//Classification:		Observer / Accessor
+		//Order of Magnitude:	O(1)
+
+
+		void Retier(/* in */ const TieredOrdListClass<TierPolicy>& source,	// List to take items from
+					/* in */ int newBlockSize);								// Items in each new block
+		//Purpose:				Replaces the blocks of the list with as many blocks of newBlockSize items
+		//						as source's items need (at least one), holding copies of source's items.
+		//						source may be the applying object.
+		//Pre:					newBlockSize is a power of 2.
+		//Post:					The list holds source's items in blocks of newBlockSize items. length
+		//						equals source's length. The former blocks have been returned to the heap.
+		//Classification:		Mutator
+		//Order of Magnitude:	O(N), where N is the length of source's list
+		//Exceptions Thrown:	OutOfMemoryException
+
+
+		void AddBlock();
+		//Purpose:				Appends an empty block to the list, doubling the block directory if it
+		//						is full.
+		//Pre:					List has been instantiated.
+		//Post:					The list holds one more block. size has grown by the block size.
+		//Classification:		Mutator
+		//Order of Magnitude:	O(1) amortized
+		//Exceptions Thrown:	OutOfMemoryException
+
+
+		void ShiftIn(/* in/out */ TierBlock& block,			// Block to insert into
+					 /* in */ int offset,					// Position of target within the block
+					 /* in */ int count,					// # of items in the block
+					 /* in */ const ItemType& target);		// The item to insert
+		//Purpose:				Inserts target into block at offset. If fewer items precede offset than
+		//						follow it, they are moved toward the front and head moves back one;
+		//						otherwise the items from offset on are moved toward the back.
+		//Pre:					0 <= offset <= count < block size
+		//Post:					block holds count + 1 items with target at offset.
+		//Classification:		Mutator
+		//Order of Magnitude:	O(B), where B is the block size
+
+
+		void ShiftOut(/* in/out */ TierBlock& block,	// Block to delete from
+					  /* in */ int offset,				// Position of the item within the block
+					  /* in */ int count);				// # of items in the block
+		//Purpose:				Removes the item at offset from block, moving whichever side of offset
+		//						holds fewer items.
+		//Pre:					0 <= offset < count <= block size
+		//Post:					block holds count - 1 items in the same order without the item that was
+		//						at offset.
+		//Classification:		Mutator
+		//Order of Magnitude:	O(B), where B is the block size
+
+
+		void FreeTiers();
+		//Purpose:				Returns every block and the block directory to the heap.
+		//Pre:					None
+		//Post:					tiers is NULL. numBlocks and maxBlocks equal EMPTY.
+		//Classification:		Mutator
+		//Order of Magnitude:	O(B), where B is the number of blocks
+
+
+		static ItemType* AllocateBlock(/* in */ int newBlockSize);	// # of items in the block
+		//Purpose:				Allocates memory for a block of newBlockSize items.
+		//Pre:					newBlockSize >= 1
+		//Post:					A pointer to memory for newBlockSize items has been returned.
+		//Classification:		Mutator
+		//Order of Magnitude:	O(1)
+		//Exceptions Thrown:	OutOfMemoryException
+
+
+ 	private:
+
+		TierBlock* tiers;	// The block directory; tiers[0] holds the first items in the list
+		int numBlocks;		// # of blocks in use
+		int maxBlocks;		// # of blocks the directory can hold
+		int blockShift;		// log2 of the block size; position >> blockShift is an item's block
+
+}; //end TieredOrdListClass
+
+#include "TieredOrdList.cpp"
+
+#endif
\ No newline at end of file
@@ -9,11 +9,14 @@ FILENAME:
 	MazeExceptions.h
 
 PURPOSE:
-	This file contains custom exception classes, RetrieveFromOutOfBoundsException and
-	OutOfMemoryException to be used with MazeClass objects. RetrieveFromOutOfBoundsException should be
-	thrown whenever an attempt to retrieve a MazePositionType from a location that's outside the bounds
-	of the maze is made. OutOfMemoryException should be thrown whenever an attempt to dynamically
-	allocate memory for the instantiation of a MazeClass object.
+	This file contains custom exception classes, RetrieveFromOutOfBoundsException,
+	OutOfMemoryException and MazeTooWideException to be used with MazeClass objects.
+	RetrieveFromOutOfBoundsException should be thrown whenever an attempt to retrieve a
+	MazePositionType from a location that's outside the bounds of the maze is made.
+	OutOfMemoryException should be thrown whenever an attempt to dynamically allocate memory for the
+	instantiation of a MazeClass object. MazeTooWideException should be thrown whenever a maze is too
+	wide, in both of its dimensions, for an operation that works across a whole row of the maze at
+	once.
 
 SUMMARY OF METHODS:
 	
@@ -28,6 +31,12 @@ SUMMARY OF METHODS:
 		exception is thrown.
 	OutOfMemoryException::GetMessage()
 		Returns PDM message which is set when the exception is thrown.
+
+	MazeTooWideException::MazeTooWideException(string newMessage)
+		Non-default constructor for a MazeTooWideException object. msg is a message passed when the
+		exception is thrown.
+	MazeTooWideException::GetMessage()
+		Returns PDM message which is set when the exception is thrown.
 */
 
 #ifndef MazeExceptions_h
@@ -118,6 +127,46 @@ namespace nmspcMazeExceptions
 
 	}; // End OutOfMemoryException
 
+	class MazeTooWideException
+	{
+		private:
+
+			string message;	// A message describing the exception
+
+		public:
+
+			/*
+			Purpose:			Instantiates a MazeTooWideException object with a custom message. PDM
+								message has been intitiallized to newMessage.
+			Pre:				None.
+			Post:				A MazeTooWideException object has been instantiated. PDM message has
+								been intitiallized to newMessage.
+			Classification:		Non-default Constructor
+			Order of Magnitude:	O(1)
+			*/
+			MazeTooWideException(/* In */ string newMessage)	// The message to initiallize PDM
+																//  message with
+			{
+				// Initiallize PDM message
+				message = newMessage;
+
+			} // End MazeTooWideException(string newMessage)
+
+			/*
+			Purpose:			Returns PDM message.
+			Pre:				A MazeTooWideException object has been instantiated.
+			Post:				PDM message has been returned.
+			Classification:		Observer / Accessor
+			Order of Magnitude:	O(1)
+			*/
+			string GetMessage()
+			{
+				return message;
+
+			} // End GetMessage()
+
+	}; // End MazeTooWideException
+
 } // End nmspcMazeExceptions
 
 #endif
\ No newline at end of file
@@ -13,6 +13,16 @@ PURPOSE:
 	which is defined in this file. A location can either be a wall or an unvisited or visited travelable
 	location. In addition, a MazePositionType contains boolean members - triedEast, triedSouth,
 	triedWest, and triedNorth - to allow a client to find a path through the maze.
+
+	Inside a MazeClass object, each location is packed into a single MazeCellType byte:
+
+		Bits 0-1	status (a PositionEnum)
+		Bit 2		tried east
+		Bit 3		tried south
+		Bit 4		tried west
+		Bit 5		tried north
+
+	so that one member of a location can be read or changed in place with a single mask.
 */
 
 #ifndef MazePositionType_h
@@ -30,4 +40,12 @@ struct MazePositionType
 
 }; // End MazePositionType
 
+typedef unsigned char MazeCellType;	// A location packed into one byte
+
+const MazeCellType STATUS_MASK = 0x03;	// The bits of a MazeCellType holding its status
+const MazeCellType TRIED_MASK = 0x3C;	// The bits of a MazeCellType recording the directions tried
+
+enum TriedEnum { TRIED_EAST = 0x04, TRIED_SOUTH = 0x08, TRIED_WEST = 0x10, TRIED_NORTH = 0x20 };
+	// The bit of a MazeCellType recording whether a direction has been tried
+
 #endif
\ No newline at end of file
@@ -0,0 +1,405 @@
+/*
+AUTHOR:
+	Chris Pray
+
+DATE:
+	10/19/26
+
+FILENAME:
+	bench.cpp
+
+PURPOSE:
+	This file measures the iterative solver, PathEnumeratorClass, on a corpus of maze files, such as
+	those written by generate.cpp, without any prompts, so that it can be run from a script. For each
+	maze it reports how fast the solver moved through the maze and found its solutions, and how much
+	memory it took to do so. p5's MazeBench.cpp measures the recursive solver the same way and
+	reports the same columns.
+
+INPUT:
+	The options and the names of the maze files are given on the command line:
+		bench [-t threads] [-c | -k] [-n solutions] [-s seconds] [-r seconds] [-o outFile] mazeFile...
+	-t sets the # of threads to search with; the default is one per core. -c writes the solutions in
+	compact form instead of as text, and -k only counts them. -n stops each search once that many
+	solutions have been found, and -s once it has run that many seconds, so that mazes with more
+	paths than can ever be written can still be measured. -r prints the counts of what each search
+	is doing to cerr every that many seconds, when built with SEARCH_STATS. -o writes the solutions
+	to outFile; otherwise they are formatted and thrown away, so that the disk is not measured. Each
+	maze file may be a text or a binary maze file.
+
+PROCESSING:
+	Each maze file is loaded with a MazeFileClass object, and a PathEnumeratorClass object finds every
+	valid path through it. The time taken to load the maze, and the time taken to prune and search
+	it, are measured separately with steady_clock. The replacement operator new and operator delete
+	in this file count every allocation made, and the bytes allocated at once, from which the # of
+	allocations and the peak heap use of each search are found. The peak resident set size of the
+	process, which never goes down, is read with getrusage.
+
+OUTPUT:
+	One line per maze is output to the console, under a line of headings:
+		maze		the name of the maze file
+		rows, cols	the dimensions of the maze
+		solutions	the # of valid paths found, up to the limits
+		nodes		the # of locations the search entered, counting the entrance, as MazeBench.cpp does;
+					the same on any # of threads
+		load s		seconds taken to load the maze
+		solve s		seconds taken to prune and search the maze
+		nodes/s		nodes divided by solve seconds
+		sol/s		solutions divided by solve seconds
+		allocs		the # of allocations made by the search
+		heap MB		the most heap memory the search held at once, above what was held before it
+		RSS MB		the peak resident set size of the process so far
+	A maze that cannot be loaded is reported and skipped.
+
+	When built with SEARCH_STATS defined, a JSON summary of what each search did, as described in
+	searchstats.h, is also output to cerr, one line per maze searched, in the order of the lines
+	above.
+
+ASSUMPTIONS:
+	(1) The maze files are in the formats MazeFileClass reads.
+	(2) Peak resident set size is only available where getrusage is; elsewhere 0 is reported.
+
+EXCEPTION HANDLING:
+	(1) nmspcMazeExceptions::OutOfMemoryException
+			Thrown on a failure to dynamically allocate memory when instantiating a MazeClass object, or
+			for a PathEnumeratorClass object or any of its threads. The maze is reported and skipped.
+	(2) nmspcStackExceptions::OutOfMemoryException
+			Thrown on a failure to dynamically allocate memory for a StackClass operation. The maze is
+			reported and skipped.
+*/
+
+// Header Files / Libraries
+#include "maze.h"			// For use of MazeClass objects
+#include "enumerator.h"		// For use of PathEnumeratorClass objects
+#include "mazefile.h"		// For use of MazeFileClass objects
+#include "solutionfile.h"	// For use of SolutionWriterClass objects
+#include<atomic>			// For atomic
+#include<chrono>			// For steady_clock
+#include<cstdlib>			// For malloc, free, atoi, atoll, atof, EXIT_SUCCESS and EXIT_FAILURE
+#include<cstring>			// For strcmp
+#include<fstream>			// For file output
+#include<iomanip>			// For setw and setprecision
+#include<iostream>			// For standard output
+#include<new>				// For bad_alloc
+#include<string>			// For string datatype
+#include<thread>			// For hardware_concurrency
+#ifndef _WIN32
+#include<sys/resource.h>	// For getrusage
+#endif
+using namespace std;
+
+// Constants
+const size_t ALLOCATION_HEADER = 16;	// # of bytes in front of each block, holding its size; keeps
+										//  the block aligned for any type
+const double BYTES_PER_MB = 1024.0 * 1024.0;	// # of bytes in a megabyte
+
+// Allocation counts, kept by the replacement operator new and operator delete
+static atomic<long long> numAllocations(0);		// # of allocations since the last reset
+static atomic<long long> liveBytes(0);			// # of bytes allocated and not yet freed
+static atomic<long long> peakBytes(0);			// Most bytes allocated at once since the last reset
+
+// Prototypes
+double PeakResidentMB();
+	// Returns the peak resident set size of the process, in megabytes.
+void BenchMaze(const string&, const int, const SolutionFormatEnum, const EnumerateLimitsType&,
+			   ofstream&);
+	// Loads, prunes and searches one maze, and outputs a line of measurements for it.
+
+
+//******************************************************************************************************
+// Replacement allocation functions
+
+/*
+Purpose:	Allocates size bytes, counting the allocation and the bytes.
+Pre:		None
+Post:		The address of a block of size bytes has been returned. numAllocations and liveBytes have
+			been increased, and peakBytes raised to liveBytes if it was lower.
+Exceptions:	bad_alloc
+*/
+void* operator new(/* In */ size_t size)	// # of bytes to allocate
+{
+	char* block = static_cast<char*>(malloc(size + ALLOCATION_HEADER));	// The block and its header
+	long long live;		// # of bytes allocated, counting this block
+	long long peak;		// The peak seen so far
+
+	if(block == NULL)
+	{
+		throw bad_alloc();
+
+	} // End if
+
+	// Record the size in front of the block, so that operator delete can count it out again
+	*reinterpret_cast<size_t*>(block) = size;
+
+	numAllocations++;
+	live = liveBytes += (long long)size;
+	peak = peakBytes;
+
+	while( live > peak && !peakBytes.compare_exchange_weak(peak, live) )
+	{
+	} // End while
+
+	return block + ALLOCATION_HEADER;
+
+} // End operator new(size_t size)
+
+//******************************************************************************************************
+
+/*
+Purpose:	Frees a block allocated by operator new, counting its bytes out.
+Pre:		block is NULL or was returned by operator new and has not been freed.
+Post:		The block has been freed and liveBytes decreased by its size.
+*/
+void operator delete(/* In */ void* block) noexcept	// The block to free
+{
+	char* start;	// The start of the block's header
+
+	if(block != NULL)
+	{
+		start = static_cast<char*>(block) - ALLOCATION_HEADER;
+		liveBytes -= (long long)*reinterpret_cast<size_t*>(start);
+		free(start);
+
+	} // End if
+
+} // End operator delete(void* block)
+
+//******************************************************************************************************
+
+void* operator new[](/* In */ size_t size)	// # of bytes to allocate
+{
+	return operator new(size);
+
+} // End operator new[](size_t size)
+
+void operator delete[](/* In */ void* block) noexcept	// The block to free
+{
+	operator delete(block);
+
+} // End operator delete[](void* block)
+
+void operator delete(/* In */ void* block, /* In */ size_t) noexcept	// The block to free
+{
+	operator delete(block);
+
+} // End operator delete(void* block, size_t)
+
+void operator delete[](/* In */ void* block, /* In */ size_t) noexcept	// The block to free
+{
+	operator delete(block);
+
+} // End operator delete[](void* block, size_t)
+
+
+int main(/* In */ int argc,		// # of command line arguments
+		 /* In */ char* argv[])	// The command line arguments
+{
+	// Variables
+	int numThreads = int(thread::hardware_concurrency());	// # of threads to search with
+	SolutionFormatEnum format = SOLUTIONS_TEXT;				// Format to write the solutions in
+	EnumerateLimitsType limits;	// When to stop each search
+	ofstream dout;		// The output file; left unopened to throw the solutions away
+	int arg = 1;		// Index of the current command line argument
+
+	limits.maxSolutions = 0;
+	limits.maxSeconds = 0;
+	limits.checkpointSeconds = 0;
+	limits.reportSeconds = 0;
+
+	// Read the options
+	while( arg < argc && argv[arg][0] == '-' )
+	{
+		if(strcmp(argv[arg], "-t") == 0 && arg + 1 < argc)
+		{
+			numThreads = atoi(argv[arg + 1]);
+			arg += 2;
+
+		} // End if
+		else if(strcmp(argv[arg], "-c") == 0)
+		{
+			format = SOLUTIONS_COMPACT;
+			arg++;
+
+		} // End else if
+		else if(strcmp(argv[arg], "-k") == 0)
+		{
+			format = SOLUTIONS_COUNT_ONLY;
+			arg++;
+
+		} // End else if
+		else if(strcmp(argv[arg], "-n") == 0 && arg + 1 < argc)
+		{
+			limits.maxSolutions = atoll(argv[arg + 1]);
+			arg += 2;
+
+		} // End else if
+		else if(strcmp(argv[arg], "-s") == 0 && arg + 1 < argc)
+		{
+			limits.maxSeconds = atof(argv[arg + 1]);
+			arg += 2;
+
+		} // End else if
+		else if(strcmp(argv[arg], "-r") == 0 && arg + 1 < argc)
+		{
+			limits.reportSeconds = atof(argv[arg + 1]);
+			arg += 2;
+
+		} // End else if
+		else if(strcmp(argv[arg], "-o") == 0 && arg + 1 < argc)
+		{
+			dout.open(argv[arg + 1], ios::binary);
+			arg += 2;
+
+		} // End else if
+		else
+		{
+			break;
+
+		} // End else
+
+	} // End while
+
+	// If no maze files were given
+	if(arg == argc)
+	{
+		cout << "Usage: bench [-t threads] [-c | -k] [-n solutions] [-s seconds] [-r seconds] "
+				"[-o outFile] mazeFile..." << endl;
+		return EXIT_FAILURE;
+
+	} // End if
+
+	cout << left << setw(24) << "maze" << right << setw(7) << "rows" << setw(7) << "cols"
+		 << setw(12) << "solutions" << setw(14) << "nodes" << setw(9) << "load s" << setw(10)
+		 << "solve s" << setw(12) << "nodes/s" << setw(12) << "sol/s" << setw(10) << "allocs"
+		 << setw(9) << "heap MB" << setw(9) << "RSS MB" << endl;
+
+	// Measure each maze in turn
+	for(; arg < argc; arg++)
+	{
+		BenchMaze(argv[arg], numThreads, format, limits, dout);
+
+	} // End for
+
+	return EXIT_SUCCESS;
+
+} // End main()
+
+//******************************************************************************************************
+
+/*
+Purpose:	Returns the peak resident set size of the process, in megabytes.
+Pre:		None
+Post:		The peak resident set size has been returned, or 0 where getrusage is not available.
+*/
+double PeakResidentMB()
+{
+#ifndef _WIN32
+	struct rusage usage;	// Gets the resource usage of the process
+
+	getrusage(RUSAGE_SELF, &usage);
+
+	// ru_maxrss is in kilobytes on Linux, and in bytes on macOS
+#ifdef __APPLE__
+	return usage.ru_maxrss / BYTES_PER_MB;
+#else
+	return usage.ru_maxrss / 1024.0;
+#endif
+#else
+	return 0.0;
+#endif
+
+} // End PeakResidentMB()
+
+//******************************************************************************************************
+
+/*
+Purpose:	Loads, prunes and searches one maze, up to limits, and outputs a line of measurements for
+			it.
+Pre:		numThreads has been assigned a value. dout is open on the output file, or unopened to
+			throw the solutions away.
+Post:		A line of measurements, or the reason the maze could not be measured, has been output to
+			the console. The maze's solutions, up to limits, have been written to dout.
+*/
+void BenchMaze(/* In */		const string&			   fileName,	// Name of the maze file
+			   /* In */		const int				   numThreads,	// # of threads to search with
+			   /* In */		const SolutionFormatEnum   format,		// Format to write solutions in
+			   /* In */		const EnumerateLimitsType& limits,		// When to stop the search
+			   /* In/Out */ ofstream&				   dout)		// The output file
+{
+	MazeFileClass mazeFile;						// The maze file, mapped into memory
+	chrono::steady_clock::time_point start;		// When loading the maze began
+	chrono::steady_clock::time_point loaded;	// When loading the maze ended
+	chrono::steady_clock::time_point solved;	// When searching the maze ended
+	double loadSeconds;							// Seconds taken to load the maze
+	double solveSeconds;						// Seconds taken to prune and search the maze
+	long long numSolutions = 0;					// # of valid paths found
+	long long numNodes = 0;						// # of locations the search moved into
+	long long allocations;						// # of allocations made by the search
+	long long heapBytes;						// Most heap bytes the search held at once
+
+	try
+	{
+		start = chrono::steady_clock::now();
+
+		// If the maze file cannot be opened
+		if( !mazeFile.Open(fileName) )
+		{
+			cout << left << setw(24) << fileName << " File not found or not a maze file." << endl;
+			return;
+
+		} // End if
+
+		MazeClass maze(mazeFile.GetNumRows(), mazeFile.GetNumCols());
+
+		mazeFile.LoadWalls(maze);
+		mazeFile.Close();
+		loaded = chrono::steady_clock::now();
+
+		// Count only what the search allocates
+		numAllocations = 0;
+		peakBytes.store(liveBytes);
+		heapBytes = liveBytes;
+
+		// If the entrance and the exit are open, prune and search the maze
+		if(maze.GetStatus(0, 0) != WALL && maze.GetStatus(maze.GetNumRows() - 1,
+															maze.GetNumCols() - 1) != WALL)
+		{
+			SolutionWriterClass writer(dout, format);
+			PathEnumeratorClass enumerator(maze, numThreads);
+			CheckpointClass checkpoint;		// Where the search starts, and gets to
+
+			numSolutions = enumerator.Enumerate(writer, limits, checkpoint);
+			writer.Finish();
+			numNodes = enumerator.GetNumNodes();
+			SEARCH_STAT(enumerator.GetStats().WriteJson(cerr));
+
+		} // End if
+
+		solved = chrono::steady_clock::now();
+		allocations = numAllocations;
+		heapBytes = peakBytes - heapBytes;
+
+		loadSeconds = chrono::duration<double>(loaded - start).count();
+		solveSeconds = chrono::duration<double>(solved - loaded).count();
+
+		cout << left << setw(24) << fileName << right << setw(7) << maze.GetNumRows() << setw(7)
+			 << maze.GetNumCols() << setw(12) << numSolutions << setw(14) << numNodes << fixed
+			 << setprecision(3) << setw(9) << loadSeconds << setw(10) << solveSeconds
+			 << setprecision(0) << setw(12) << (solveSeconds > 0 ? numNodes / solveSeconds : 0.0)
+			 << setw(12) << (solveSeconds > 0 ? numSolutions / solveSeconds : 0.0) << setw(10)
+			 << allocations << setprecision(1) << setw(9) << heapBytes / BYTES_PER_MB << setw(9)
+			 << PeakResidentMB() << endl;
+
+	} // End try
+	catch(nmspcMazeExceptions::OutOfMemoryException e)
+	{
+		cout << left << setw(24) << fileName << ' ' << e.GetMessage() << endl;
+
+	} // End catch
+	catch(nmspcStackExceptions::OutOfMemoryException e)
+	{
+		cout << left << setw(24) << fileName << ' ' << e.GetMessage() << endl;
+
+	} // End catch
+
+} // End BenchMaze(const string& fileName, int numThreads, SolutionFormatEnum format,
+  //  const EnumerateLimitsType& limits, ofstream& dout)
\ No newline at end of file
@@ -0,0 +1,158 @@
+/*
+AUTHOR:
+	Chris Pray
+
+DATE:
+	10/19/26
+
+FILENAME:
+	bigcount.cpp
+
+PURPOSE:
+	This file contains the implementation for all of the methods declared in bigcount.h
+*/
+
+#include "bigcount.h"
+
+const uint32_t DECIMAL_CHUNK = 1000000000;	// 10^9; the most decimal digits that fit in a limb
+const int DIGITS_PER_CHUNK = 9;				// # of decimal digits in DECIMAL_CHUNK - 1
+
+
+//***************************************************************************************
+//*																						*
+//*							Default and Non-default Constructor							*
+//*																						*
+//***************************************************************************************
+
+// Default Constructor
+BigCountClass::BigCountClass()
+{
+
+} // End BigCountClass()
+
+//***************************************************************************************
+
+// Non-default Constructor
+BigCountClass::BigCountClass(/* In */ const unsigned int value)	// The value to hold
+{
+	if(value != 0)
+	{
+		limbs.push_back(value);
+
+	} // End if
+
+} // End BigCountClass(unsigned int value)
+
+
+//***************************************************************************************
+//*																						*
+//*									Mutator												*
+//*																						*
+//***************************************************************************************
+
+BigCountClass& BigCountClass::operator+=(/* In */ const BigCountClass& addend)	// Value to add
+{
+	uint64_t carry = 0;		// Carry out of the limb just added
+
+	// Make room for every limb of addend
+	if(limbs.size() < addend.limbs.size())
+	{
+		limbs.resize(addend.limbs.size(), 0);
+
+	} // End if
+
+	// Add limb by limb, carrying into the next limb
+	for(size_t i = 0; i < limbs.size() && (i < addend.limbs.size() || carry != 0); i++)
+	{
+		carry += limbs[i];
+
+		if(i < addend.limbs.size())
+		{
+			carry += addend.limbs[i];
+
+		} // End if
+
+		limbs[i] = uint32_t(carry);
+		carry >>= 32;
+
+	} // End for
+
+	// If the sum carried out of the top limb
+	if(carry != 0)
+	{
+		limbs.push_back(uint32_t(carry));
+
+	} // End if
+
+	return *this;
+
+} // End operator+=(const BigCountClass& addend)
+
+
+//***************************************************************************************
+//*																						*
+//*								Observer / Accessor										*
+//*																						*
+//***************************************************************************************
+
+bool BigCountClass::IsZero() const
+{
+	return limbs.empty();
+
+} // End IsZero()
+
+//***************************************************************************************
+
+string BigCountClass::ToString() const
+{
+	vector<uint32_t> quotient(limbs);	// What is left of the value to print
+	vector<uint32_t> chunks;			// The value in base 10^9, least significant chunk first
+	uint64_t remainder;					// Remainder of a limb division
+	string digits;						// The printed value
+	string chunk;						// The digits of one chunk
+
+	// If the value is 0
+	if(quotient.empty())
+	{
+		return "0";
+
+	} // End if
+
+	// Divide the value by 10^9 until nothing is left, keeping each remainder
+	while( !quotient.empty() )
+	{
+		remainder = 0;
+
+		for(size_t i = quotient.size(); i-- > 0; )
+		{
+			remainder = (remainder << 32) | quotient[i];
+			quotient[i] = uint32_t(remainder / DECIMAL_CHUNK);
+			remainder %= DECIMAL_CHUNK;
+
+		} // End for
+
+		chunks.push_back(uint32_t(remainder));
+
+		// Drop the leading zero limbs
+		while( !quotient.empty() && quotient.back() == 0 )
+		{
+			quotient.pop_back();
+
+		} // End while
+
+	} // End while
+
+	// Print the top chunk as is and each chunk below it padded to nine digits
+	digits = to_string(chunks.back());
+
+	for(size_t i = chunks.size() - 1; i-- > 0; )
+	{
+		chunk = to_string(chunks[i]);
+		digits.append(DIGITS_PER_CHUNK - chunk.size(), '0');
+		digits += chunk;
+
+	} // End for
+
+	return digits;
+
+} // End ToString()
\ No newline at end of file
@@ -0,0 +1,108 @@
+/*
+AUTHOR:
+	Chris Pray
+
+DATE:
+	10/19/26
+
+FILENAME:
+	bigcount.h
+
+PURPOSE:
+	This file contains the specification for BigCountClass, an unsigned integer of any size, used to
+	count the paths through a maze when there are far more of them than fit in a machine word. Only the
+	operations counting needs are provided: adding, comparing with zero and printing in decimal. The
+	value is kept as a little-endian array of 32-bit limbs with no leading zero limbs, so zero has no
+	limbs at all and small counts cost no dynamic memory beyond the vector itself.
+
+SUMMARY OF METHODS:
+
+	BigCountClass()
+		Instantiates a BigCountClass object holding 0.
+
+	BigCountClass(unsigned int value)
+		Instantiates a BigCountClass object holding value.
+
+	BigCountClass& operator+=(const BigCountClass& addend)
+		Adds addend to the applying object.
+
+	bool IsZero() const
+		Returns true if the applying object holds 0.
+
+	string ToString() const
+		Returns the value in decimal.
+*/
+
+#ifndef BigCount_h
+#define BigCount_h
+
+#include<cstdint>	// For uint32_t and uint64_t
+#include<string>	// For string
+#include<vector>	// For vector
+using namespace std;
+
+class BigCountClass
+{
+	public:
+
+		// Constructors
+
+		BigCountClass();
+		/*
+		Purpose:			Instantiates a BigCountClass object holding 0.
+		Pre:				None
+		Post:				A BigCountClass object holding 0 has been instantiated.
+		Classification:		Default Constructor
+		Order of Magnitude:	O(1)
+		*/
+
+		BigCountClass(/* In */ const unsigned int value);	// The value to hold
+		/*
+		Purpose:			Instantiates a BigCountClass object holding value.
+		Pre:				None
+		Post:				A BigCountClass object holding value has been instantiated.
+		Classification:		Non-default Constructor
+		Order of Magnitude:	O(1)
+		*/
+
+
+		// ADT BigCountClass Operations
+
+		BigCountClass& operator+=(/* In */ const BigCountClass& addend);	// The value to add
+		/*
+		Purpose:			Adds addend to the applying object.
+		Pre:				None
+		Post:				The applying object holds its old value plus addend. A reference to the
+							applying object has been returned.
+		Classification:		Mutator
+		Order of Magnitude:	O(N), where N = # of limbs in the larger value
+		Exceptions Thrown:	bad_alloc
+		*/
+
+		bool IsZero() const;
+		/*
+		Purpose:			Determines whether the applying object holds 0.
+		Pre:				None
+		Post:				True has been returned if the value is 0, false otherwise.
+		Classification:		Observer / Predicator
+		Order of Magnitude:	O(1)
+		*/
+
+		string ToString() const;
+		/*
+		Purpose:			Returns the value in decimal, nine digits at a time.
+		Pre:				None
+		Post:				The decimal digits of the value have been returned, with no leading zeros.
+		Classification:		Observer / Accessor
+		Order of Magnitude:	O(N^2), where N = # of limbs
+		Exceptions Thrown:	bad_alloc
+		*/
+
+
+	private:
+
+		vector<uint32_t> limbs;	// The value in base 2^32, least significant limb first
+
+}; // End BigCountClass
+
+#endif
\ No newline at end of file
@@ -0,0 +1,410 @@
+/*
+AUTHOR:
+	Chris Pray
+
+DATE:
+	10/19/26
+
+FILENAME:
+	checkpoint.cpp
+
+PURPOSE:
+	This file contains the implementation for all of the methods declared in checkpoint.h
+*/
+
+#include "checkpoint.h"
+#include<climits>	// For INT_MAX
+#include<cstdio>	// For rename and remove
+#include<cstring>	// For memcmp
+#include<fstream>	// For ifstream and ofstream
+#include<new>		// For bad_alloc
+
+const char TEMPORARY_SUFFIX[] = ".tmp";		// Added to the name of a checkpoint file while it is saved
+const uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;	// First value of an FNV-1a hash
+const uint64_t FNV_PRIME = 1099511628211ULL;				// Multiplier of an FNV-1a hash
+const int MOVES_PER_BYTE = 4;	// # of moves packed into each byte of a route
+const int BITS_PER_MOVE = 2;	// # of bits each packed move takes
+
+
+//***************************************************************************************
+//*																						*
+//*								File-scope Helpers										*
+//*																						*
+//***************************************************************************************
+
+/*
+Purpose:	Adds the bytes of a 64-bit word to an FNV-1a hash, lowest first.
+Pre:		None
+Post:		hash has taken in the eight bytes of word.
+*/
+static void HashWord(/* In/Out */ uint64_t&		 hash,	// The hash so far
+					 /* In */	  const uint64_t word)	// The word to add
+{
+	for(int i = 0; i < 8; i++)
+	{
+		hash = (hash ^ ((word >> (8 * i)) & 0xff)) * FNV_PRIME;
+
+	} // End for
+
+} // End HashWord(uint64_t& hash, uint64_t word)
+
+//***************************************************************************************
+
+/*
+Purpose:	Hashes the dimensions and the walls of a maze.
+Pre:		maze has been built.
+Post:		The FNV-1a hash of the dimensions and the packed wall rows of maze has been returned.
+*/
+static uint64_t HashWalls(/* In */ const MazeClass& maze)	// The maze to hash
+{
+	vector<uint64_t> walls((maze.GetNumCols() + BITS_PER_WORD - 1) / BITS_PER_WORD);
+		// The packed walls of one row
+	uint64_t hash = FNV_OFFSET_BASIS;	// The hash so far
+
+	HashWord(hash, uint64_t(maze.GetNumRows()));
+	HashWord(hash, uint64_t(maze.GetNumCols()));
+
+	for(int row = 0; row < maze.GetNumRows(); row++)
+	{
+		maze.GetRowWalls(row, walls.data());
+
+		for(size_t i = 0; i < walls.size(); i++)
+		{
+			HashWord(hash, walls[i]);
+
+		} // End for
+
+	} // End for
+
+	return hash;
+
+} // End HashWalls(const MazeClass& maze)
+
+
+//***************************************************************************************
+//*																						*
+//*								Default Constructor										*
+//*																						*
+//***************************************************************************************
+
+// Default Constructor
+CheckpointClass::CheckpointClass()
+{
+	numRows = 0;
+	numCols = 0;
+	wallsHash = 0;
+	numSolutions = 0;
+	outputSize = 0;
+	format = SOLUTIONS_TEXT;
+	finished = false;
+
+} // End CheckpointClass()
+
+
+//***************************************************************************************
+//*																						*
+//*									Mutator												*
+//*																						*
+//***************************************************************************************
+
+void CheckpointClass::SetMaze(/* In */ const MazeClass&			maze,		// The maze to search
+							  /* In */ const SolutionFormatEnum setFormat)	// Format of the solutions
+{
+	try
+	{
+		wallsHash = HashWalls(maze);
+
+	} // End try
+	catch(bad_alloc e)
+	{
+		throw nmspcMazeExceptions::OutOfMemoryException("OutOfMemoryException: The heap has run out "
+			"of memory.");
+
+	} // End catch
+
+	numRows = maze.GetNumRows();
+	numCols = maze.GetNumCols();
+	format = setFormat;
+	route.clear();
+	numSolutions = 0;
+	outputSize = 0;
+	finished = false;
+
+} // End SetMaze(const MazeClass& maze, SolutionFormatEnum setFormat)
+
+//***************************************************************************************
+
+void CheckpointClass::SetProgress(/* In */ const vector<unsigned char>& setRoute,		// Route
+								  /* In */ const long long				setNumSolutions,	// # written
+								  /* In */ const long long				setOutputSize,		// Size
+								  /* In */ const bool					setFinished)		// Done
+{
+	try
+	{
+		route = setRoute;
+
+	} // End try
+	catch(bad_alloc e)
+	{
+		throw nmspcMazeExceptions::OutOfMemoryException("OutOfMemoryException: The heap has run out "
+			"of memory.");
+
+	} // End catch
+
+	numSolutions = setNumSolutions;
+	outputSize = setOutputSize;
+	finished = setFinished;
+
+} // End SetProgress(const vector<unsigned char>& setRoute, long long setNumSolutions, ...)
+
+//***************************************************************************************
+
+bool CheckpointClass::Load(/* In */ const string& fileName)	// Name of the checkpoint file
+{
+	ifstream din(fileName.c_str(), ios::binary);		// The file to read
+	char magic[CHECKPOINT_MAGIC_SIZE];					// The file's first bytes
+	uint64_t fields[CHECKPOINT_NUM_FIELDS];				// The integers after them
+	vector<unsigned char> packed;						// The route, four moves to a byte
+	vector<unsigned char> moves;						// The route, one move to a byte
+
+	din.read(magic, CHECKPOINT_MAGIC_SIZE);
+	din.read(reinterpret_cast<char*>(fields), sizeof(fields));
+
+	// If the file is not a checkpoint file, or its fields are out of range
+	if( !din || memcmp(magic, CHECKPOINT_MAGIC, CHECKPOINT_MAGIC_SIZE) != 0 ||
+		fields[0] == 0 || fields[1] == 0 || fields[0] > uint64_t(INT_MAX) ||
+		fields[1] > uint64_t(INT_MAX) / fields[0] || fields[5] > uint64_t(SOLUTIONS_COUNT_ONLY) ||
+		fields[6] > 1 || fields[7] > fields[0] * fields[1] )
+	{
+		return false;
+
+	} // End if
+
+	try
+	{
+		packed.resize((fields[7] + MOVES_PER_BYTE - 1) / MOVES_PER_BYTE);
+		moves.resize(fields[7]);
+
+	} // End try
+	catch(bad_alloc e)
+	{
+		throw nmspcMazeExceptions::OutOfMemoryException("OutOfMemoryException: The heap has run out "
+			"of memory.");
+
+	} // End catch
+
+	din.read(reinterpret_cast<char*>(packed.data()), packed.size());
+
+	// If the file ends before the route does
+	if( !din )
+	{
+		return false;
+
+	} // End if
+
+	// Unpack the route
+	for(size_t i = 0; i < moves.size(); i++)
+	{
+		moves[i] = (packed[i / MOVES_PER_BYTE] >> (BITS_PER_MOVE * (i % MOVES_PER_BYTE))) & 3;
+
+	} // End for
+
+	numRows = int(fields[0]);
+	numCols = int(fields[1]);
+	wallsHash = fields[2];
+	numSolutions = (long long)fields[3];
+	outputSize = (long long)fields[4];
+	format = SolutionFormatEnum(fields[5]);
+	finished = fields[6] != 0;
+	route.swap(moves);
+
+	return true;
+
+} // End Load(const string& fileName)
+
+
+//***************************************************************************************
+//*																						*
+//*								Observer / Accessor										*
+//*																						*
+//***************************************************************************************
+
+bool CheckpointClass::Save(/* In */ const string& fileName) const	// Name of the checkpoint file
+{
+	const uint64_t fields[CHECKPOINT_NUM_FIELDS] = { uint64_t(numRows), uint64_t(numCols), wallsHash,
+		uint64_t(numSolutions), uint64_t(outputSize), uint64_t(format), uint64_t(finished),
+		uint64_t(route.size()) };	// The integers after the magic bytes
+	const string temporaryName = fileName + TEMPORARY_SUFFIX;	// Name written before the rename
+	vector<unsigned char> packed;								// The route, four moves to a byte
+	ofstream dout;												// The file to write
+
+	try
+	{
+		packed.assign((route.size() + MOVES_PER_BYTE - 1) / MOVES_PER_BYTE, 0);
+
+	} // End try
+	catch(bad_alloc e)
+	{
+		throw nmspcMazeExceptions::OutOfMemoryException("OutOfMemoryException: The heap has run out "
+			"of memory.");
+
+	} // End catch
+
+	// Pack the route
+	for(size_t i = 0; i < route.size(); i++)
+	{
+		packed[i / MOVES_PER_BYTE] |= (route[i] & 3) << (BITS_PER_MOVE * (i % MOVES_PER_BYTE));
+
+	} // End for
+
+	// Write the checkpoint under the temporary name
+	dout.open(temporaryName.c_str(), ios::binary);
+
+	if( !dout )
+	{
+		return false;
+
+	} // End if
+
+	dout.write(CHECKPOINT_MAGIC, CHECKPOINT_MAGIC_SIZE);
+	dout.write(reinterpret_cast<const char*>(fields), sizeof(fields));
+	dout.write(reinterpret_cast<const char*>(packed.data()), packed.size());
+	dout.close();
+
+	if( dout.fail() )
+	{
+		remove(temporaryName.c_str());
+		return false;
+
+	} // End if
+
+	// Put it in the place of the previous checkpoint; rename will not replace a file on Windows
+#ifdef _WIN32
+	remove(fileName.c_str());
+#endif
+
+	return rename(temporaryName.c_str(), fileName.c_str()) == 0;
+
+} // End Save(const string& fileName)
+
+//***************************************************************************************
+
+bool CheckpointClass::Matches(/* In */ const MazeClass& maze) const	// The maze to check against
+{
+	vector<bool> visited;	// True for each location the route has passed
+	int row = 0;			// Row # reached by the route
+	int col = 0;			// Column # reached by the route
+
+	// If the dimensions differ
+	if(numRows != maze.GetNumRows() || numCols != maze.GetNumCols())
+	{
+		return false;
+
+	} // End if
+
+	try
+	{
+		// If the walls differ
+		if(wallsHash != HashWalls(maze))
+		{
+			return false;
+
+		} // End if
+
+		visited.assign(size_t(numRows) * numCols, false);
+
+	} // End try
+	catch(bad_alloc e)
+	{
+		throw nmspcMazeExceptions::OutOfMemoryException("OutOfMemoryException: The heap has run out "
+			"of memory.");
+
+	} // End catch
+
+	// If the route is empty, there is nothing more to check
+	if( route.empty() )
+	{
+		return true;
+
+	} // End if
+
+	// If the entrance is a wall
+	if(maze.GetStatus(row, col) == WALL)
+	{
+		return false;
+
+	} // End if
+
+	visited[0] = true;
+
+	// Follow the route from the entrance
+	for(size_t i = 0; i < route.size(); i++)
+	{
+		// Branch depending on the direction
+		switch( DirectionEnum(route[i]) )
+		{
+			case EAST: col++; break;
+
+			case SOUTH: row++; break;
+
+			case WEST: col--; break;
+
+			case NORTH: row--; break;
+
+		} // End switch
+
+		// If the move leaves the maze, crosses a wall, or comes back to a location already passed
+		if( row < 0 || row >= numRows || col < 0 || col >= numCols ||
+			maze.GetStatus(row, col) == WALL || visited[size_t(row) * numCols + col] )
+		{
+			return false;
+
+		} // End if
+
+		visited[size_t(row) * numCols + col] = true;
+
+	} // End for
+
+	return true;
+
+} // End Matches(const MazeClass& maze)
+
+//***************************************************************************************
+
+const vector<unsigned char>& CheckpointClass::GetRoute() const
+{
+	return route;
+
+} // End GetRoute()
+
+//***************************************************************************************
+
+long long CheckpointClass::GetNumSolutions() const
+{
+	return numSolutions;
+
+} // End GetNumSolutions()
+
+//***************************************************************************************
+
+long long CheckpointClass::GetOutputSize() const
+{
+	return outputSize;
+
+} // End GetOutputSize()
+
+//***************************************************************************************
+
+SolutionFormatEnum CheckpointClass::GetFormat() const
+{
+	return format;
+
+} // End GetFormat()
+
+//***************************************************************************************
+
+bool CheckpointClass::IsFinished() const
+{
+	return finished;
+
+} // End IsFinished()
\ No newline at end of file
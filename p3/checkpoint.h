@@ -0,0 +1,246 @@
+/*
+AUTHOR:
+	Chris Pray
+
+DATE:
+	10/19/26
+
+FILENAME:
+	checkpoint.h
+
+PURPOSE:
+	This file contains the specification for CheckpointClass, which holds how far a search for the
+	valid paths through a maze got, and saves it to and loads it from a checkpoint file, so that a
+	search that was stopped, or whose machine went down, can be resumed where it left off instead of
+	started over.
+
+	The search writes its solutions in depth-first order, so everything it has done is summed up by
+	a route: the moves from the entrance to the farthest location it reached, not counting the move
+	into the maze, such that every path that comes before the route in depth-first order, or that
+	starts with it, has been searched and its solutions written. The route is either the last
+	solution written, without its moves into and out of the maze, or the path to a task whose
+	solutions have all been written. An empty route means the search has not started. The visited
+	locations and tried directions of the search are rebuilt by following the route again, so they
+	need not be saved.
+
+	Alongside the route are the # of solutions written, the size the output file had reached when
+	they had been, the format they were written in, and whether the search finished. The maze is
+	told apart from others by its dimensions and a 64-bit FNV-1a hash of its walls.
+
+	A checkpoint file holds:
+		Bytes 0-7		the magic bytes "P3CKPT01"
+		Bytes 8-71		eight 64-bit unsigned integers: the # of rows, the # of columns, the hash of
+						the walls, the # of solutions, the size of the output file, the
+						SolutionFormatEnum, 1 if the search finished or else 0, and the # of moves
+						in the route
+		Bytes 72-		the moves of the route, four to a byte, lowest bits first, two bits per move
+						holding its DirectionEnum; the bits past the last move are clear
+	All integers are little-endian. A checkpoint file is written under a temporary name and then
+	renamed, so that a crash while saving leaves the previous checkpoint whole.
+
+ASSUMPTIONS:
+	(1) The machine is little-endian.
+
+EXCEPTION HANDLING:
+	bad_alloc is caught if an attempt to allocate dynamic memory fails, and OutOfMemoryException is
+	thrown in its place.
+
+SUMMARY OF METHODS:
+
+	CheckpointClass()
+		Instantiates a CheckpointClass object for a search that has not started.
+
+	void SetMaze(const MazeClass& maze, SolutionFormatEnum setFormat)
+		Starts the checkpoint over for a new search of maze, writing in setFormat.
+
+	void SetProgress(const vector<unsigned char>& setRoute, long long setNumSolutions,
+					 long long setOutputSize, bool setFinished)
+		Records how far the search has got.
+
+	bool Load(const string& fileName)
+		Reads a checkpoint from a checkpoint file.
+
+	bool Save(const string& fileName) const
+		Writes the checkpoint to a checkpoint file.
+
+	bool Matches(const MazeClass& maze) const
+		Returns true if the checkpoint is of a search of maze.
+
+	const vector<unsigned char>& GetRoute() const
+		Returns the route the search has reached.
+
+	long long GetNumSolutions() const
+		Returns the # of solutions written.
+
+	long long GetOutputSize() const
+		Returns the size of the output file when those solutions had been written.
+
+	SolutionFormatEnum GetFormat() const
+		Returns the format the solutions are written in.
+
+	bool IsFinished() const
+		Returns true if the search finished.
+*/
+
+#ifndef Checkpoint_h
+#define Checkpoint_h
+
+#include "maze.h"			// For MazeClass
+#include "solutionfile.h"	// For SolutionFormatEnum
+#include<cstdint>			// For uint64_t
+#include<string>			// For string
+#include<vector>			// For vector
+using namespace std;
+
+const char CHECKPOINT_MAGIC[] = "P3CKPT01";	// First bytes of a checkpoint file
+const int CHECKPOINT_MAGIC_SIZE = 8;		// # of magic bytes
+const int CHECKPOINT_NUM_FIELDS = 8;		// # of 64-bit integers after the magic bytes
+
+class CheckpointClass
+{
+	public:
+
+		// Constructor
+
+		CheckpointClass();
+		/*
+		Purpose:			Instantiates a CheckpointClass object for a search that has not started,
+							writing text, of no maze in particular.
+		Pre:				None
+		Post:				A CheckpointClass object with an empty route and no solutions has been
+							instantiated.
+		Classification:		Default Constructor
+		Order of Magnitude:	O(1)
+		*/
+
+
+		// ADT CheckpointClass Operations
+
+		void SetMaze(/* In */ const MazeClass&		   maze,		// The maze to be searched
+					 /* In */ const SolutionFormatEnum setFormat);	// Format of the solutions
+		/*
+		Purpose:			Starts the checkpoint over for a new search of maze whose solutions are
+							written in setFormat.
+		Pre:				maze has been built.
+		Post:				The checkpoint holds the dimensions and hash of maze, and setFormat. Its
+							route is empty, it has no solutions and the search has not finished.
+		Classification:		Mutator
+		Order of Magnitude:	O(N * M / 64), where N = # of rows and M = # of columns in maze
+		Exceptions Thrown:	OutOfMemoryException
+		*/
+
+		void SetProgress(/* In */ const vector<unsigned char>& setRoute,		// Route reached
+						 /* In */ const long long			   setNumSolutions,	// # written
+						 /* In */ const long long			   setOutputSize,	// Output size
+						 /* In */ const bool				   setFinished);	// True if done
+		/*
+		Purpose:			Records that the search has reached setRoute, having written
+							setNumSolutions solutions and setOutputSize bytes of output, and whether
+							it has finished.
+		Pre:				setRoute holds moves from the entrance, one DirectionEnum per byte.
+		Post:				The checkpoint holds the progress given.
+		Classification:		Mutator
+		Order of Magnitude:	O(R), where R = # of moves in setRoute
+		Exceptions Thrown:	OutOfMemoryException
+		*/
+
+		bool Load(/* In */ const string& fileName);	// Name of the checkpoint file
+		/*
+		Purpose:			Reads the checkpoint saved in the file named fileName.
+		Pre:				A CheckpointClass object has been instantiated.
+		Post:				If the file was read and is a whole checkpoint file, the object holds its
+							checkpoint and true has been returned. Otherwise the object is unchanged
+							and false has been returned.
+		Classification:		Mutator
+		Order of Magnitude:	O(R), where R = # of moves in the route
+		Exceptions Thrown:	OutOfMemoryException
+		*/
+
+		bool Save(/* In */ const string& fileName) const;	// Name of the checkpoint file
+		/*
+		Purpose:			Writes the checkpoint to the file named fileName, replacing whatever it
+							held only once the new checkpoint is whole.
+		Pre:				A CheckpointClass object has been instantiated.
+		Post:				If the file could be written, it holds the checkpoint and true has been
+							returned. Otherwise the file is unchanged and false has been returned.
+		Classification:		Observer / Accessor
+		Order of Magnitude:	O(R), where R = # of moves in the route
+		Exceptions Thrown:	OutOfMemoryException
+		*/
+
+		bool Matches(/* In */ const MazeClass& maze) const;	// The maze to check against
+		/*
+		Purpose:			Determines whether the checkpoint is of a search of maze: the dimensions
+							and the hash of the walls are the same, and the route is a path through
+							maze from the entrance that crosses no wall, leaves the maze nowhere and
+							passes no location twice.
+		Pre:				maze has been built.
+		Post:				True has been returned if the checkpoint is of a search of maze, false
+							otherwise.
+		Classification:		Observer / Predicator
+		Order of Magnitude:	O(N * M + R), where N = # of rows and M = # of columns in maze and R = #
+							of moves in the route
+		Exceptions Thrown:	OutOfMemoryException
+		*/
+
+		const vector<unsigned char>& GetRoute() const;
+		/*
+		Purpose:			Returns the route the search has reached, one DirectionEnum per byte.
+		Pre:				A CheckpointClass object has been instantiated.
+		Post:				The route has been returned; it is empty if the search has not started.
+		Classification:		Observer / Accessor
+		Order of Magnitude:	O(1)
+		*/
+
+		long long GetNumSolutions() const;
+		/*
+		Purpose:			Returns the # of solutions the search had written.
+		Pre:				A CheckpointClass object has been instantiated.
+		Post:				The # of solutions has been returned.
+		Classification:		Observer / Accessor
+		Order of Magnitude:	O(1)
+		*/
+
+		long long GetOutputSize() const;
+		/*
+		Purpose:			Returns the size, in bytes, the output file had reached when the search
+							had written its solutions.
+		Pre:				A CheckpointClass object has been instantiated.
+		Post:				The size has been returned; it is 0 if solutions are only counted.
+		Classification:		Observer / Accessor
+		Order of Magnitude:	O(1)
+		*/
+
+		SolutionFormatEnum GetFormat() const;
+		/*
+		Purpose:			Returns the format the search writes its solutions in.
+		Pre:				A CheckpointClass object has been instantiated.
+		Post:				The format has been returned.
+		Classification:		Observer / Accessor
+		Order of Magnitude:	O(1)
+		*/
+
+		bool IsFinished() const;
+		/*
+		Purpose:			Determines whether the search finished, having written every solution.
+		Pre:				A CheckpointClass object has been instantiated.
+		Post:				True has been returned if the search finished, false otherwise.
+		Classification:		Observer / Predicator
+		Order of Magnitude:	O(1)
+		*/
+
+
+	private:
+
+		int numRows;					// # of rows in the maze
+		int numCols;					// # of columns in the maze
+		uint64_t wallsHash;				// Hash of the walls of the maze
+		vector<unsigned char> route;	// The moves to the farthest location the search reached
+		long long numSolutions;			// # of solutions written
+		long long outputSize;			// # of bytes in the output file after those solutions
+		SolutionFormatEnum format;		// Format the solutions are written in
+		bool finished;					// True if the search finished
+
+}; // End CheckpointClass
+
+#endif
\ No newline at end of file
@@ -21,22 +21,44 @@ PURPOSE:
 INPUT:
 	This file reads a file name from the user, validates the file name, and attempts to open the file.
 	If the file was successfully opened, data is read from the file. This data specifies the dimensions
-	of the maze which is created and the locations of walls in the maze, if there are any.
+	of the maze which is created and the locations of walls in the maze, if there are any. The file
+	may be a text maze file or a binary maze file, as written by convert.cpp; its format is told from
+	its contents. If a checkpoint of an unfinished search of the same maze was saved, the user is asked
+	whether to resume it. Otherwise the user is asked whether the solutions should be written in
+	compact form, or else only counted. Then the user is asked for the most solutions to write and the
+	most seconds to search for, either of which may be 0 for no limit.
 
 PROCESSING:
 	First, the input file name read from the user is validated. If it is in the correct format, the
-	program attempts to open the file. If successful, the dimensions of the maze are read from the file.
-	A MazeClass object gets instantiated with these dimensions. Next, the locations of walls in the
-	maze, if there are any, are read from the file, building the walls of the maze as they are read,
-	until the end of the file is reached. Then the program searches through the maze to find all valid
-	paths through the maze. For each move to a new location within the maze, the direction moved gets
-	pushed onto a stack in order to keep track of the path through the maze. If a backtrack is
-	necessary, an appropriate number of pops from the stack are called. Each time a valid path through
-	the maze is encountered, a copy of the stack is made, and each item on the copied stack is pushed
-	onto a third stack, so that the items in the third stack are the items of the original stack but in
-	reverse order. Finally, the items in this third stack are popped and written to the output file, so
+	program attempts to open the file, mapping it into memory. If successful, the dimensions of the
+	maze are read from the file. A MazeClass object gets instantiated with these dimensions. Next,
+	the locations of walls in the maze, if there are any, are parsed from the file in one pass until
+	the end of the file is reached, and the walls of the maze are built from them a row at a time; a
+	binary maze file already holds the walls of each row packed one bit per location, and they are
+	copied in as they are. Each location of the maze is packed into a
+	single byte holding its status and the directions tried from it, and is read and updated in
+	place. Then a PathEnumeratorClass object searches through the maze to find all valid paths
+	through the maze, on as many threads as the machine has cores. It first walls off, in its own
+	copy of the maze, the dead-end corridors and the side chambers hanging off a single location,
+	which no valid path can pass through. The search is split into tasks,
+	each the subtree below a short path from the entrance, which the threads share out between them.
+	Within a task, for each move to a new location within the maze, the direction moved gets pushed
+	onto a stack in order to keep track of the path through the maze. Each time a new location is
+	entered, a flood fill over the maze's wall and visited bitboards checks whether the exit can
+	still be reached from it without crossing the path so far; if not, the search backtracks at once
+	instead of exploring paths that can never be completed. If a backtrack is necessary, an
+	appropriate number of pops from the stack are called. The valid paths are written to the output
+	file in the order a single-threaded search would find them, through a SolutionWriterClass object
+	that gathers them in a large buffer, so
 	that when the program has finished executing, the output file contains a sequential order of all
-	valid paths through the maze. If either the entrance to the maze or the exit from the maze are
+	valid paths through the maze. Every CHECKPOINT_SECONDS seconds, and when a limit stops the search,
+	the output file is flushed and a checkpoint of how far the search got is saved to the file whose
+	name is specified by constant, CHECKPOINT_FILE_NAME. A resumed search cuts the output file back to
+	the size the checkpoint recorded, which drops any solutions written after it was saved, and carries
+	on writing after the last solution the checkpoint counts, so a text output file ends up the same as
+	if the search had never stopped. A compact one holds the same paths, but the first path written
+	after resuming is written whole rather than front coded. If either the entrance to the maze or the
+	exit from the maze are
 	blocked by a wall, no searches through the maze are performed since there are no valid paths in this
 	case. The program prompts the user along the way to notify the progress of the execution, including
 	when execution is finished and all valid paths through the maze have been written to the output
@@ -50,6 +72,24 @@ OUTPUT:
 	was found. Otherwise, if either the entrance to the maze or the exit from the maze are blocked, a
 	statement stating so is written to the file.
 
+	If the user asked for compact form, the paths are instead written to the file whose name is
+	specified by constant, COMPACT_OUT_FILE_NAME, in the compact format described in solutionfile.h:
+	each path is front coded against the one before it, as the # of directions they share and the
+	rest of its directions packed two bits apiece, and the file ends with a record of how many paths
+	it holds. decode.cpp turns such a file back into the text above. If the entrance or the exit is
+	blocked, the statement saying so is output to the console
+	instead, and the file holds no paths. If the user asked for the paths only to be counted, no
+	output file is written, and the number of paths is output to the console.
+
+	If a limit stopped the search, the number of paths written so far is output to the console, and
+	the checkpoint file holds what is needed to resume the search by running the program again on the
+	same maze. If the checkpoint could not be saved when the search stopped, the console says so
+	instead.
+
+	When built with SEARCH_STATS defined, the counts of what the search is doing are printed to cerr
+	every REPORT_SECONDS seconds while it runs, and a JSON summary of them, with a histogram of the
+	depths the search reached, is printed to cerr once it stops. See searchstats.h.
+
 ASSUMPTIONS:
 	(1)	The input file will contain the dimensions of the maze
 	(2)	The data in the input file will be in the correct format
@@ -59,74 +99,63 @@ ERROR CHECKING:
 		three letters after the period. The user is given as many chances as necessary to enter a valid
 		file name, or they can press 'Q' or 'q' to quit the program. These chances to re-enter the file
 		name are given in the case a valid file name is not found as well.
-	(2) An error message is printed to the console any time a push is attempted on a full stack.
 
 EXCEPTION HANDLING:
 	(1) nmspcStackExceptions::OutOfMemoryException
 			Thrown on a failure to dynamically allocate memory for a StackClass operation
-	(2) RetrieveOnEmptyException
-			Thrown when attempting to retrieve from an empty stack.
-	(3) nmspcMazeExceptions::OutOfMemoryException
-			Thrown on a failure to dynamically allocate memory when instantiating a MazeClass object.
-	(4) RetrieveFromOutOfBoundsException
+	(2) nmspcMazeExceptions::OutOfMemoryException
+			Thrown on a failure to dynamically allocate memory when instantiating a MazeClass object, or
+			for a PathEnumeratorClass object or any of its threads.
+	(3) RetrieveFromOutOfBoundsException
 			Thrown when attempting to retrieve a MazePositionType struct from a location that's outside
 			the bounds of a MazeClass object.
 
 */
 
 // Header Files / Libraries
-#include "maze.h"	// For use of MazeClass objects
-#include "stack.H"	// For use of StackClass objects
+#include "maze.h"		// For use of MazeClass objects
+#include "enumerator.h"	// For use of PathEnumeratorClass objects
+#include "mazefile.h"	// For use of MazeFileClass objects
+#include "solutionfile.h"	// For use of SolutionWriterClass objects
+#include "checkpoint.h"	// For use of CheckpointClass objects
 #include<iostream>	// For standard input/output
 #include<string>	// For string datatype
 #include<fstream>	// For file input/output
-#include<cstdlib>	// For exit
+#include<cstdlib>	// For exit, atoll and atof
+#include<filesystem>	// For file_size and resize_file
+#include<thread>	// For hardware_concurrency
 using namespace std;
 
-// Prototypes (SUMMARY OF METHODS)
-bool InBounds(int, int, int, int);					// Determines if a specified location is within the
-													//  bounds of the maze.
-void PrintSolution(StackClass&, ofstream&);			// Prints the directions through the maze from start
-													//  to finish to a file.
-void BackTrack(StackClass, int&, int&);				// Determines the previous move in the maze and
-													//  backtracks by setting row or col appropriately.
-void SetStatus(MazeClass&, int, int, PositionEnum);	// Sets the status member of the MazePositionType
-													//  struct at a specified location in the maze.
-void SetTriedEast(MazeClass&, int, int, bool);		// Sets the triedEast member of the MazePositionType
-													//  struct at a specified location in the maze.
-void SetTriedSouth(MazeClass&, int, int, bool);		// Sets the triedSouth member of the
-													//  MazePositionType struct at a specified location
-													//  in the maze.
-void SetTriedWest(MazeClass&, int, int, bool);		// Sets the triedWest member of the MazePositionType
-													//  struct at a specified location in the maze.
-void SetTriedNorth(MazeClass&, int, int, bool);		// Sets the triedNorth member of the
-													//  MazePositionType struct at a specified location
-													//  in the maze.
-
 // Constants
 const char OUT_FILE_NAME[] = "solution.out";	// Output file name
+const char COMPACT_OUT_FILE_NAME[] = "solution.bin";	// Output file name in compact form
+const char CHECKPOINT_FILE_NAME[] = "solution.ckp";	// Checkpoint file name
+const double CHECKPOINT_SECONDS = 60;			// # of seconds between checkpoints
+const double REPORT_SECONDS = 10;				// # of seconds between progress reports, when built
+												//  with SEARCH_STATS
 const int MIN_FILENAME_LENGTH = 5;				// Min length of input file name
-const int FIRST_SOLUTION = 1;					// First solution #
 const int ROW_START = 0;						// 1st row in the maze
 const int COL_START = 0;						// 1st column int he maze
 
 void main()
 {
 	// Variables
-	StackClass stack;						// Keeps track of path through maze
-	StackClass stackCopy;					// Gets a copy of variable stack
-	StackClass printStack;					// Reverse order of directions in variable stackCopy
-	ItemType item;							// An item to be pushed onto a StackClass object
-	ifstream din;							// Input file stream variable
+	MazeFileClass mazeFile;					// The input file, mapped into memory
 	ofstream dout;							// Output file stream variable
 	string inFileName;						// Input file name
+	string outFileName;						// Output file name
+	string answer;							// The user's answer to a prompt
+	SolutionFormatEnum format;				// The format the solutions are written in
+	CheckpointClass checkpoint;				// How far the search has got
+	EnumerateLimitsType limits;				// When to stop the search, and where to save checkpoints
+	error_code error;						// Gets why the output file could not be measured or cut
+	bool resume;							// Gets true if an unfinished search is resumed
 	bool validFileName;						// Gets true if input file name is valid, false otherwise
 	unsigned int index;						// Position of a character in inFileName
 	int row;								// A row # in the maze
 	int col;								// A column # in the maze
 	int numRows;							// Max # of rows in the maze
 	int numCols;							// Max # of columns in the maze
-	int solutionNumber = FIRST_SOLUTION;	// The current solution #
 
 	//**************************************************************************************************
 	// Prompt for and get input file name, validate input file name, open input file
@@ -235,11 +264,9 @@ void main()
 		// If the input file name is valid
 		if( validFileName )
 		{
-			// Open the input file and associate it with din
-			din.open( inFileName.c_str() );
-
-			// If the input file not opened
-			if( !din )
+			// Open the input file and read the dimensions of its maze
+			// If the input file not opened, or it is not a maze file
+			if( !mazeFile.Open(inFileName) )
 			{
 				cout << "File not found." << endl;
 				
@@ -260,304 +287,207 @@ void main()
 	// Build the maze
 
 	// Get the # of rows and # of columns
-	din >> numRows >> numCols;
+	numRows = mazeFile.GetNumRows();
+	numCols = mazeFile.GetNumCols();
 
 	try
 	{
 		// Instantiate the maze with numRows rows and numCols columns
 		MazeClass maze(numRows, numCols);
 
-		// Get the coordinates of the 1st wall
-		din >> row >> col;
-
-		// While the input file is not at the end of the file
-		while( din )
-		{
-			// Set location (row, col) to a wall
-			SetStatus(maze, row, col, WALL);
-
-			// Get the coordinates of the next wall
-			din >> row >> col;
-
-		} // End while
+		// Build the walls listed in the input file
+		mazeFile.LoadWalls(maze);
 
 		// Close the input file
-		din.close();
+		mazeFile.Close();
 
 		cout << "Maze built." << endl;
 
 		//**********************************************************************************************
-		// Discover and Print All Valid Paths Through the Maze
+		// Prompt for and get whether to resume an unfinished search, or else the output format
 
-		// Open the output file and associate it with dout
-		dout.open(OUT_FILE_NAME);
-
-		// Go to the entrance of the maze
-		row = ROW_START;
-		col = COL_START;
+		resume = false;
 
-		// If the entrance to the maze is not a wall
-		if( maze.GetPosition(row, col).status != WALL )
+		// If a checkpoint of an unfinished search of this maze was saved, offer to resume it
+		if( checkpoint.Load(CHECKPOINT_FILE_NAME) && checkpoint.Matches(maze) &&
+			!checkpoint.IsFinished() )
 		{
-			// If the exit from the maze is not a wall
-			if( maze.GetPosition(numRows - 1, numCols - 1).status != WALL )
-			{
-				item.direction = SOUTH;
-
-				// If the stack is not full
-				if( !stack.IsFull() )
-				{
-					// Enter the maze
-					stack.Push(item);
-
-				} // End if
-				// Else the stack is full
-				else
-				{
-					cout << "Error: Stack is full." << endl;
-
-				} // End else
-
-				// Mark the entrance of the maze as visited
-				SetStatus(maze, row, col, VISITED);
-
-				// While the stack of directions is not empty
-				while( !stack.IsEmpty() )
-				{
-					// If at the exit from the maze
-					if(row == numRows - 1 && col == numCols -1)
-					{
-						item.direction = SOUTH;
-
-						// If the stack is not full
-						if( !stack.IsFull() )
-						{
-							// Exit the maze
-							stack.Push(item);
-
-						} // End if
-						// Else the stack is full
-						else
-						{
-							cout << "Error: Stack is full." << endl;
-
-						} // End else
-
-						// Copy the stack of directions
-						stackCopy = stack;
-
-						// While the copied stack of directions is not empty
-						while( !stackCopy.IsEmpty() )
-						{
-							// If the stack is not full
-							if( !printStack.IsFull() )
-							{
-								try
-								{
-									// Push the top item from the copied stack of directions onto the
-									//  stack used to print the directions
-									printStack.Push( stackCopy.Retrieve() );
+			cout << "An unfinished search of this maze was found. Resume it? (Y/N)" << endl;
+			answer.clear();
+			cin >> answer;
 
-								} // End try
-								catch(RetrieveOnEmptyException e)
-								{
-									cout << e.GetMessage() << endl;
+			resume = (answer.compare("Y") == 0) || (answer.compare("y") == 0);
 
-								} // End catch
-
-							} // End if
-							// Else the stack is full
-							else
-							{
-								cout << "Error: Stack is full." << endl;
-
-							} // End else
-
-							// Pop the top item from the copied stack of directions
-							stackCopy.Pop();
-
-						} // End while
-
-						// Print the solution # to the output file
-						dout << "Solution #" << solutionNumber << ":" << endl;
+		} // End if
 
-						// Print the path through the maze
-						PrintSolution(printStack, dout);
+		// If resuming, the output file must still hold every solution the checkpoint counts
+		if( resume && checkpoint.GetFormat() != SOLUTIONS_COUNT_ONLY )
+		{
+			outFileName = checkpoint.GetFormat() == SOLUTIONS_COMPACT ? COMPACT_OUT_FILE_NAME :
+																		OUT_FILE_NAME;
 
-						dout << endl << endl;
+			if( filesystem::file_size(outFileName, error) < uintmax_t(checkpoint.GetOutputSize()) ||
+				error )
+			{
+				cout << "The output file of the unfinished search is missing or cut short; starting "
+						"over." << endl;
+				resume = false;
 
-						// Pop the top item of the stack of directions
-						stack.Pop();
+			} // End if
+			// Else cut the output file back to what the checkpoint counts
+			else
+			{
+				filesystem::resize_file(outFileName, uintmax_t(checkpoint.GetOutputSize()), error);
 
-						// Mark the exit from the maze as unvisited
-						SetStatus(maze, row, col, UNVISITED);
+				if( error )
+				{
+					cout << "The output file of the unfinished search could not be cut back; starting "
+							"over." << endl;
+					resume = false;
 
-						// Backtrack to the previous location in the maze
-						BackTrack(stack, row, col);
+				} // End if
 
-						// Pop the top item of the stack of directions
-						stack.Pop();
+			} // End else
 
-						// Increment the solution # by one
-						solutionNumber++;
+		} // End if
 
-					} // End if
-					// If the location to the east of the current location in the maze is in the maze,
-					//  marked as unvisited, and has not yet been tried
-					else if( InBounds(row, col + 1, numRows, numCols) &&
-						maze.GetPosition(row, col + 1).status == UNVISITED &&
-						maze.GetPosition(row, col).triedEast == false )
-					{
-						// Mark the current location in the maze as tried going east before moving east
-						SetTriedEast(maze, row, col, true);
+		if( resume )
+		{
+			format = checkpoint.GetFormat();
 
-						item.direction = EAST;
+		} // End if
+		else
+		{
+			cout << "Write the solutions in compact form? (Y/N)" << endl;
+			answer.clear();
+			cin >> answer;
 
-						// If the stack is not full
-						if( !stack.IsFull() )
-						{
-							// Move east
-							stack.Push(item);
+			format = SOLUTIONS_TEXT;
 
-						} // End if
-						//
-						else
-						{
-							cout << "Error: Stack is full." << endl;
-
-						} // End else
+			if( (answer.compare("Y") == 0) || (answer.compare("y") == 0) )
+			{
+				format = SOLUTIONS_COMPACT;
 
-						// Increment col by one
-						col++;
+			} // End if
+			// Else ask whether to write them at all
+			else
+			{
+				cout << "Only count the solutions, without writing them? (Y/N)" << endl;
+				answer.clear();
+				cin >> answer;
 
-						// Set the new current location in the maze as visited
-						SetStatus(maze, row, col, VISITED);
+				if( (answer.compare("Y") == 0) || (answer.compare("y") == 0) )
+				{
+					format = SOLUTIONS_COUNT_ONLY;
 
-					} // End if
-					// Else if the location to the south of the current location in the maze is in the
-					//  maze, marked as unvisited, and has not yet been tried
-					else if( InBounds(row + 1, col, numRows, numCols) &&
-						maze.GetPosition(row + 1, col).status == UNVISITED &&
-						maze.GetPosition(row, col).triedSouth == false )
-					{
-						// Mark the current location in the maze as tried going south before moving
-						//  south
-						SetTriedSouth(maze, row, col, true);
+				} // End if
 
-						item.direction = SOUTH;
+			} // End else
 
-						// If the stack is not full
-						if( !stack.IsFull() )
-						{
-							// Move south
-							stack.Push(item);
+			checkpoint.SetMaze(maze, format);
 
-						} // End if
-						// Else the stack is full
-						else
-						{
-							cout << "Error: Stack is full." << endl;
+		} // End else
 
-						} // End else
+		//**********************************************************************************************
+		// Prompt for and get the limits of the search
 
-						// Increment row by one
-						row++;
+		cout << "Enter the most solutions to write in all, or 0 for no limit:" << endl;
+		answer.clear();
+		cin >> answer;
 
-						// Set the new current location in the maze as visited
-						SetStatus(maze, row, col, VISITED);
+		limits.maxSolutions = atoll(answer.c_str());
 
-					} // End else if
-					// Else if the location to the west of the current location in the maze is in the
-					//  maze, marked as unvisited, and has not yet been tried
-					else if( InBounds(row, col - 1, numRows, numCols) &&
-						maze.GetPosition(row, col - 1).status == UNVISITED &&
-						maze.GetPosition(row, col).triedWest == false )
-					{
-						// Mark the current location in the maze as tried going west before moving west
-						SetTriedWest(maze, row, col, true);
+		cout << "Enter the most seconds to search for, or 0 for no limit:" << endl;
+		answer.clear();
+		cin >> answer;
 
-						item.direction = WEST;
+		limits.maxSeconds = atof(answer.c_str());
+		limits.checkpointFileName = CHECKPOINT_FILE_NAME;
+		limits.checkpointSeconds = CHECKPOINT_SECONDS;
+		limits.reportSeconds = REPORT_SECONDS;
 
-						// If the stack is not full
-						if( !stack.IsFull() )
-						{
-							// Move west
-							stack.Push(item);
+		//**********************************************************************************************
+		// Discover and Print All Valid Paths Through the Maze
 
-						} // End if
-						// Else the stack is full
-						else
-						{
-							cout << "Error: Stack is full." << endl;
+		outFileName = format == SOLUTIONS_COMPACT ? COMPACT_OUT_FILE_NAME : OUT_FILE_NAME;
 
-						} // End else
+		// If resuming, open the output file, already cut back to what the checkpoint counts, at its end
+		if( resume && format != SOLUTIONS_COUNT_ONLY )
+		{
+			dout.open(outFileName.c_str(), format == SOLUTIONS_COMPACT ?
+										   ios::in | ios::out | ios::binary : ios::in | ios::out);
+			dout.seekp(0, ios::end);
 
-						// Decrement col by one
-						col--;
+		} // End if
+		// Else open a new output file and associate it with dout, unless only counting
+		else if(format == SOLUTIONS_COMPACT)
+		{
+			dout.open(outFileName.c_str(), ios::binary);
 
-						// Set the new current location in the maze as visited
-						SetStatus(maze, row, col, VISITED);
+		} // End else if
+		else if(format == SOLUTIONS_TEXT)
+		{
+			dout.open(outFileName.c_str());
 
-					} // End else if
-					// Else if the location to the north of the current location in the maze is in the
-					//  maze, marked as unvisited, and has not yet been tried
-					else if( InBounds(row - 1, col, numRows, numCols) &&
-						maze.GetPosition(row - 1, col).status == UNVISITED &&
-						maze.GetPosition(row, col).triedNorth == false )
-					{
-						// Mark the current location in the maze as tried going north before moving
-						//  north
-						SetTriedNorth(maze, row, col, true);
+		} // End else if
 
-						item.direction = NORTH;
+		// Instantiate the writer that formats the solutions into dout, carrying on from the
+		//  checkpoint if resuming
+		SolutionWriterClass writer(dout, format);
 
-						// If the stack is not full
-						if( !stack.IsFull() )
-						{
-							// Move north
-							stack.Push(item);
+		if( resume )
+		{
+			writer.Resume(checkpoint.GetNumSolutions());
 
-						} // End if
-						// Else the stack is full
-						else
-						{
-							cout << "Error: Stack is full." << endl;
+		} // End if
 
-						} // End else
+		// Go to the entrance of the maze
+		row = ROW_START;
+		col = COL_START;
 
-						// Decrement row by one
-						row--;
+		// If the entrance to the maze is not a wall
+		if( maze.GetStatus(row, col) != WALL )
+		{
+			// If the exit from the maze is not a wall
+			if( maze.GetStatus(numRows - 1, numCols - 1) != WALL )
+			{
+				// Find every path through the maze on every core, and write them in the order a
+				//  single-threaded search would find them
+				PathEnumeratorClass enumerator(maze, int(thread::hardware_concurrency()));
 
-						// Set the new current location in the maze as visited
-						SetStatus(maze, row, col, VISITED);
+				enumerator.Enumerate(writer, limits, checkpoint);
 
-					} // End else if
-					// Else nowhere to go
-					else
-					{
-						// Set the current location in the maze as unvisited and not tried going in any
-						//  direction
-						SetStatus(maze, row, col, UNVISITED);
-						SetTriedEast(maze, row, col, false);
-						SetTriedSouth(maze, row, col, false);
-						SetTriedWest(maze, row, col, false);
-						SetTriedNorth(maze, row, col, false);
+				// Print what the search did, when built to count it
+				SEARCH_STAT(enumerator.GetStats().WriteJson(cerr));
 
-						// Backtrack to the previous location in the maze
-						BackTrack(stack, row, col);
+				// If a limit stopped the search, tell how to carry on with it, unless its checkpoint
+				//  could not be saved
+				if( !checkpoint.IsFinished() && enumerator.IsCheckpointSaved() )
+				{
+					cout << "The search stopped after " << checkpoint.GetNumSolutions()
+						 << " solutions. Run the program again on the same maze to resume it." << endl;
 
-						// Pop the top item of the stack of directions
-						stack.Pop();
+				} // End if
+				else if( !checkpoint.IsFinished() )
+				{
+					cout << "The search stopped after " << checkpoint.GetNumSolutions()
+						 << " solutions, but no checkpoint could be saved to " << CHECKPOINT_FILE_NAME
+						 << ", so it cannot be resumed from there." << endl;
 
-					} // End else
+				} // End else if
+				// Else if the finished search could not be recorded, an older checkpoint may be left
+				else if( !enumerator.IsCheckpointSaved() )
+				{
+					cout << "The search finished, but no checkpoint could be saved to "
+						 << CHECKPOINT_FILE_NAME << " to record it." << endl;
 
-				} // End while
+				} // End else if
 
 			} // End if
 			// Else the exit to the maze is a wall
 			else
 			{
-				dout << "The exit to the maze is blocked." << endl;
+				(format == SOLUTIONS_TEXT ? dout : cout) << "The exit to the maze is blocked." << endl;
 
 			} // End else
 
@@ -565,14 +495,25 @@ void main()
 		// Else the entrance to the maze is a wall
 		else
 		{
-			dout << "The entrance to the maze is blocked." << endl;
+			(format == SOLUTIONS_TEXT ? dout : cout) << "The entrance to the maze is blocked." << endl;
 
 		} // End else
 
-		// Close the output file
+		// Write out what is left in the writer's buffer, ending a compact file with its end record,
+		//  and close the output file
+		writer.Finish();
 		dout.close();
 
-		cout << "All output has been sent to file: " << OUT_FILE_NAME << endl;
+		if(format == SOLUTIONS_COUNT_ONLY)
+		{
+			cout << "Solutions counted: " << writer.GetNumWritten() << endl;
+
+		} // End if
+		else
+		{
+			cout << "All output has been sent to file: " << outFileName << endl;
+
+		} // End else
 
 	} // End try
 	catch(RetrieveFromOutOfBoundsException e)
@@ -597,287 +538,4 @@ void main()
 
 	} // End catch
 
-} // End main()
-
-//******************************************************************************************************
-
-/*
-Purpose:	Determines if the location (row, col) is within the bounds of the maze.
-Pre:		numRows and numCols contain the # of rows and the # of columns in the maze, respectively.
-Post:		True has been returned if location (row, col) is within the bounds of the maze. Otherwise, 
-			false has been returned.
-*/
-bool InBounds(/* In */ int row,		// Row # of the location to check
-			  /* In */ int col,		// Column # of the location to check
-			  /* In */ int numRows,	// # of rows in the maze
-			  /* In */ int numCols)	// # of coluimns in the maze
-{
-	// Return true if the location (row, col) is within the maze, otherwise return false
-	return row >= 0 && row < numRows && col >= 0 && col < numCols;
-
-} // End InBounds(int row, int col, int numRows, int numCols)
-
-//******************************************************************************************************
-
-/*
-Purpose:	Prints the directions through the maze from start to finish to a file.
-Pre:		solution contains valid directions through the maze. dout has been associated with an output
-			file.
-Post:		The directions through the maze have been printed to the file associated with dout.
-*/
-void PrintSolution(/* In/Out */ StackClass& solution,	// Contains directions through the maze
-				   /* In/Out */ ofstream&   dout)		// Output file stream variable
-{
-	// While the stack is not empty
-	while( !solution.IsEmpty() )
-	{
-		try
-		{
-			// Branch depending on the direction on the top of the stack
-			switch( solution.Retrieve().direction )
-			{
-				case EAST: dout << "EAST "; break;
-
-				case SOUTH: dout << "SOUTH "; break;
-
-				case WEST: dout << "WEST "; break;
-
-				case NORTH: dout << "NORTH "; break;
-
-			} // End switch
-
-		} // End try
-		catch(RetrieveOnEmptyException e)
-		{
-			cout << e.GetMessage() << endl;
-
-		} // End catch
-
-		// Pop the top element from the stack
-		solution.Pop();
-
-	} // End while
-
-} // End PrintSolution(StackClass& solution, ofstream& dout)
-
-//******************************************************************************************************
-
-/*
-Purpose:	Determines the previous move in the maze and backtracks by setting row or col appropriately.
-Pre:		stack is not empty. (row, col) is the current location in the maze.
-Post:		(row, col) is the previous location in the maze.
-*/
-void BackTrack(/* In */		StackClass stack,	// Contains the directions through the maze thus far
-			   /* In/Out */ int&	   row,		// Row # in the maze
-			   /* In/Out */ int&	   col)		// Column # in the maze
-{
-	try
-	{
-		// Branch depending on the direction on the top of the stack
-		switch( stack.Retrieve().direction )
-		{
-			case EAST: col--; break;
-
-			case SOUTH: row--; break;
-
-			case WEST: col++; break;
-
-			case NORTH: row++; break;
-
-		} // End switch
-
-	} // End try
-	catch(RetrieveOnEmptyException e)
-	{
-		cout << e.GetMessage() << endl;
-
-	} // End catch
-
-} // End BackTrack(StackClass stack, int& row, int& col)
-
-//******************************************************************************************************
-
-/*
-Purpose:	Sets the status member of the MazePositionType struct at location (row, col) in the maze.
-Pre:		maze exists. (row, col) is a valid location within the maze.
-Post:		The status member of the MazePositionType struct at location (row, col) in the maze has been
-			set to newStatus.
-*/
-void SetStatus(/* In/Out */ MazeClass&   maze,		// The maze
-			   /* In */		int			 row,		// Row # in the maze
-			   /* In */		int			 col,		// Column # in the maze
-			   /* In */		PositionEnum newStatus)	// Value to set the status member of the
-													//  MazePositionType struct at location (row, col)
-													//  in the maze to
-{
-	MazePositionType position;	// A MazePositionType struct
-
-	try
-	{
-		// Assign position to the MazePositionType struct at location (row, col) in the maze
-		position = maze.GetPosition(row, col);
-
-		// Assign the status member of position
-		position.status = newStatus;
-
-		// Assign the MazePositionType struct at location (row, col) in the maze to position
-		maze.SetPosition(row, col, position);
-
-	} // End try
-	catch(RetrieveFromOutOfBoundsException e)
-	{
-		cout << e.GetMessage() << endl;
-
-	} // End catch
-
-} // End SetStatus(MazeClass& maze, int row, int col, PositionEnum newStatus)
-
-//******************************************************************************************************
-
-/*
-Purpose:	Sets the triedEast member of the MazePositionType struct at location (row, col) in the maze.
-Pre:		maze exists. (row, col) is a valid location within the maze.
-Post:		The triedEast member of the MazePositionType struct at location (row, col) in the maze has
-			been set to tried.
-*/
-void SetTriedEast(/* In/Out */ MazeClass& maze,		// The maze
-				  /* In */	   int		  row,		// Row # in the maze
-				  /* In */     int		  col,		// Column # in the maze
-				  /* In */     bool		  tried)	// Value to set the triedEast member of the
-													//  MazePositionType struct at location (row, col)
-													//  in the maze to
-{
-	MazePositionType position;	// An element in the maze
-
-	try
-	{
-		// Set position to the element at location (row, col) in the maze
-		position = maze.GetPosition(row, col);
-
-		// Set position.triedEast
-		position.triedEast = tried;
-
-		// Set the element at location (row, col) to position
-		maze.SetPosition(row, col, position);
-
-	} // End try
-	catch(RetrieveFromOutOfBoundsException e)
-	{
-		cout << e.GetMessage() << endl;
-
-	} // End catch
-
-} // End SetTriedEast(MazeClass& maze, int row, int col, bool tried)
-
-//******************************************************************************************************
-
-/*
-Purpose:	Sets the triedSouth member of the MazePositionType struct at location (row, col) in the
-			maze.
-Pre:		maze exists. (row, col) is a valid location within the maze.
-Post:		The triedSouth member of the MazePositionType struct at location (row, col) in the maze has
-			been set to tried.
-*/
-void SetTriedSouth(/* In/Out */ MazeClass& maze,	// The maze
-				   /* In */	    int		   row,		// Row # in the maze
-				   /* In */     int		   col,		// Column # in the maze
-				   /* In */     bool	   tried)	// Value to set the triedSouth member of the
-													//  MazePositionType struct at location (row, col)
-													//  in the maze to
-{
-	MazePositionType position;	// An element in the maze
-
-	try
-	{
-		// Set position to the element at location (row, col) in the maze
-		position = maze.GetPosition(row, col);
-
-		// Set position.triedSouth
-		position.triedSouth = tried;
-
-		// Set the element at location (row, col) to position
-		maze.SetPosition(row, col, position);
-
-	} // End try
-	catch(RetrieveFromOutOfBoundsException e)
-	{
-		cout << e.GetMessage() << endl;
-
-	} // End catch
-
-} // End SetTriedSouth(MazeClass& maze, int row, int col, bool tried)
-
-//******************************************************************************************************
-
-/*
-Purpose:	Sets the triedWest member of the MazePositionType struct at location (row, col) in the maze.
-Pre:		maze exists. (row, col) is a valid location within the maze.
-Post:		The triedWest member of the MazePositionType struct at location (row, col) in the maze has
-			been set to tried.
-*/
-void SetTriedWest(/* In/Out */ MazeClass& maze,		// The maze
-				  /* In */	   int		  row,		// Row # in the maze
-				  /* In */     int		  col,		// Column # in the maze
-				  /* In */     bool		  tried)	// Value to set the triedWest member of the
-													//  MazePositionType struct at location (row, col)
-													//  in the maze to
-{
-	MazePositionType position;	// An element in the maze
-
-	try
-	{
-		// Set position to the element at location (row, col) in the maze
-		position = maze.GetPosition(row, col);
-
-		// Set position.triedWest
-		position.triedWest = tried;
-
-		// Set the element at location (row, col) to position
-		maze.SetPosition(row, col, position);
-
-	} // End try
-	catch(RetrieveFromOutOfBoundsException e)
-	{
-		cout << e.GetMessage() << endl;
-
-	} // End catch
-
-} // End SetTriedWest(MazeClass& maze, int row, int col, bool tried)
-
-//******************************************************************************************************
-
-/*
-Purpose:	Sets the triedNorth member of the MazePositionType struct at location (row, col) in the
-			maze.
-Pre:		maze exists. (row, col) is a valid location within the maze.
-Post:		The triedNorth member of the MazePositionType struct at location (row, col) in the maze has
-			been set to tried.
-*/
-void SetTriedNorth(/* In/Out */ MazeClass& maze,	// The maze
-				   /* In */	    int		   row,		// Row # in the maze
-				   /* In */     int		   col,		// Column # in the maze
-				   /* In */     bool	   tried)	// Value to set the triedNorth member of the
-													//  MazePositionType struct at location (row, col)
-													//  in the maze to
-{
-	MazePositionType position;	// An element in the maze
-
-	try
-	{
-		// Set position to the element at location (row, col) in the maze
-		position = maze.GetPosition(row, col);
-
-		// Set position.triedNorth
-		position.triedNorth = tried;
-
-		// Set the element at location (row, col) to position
-		maze.SetPosition(row, col, position);
-
-	} // End try
-	catch(RetrieveFromOutOfBoundsException e)
-	{
-		cout << e.GetMessage() << endl;
-
-	} // End catch
-
-} // End SetTriedNorth(MazeClass& maze, int row, int col, bool tried)
\ No newline at end of file
+} // End main()
\ No newline at end of file
@@ -0,0 +1,114 @@
+/*
+AUTHOR:
+	Chris Pray
+
+DATE:
+	10/19/26
+
+FILENAME:
+	convert.cpp
+
+PURPOSE:
+	This file converts a maze file from one format to the other: a text maze file, as read by
+	client.cpp, to a binary maze file, or a binary maze file back to a text maze file. The binary
+	format is described in mazefile.h. A large corpus of mazes can be converted once and then loaded
+	by client.cpp at the speed the disk can supply it.
+
+INPUT:
+	The names of the input file and the output file are given on the command line:
+		convert inFile outFile
+	The format of the input file is told from its contents.
+
+PROCESSING:
+	The input file is opened with a MazeFileClass object, which maps it into memory and reads the
+	dimensions of its maze. A MazeClass object gets instantiated with these dimensions and the walls
+	are loaded into it. Then the maze is saved to the output file in the other format.
+
+OUTPUT:
+	The converted maze is written to the output file. A message telling which conversion was done,
+	or why none could be, is output to the console.
+
+ASSUMPTIONS:
+	(1) A text input file is in the format client.cpp reads.
+
+EXCEPTION HANDLING:
+	(1) nmspcMazeExceptions::OutOfMemoryException
+			Thrown on a failure to dynamically allocate memory when instantiating a MazeClass object, or
+			when loading or saving the maze.
+*/
+
+// Header Files / Libraries
+#include "maze.h"		// For use of MazeClass objects
+#include "mazefile.h"	// For use of MazeFileClass objects
+#include<iostream>		// For standard input/output
+#include<string>		// For string datatype
+#include<cstdlib>		// For EXIT_SUCCESS and EXIT_FAILURE
+using namespace std;
+
+// Constants
+const int NUM_ARGUMENTS = 3;	// # of command line arguments, counting the program name
+
+int main(/* In */ int argc,		// # of command line arguments
+		 /* In */ char* argv[])	// The command line arguments
+{
+	// Variables
+	MazeFileClass mazeFile;		// The input file
+	bool saved;					// Gets true if the output file was written
+
+	// If the file names were not both given
+	if(argc != NUM_ARGUMENTS)
+	{
+		cout << "Usage: convert inFile outFile" << endl;
+		return EXIT_FAILURE;
+
+	} // End if
+
+	// If the input file could not be opened as a maze file
+	if( !mazeFile.Open(argv[1]) )
+	{
+		cout << "File not found or not a maze file: " << argv[1] << endl;
+		return EXIT_FAILURE;
+
+	} // End if
+
+	try
+	{
+		// Instantiate the maze with the file's dimensions and build its walls
+		MazeClass maze(mazeFile.GetNumRows(), mazeFile.GetNumCols());
+
+		mazeFile.LoadWalls(maze);
+
+		// Save the maze in the other format
+		if( mazeFile.IsBinary() )
+		{
+			saved = MazeFileClass::SaveText(maze, argv[2]);
+
+		} // End if
+		else
+		{
+			saved = MazeFileClass::SaveBinary(maze, argv[2]);
+
+		} // End else
+
+		if( !saved )
+		{
+			cout << "Could not write file: " << argv[2] << endl;
+			return EXIT_FAILURE;
+
+		} // End if
+
+		cout << "Converted " << (mazeFile.IsBinary() ? "binary" : "text") << " maze file " << argv[1]
+			 << " to " << (mazeFile.IsBinary() ? "text" : "binary") << " maze file " << argv[2] << "."
+			 << endl;
+
+	} // End try
+	catch(nmspcMazeExceptions::OutOfMemoryException e)
+	{
+		cout << e.GetMessage() << endl;
+		return EXIT_FAILURE;
+
+	} // End catch
+
+	return EXIT_SUCCESS;
+
+} // End main()
\ No newline at end of file
@@ -0,0 +1,281 @@
+/*
+AUTHOR:
+	Chris Pray
+
+DATE:
+	10/19/26
+
+FILENAME:
+	countcheck.cpp
+
+PURPOSE:
+	This file checks PathCounterClass against PathEnumeratorClass on small mazes, without any
+	prompts, so that it can be run from a script. For each maze, the number of paths counted by
+	CountPaths, the number returned by BuildDiagram and the number of paths NextPath gets from the
+	diagram must all equal the number of paths the enumerator finds. A maze whose entrance or exit
+	is a wall has no paths, and is not given to the enumerator, which assumes both are open.
+
+INPUT:
+	The # of random mazes to check and the seed to generate them from may be given on the command
+	line:
+		countcheck [mazes [seed]]
+	The defaults are 500 mazes and seed 1.
+
+PROCESSING:
+	A fixed set of mazes is checked first: mazes of one location, open grids, and mazes with the
+	entrance, the exit or both walled off. Then random mazes of 1 to 6 rows and 1 to 6 columns are
+	built with a MazeGeneratorClass object, of every family, with the entrance and the exit walled off
+	now and then. The enumerator runs on two threads, and only counts its solutions.
+
+OUTPUT:
+	A line is output to the console for each maze whose counts do not agree, giving its walls and
+	the counts, followed by the # of mazes checked and the # that failed. The program exits with
+	EXIT_FAILURE if any failed.
+
+ASSUMPTIONS:
+	None
+
+EXCEPTION HANDLING:
+	(1) nmspcMazeExceptions::OutOfMemoryException
+			Thrown on a failure to dynamically allocate memory for a MazeClass, PathCounterClass or
+			PathEnumeratorClass object. It is reported and the program exits.
+	(2) nmspcStackExceptions::OutOfMemoryException
+			Thrown on a failure to dynamically allocate memory for a StackClass operation. It is
+			reported and the program exits.
+*/
+
+// Header Files / Libraries
+#include "maze.h"			// For use of MazeClass objects
+#include "enumerator.h"		// For use of PathEnumeratorClass objects
+#include "mazegen.h"		// For use of MazeGeneratorClass objects
+#include "pathcount.h"		// For use of PathCounterClass objects
+#include "solutionfile.h"	// For use of SolutionWriterClass objects
+#include<cstdint>			// For uint64_t
+#include<cstdlib>			// For atoi, strtoull, EXIT_SUCCESS and EXIT_FAILURE
+#include<fstream>			// For ofstream
+#include<iostream>			// For standard output
+#include<random>			// For mt19937_64
+#include<string>			// For string datatype
+using namespace std;
+
+// Constants
+const int DEFAULT_NUM_MAZES = 500;	// # of random mazes checked when not given
+const int MAX_DIMENSION = 6;		// Most rows or columns of a random maze
+const int NUM_FAMILIES = 5;			// # of maze families in MazeFamilyEnum
+const int NUM_THREADS = 2;			// # of threads the enumerator searches with
+const int NUM_FIXED_MAZES = 9;		// # of mazes in FIXED_MAZES
+const int WALLED_END_ODDS = 10;		// One random maze in this many has its entrance walled off, and
+									//  one in this many its exit
+
+// The fixed mazes, one string per maze with its rows separated by '/'; '#' is a wall
+const char* const FIXED_MAZES[NUM_FIXED_MAZES] = { ".", "#", "..", "../..", "..../..../..../....",
+												   "#./.#", "##..#/....#", "#../.../..#",
+												   "#../..." };
+
+// Prototypes
+MazeClass BuildMaze(const string&);
+	// Builds the maze described by a fixed maze string.
+string DescribeMaze(const MazeClass&);
+	// Returns the walls of a maze as a fixed maze string.
+bool CheckMaze(const MazeClass&);
+	// Counts the paths of a maze every way and reports them if they do not agree.
+
+
+int main(/* In */ int argc,		// # of command line arguments
+		 /* In */ char* argv[])	// The command line arguments
+{
+	// Variables
+	int numMazes = argc > 1 ? atoi(argv[1]) : DEFAULT_NUM_MAZES;	// # of random mazes to check
+	int numChecked = 0;		// # of mazes checked
+	int numFailed = 0;		// # of mazes whose counts did not agree
+	int numRows;			// # of rows of a random maze
+	int numCols;			// # of columns of a random maze
+	uint64_t seed = argc > 2 ? strtoull(argv[2], NULL, 10) : 1;	// Seed of the random mazes
+	mt19937_64 random(seed);	// Picks the dimensions and the walled ends of the random mazes
+
+	try
+	{
+		MazeGeneratorClass generator(seed);
+
+		// Check the fixed mazes
+		for(int i = 0; i < NUM_FIXED_MAZES; i++)
+		{
+			numFailed += CheckMaze(BuildMaze(FIXED_MAZES[i])) ? 0 : 1;
+			numChecked++;
+
+		} // End for
+
+		// Check random mazes of every family, walling off the entrance or the exit now and then
+		for(int i = 0; i < numMazes; i++)
+		{
+			numRows = 1 + int(random() % MAX_DIMENSION);
+			numCols = 1 + int(random() % MAX_DIMENSION);
+
+			MazeClass maze(numRows, numCols);
+
+			generator.Generate(maze, MazeFamilyEnum(i % NUM_FAMILIES), 0.3);
+
+			if(random() % WALLED_END_ODDS == 0)
+			{
+				maze.SetStatus(0, 0, WALL);
+
+			} // End if
+
+			if(random() % WALLED_END_ODDS == 0)
+			{
+				maze.SetStatus(numRows - 1, numCols - 1, WALL);
+
+			} // End if
+
+			numFailed += CheckMaze(maze) ? 0 : 1;
+			numChecked++;
+
+		} // End for
+
+	} // End try
+	catch(nmspcMazeExceptions::OutOfMemoryException e)
+	{
+		cout << e.GetMessage() << endl;
+		return EXIT_FAILURE;
+
+	} // End catch
+	catch(nmspcStackExceptions::OutOfMemoryException e)
+	{
+		cout << e.GetMessage() << endl;
+		return EXIT_FAILURE;
+
+	} // End catch
+
+	cout << numChecked << " mazes checked, " << numFailed << " failed." << endl;
+
+	return numFailed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+
+} // End main()
+
+//******************************************************************************************************
+
+/*
+Purpose:	Builds the maze described by a fixed maze string.
+Pre:		description holds one or more rows of the same length, separated by '/', in which '#' is a
+			wall and any other character an open location.
+Post:		The maze has been returned.
+Exceptions:	OutOfMemoryException
+*/
+MazeClass BuildMaze(/* In */ const string& description)	// The rows of the maze
+{
+	int numRows = 1;	// # of rows in description
+	size_t numCols = description.find('/');	// # of columns in description
+
+	if(numCols == string::npos)
+	{
+		numCols = description.size();
+
+	} // End if
+
+	for(size_t i = 0; i < description.size(); i++)
+	{
+		numRows += description[i] == '/' ? 1 : 0;
+
+	} // End for
+
+	MazeClass maze(numRows, int(numCols));
+
+	for(int r = 0; r < numRows; r++)
+	{
+		for(int c = 0; c < int(numCols); c++)
+		{
+			if(description[r * (numCols + 1) + c] == '#')
+			{
+				maze.SetStatus(r, c, WALL);
+
+			} // End if
+
+		} // End for
+
+	} // End for
+
+	return maze;
+
+} // End BuildMaze(const string& description)
+
+//******************************************************************************************************
+
+/*
+Purpose:	Returns the walls of a maze in the form of the fixed maze strings.
+Pre:		maze has been built.
+Post:		The rows of the maze, separated by '/', with '#' for each wall and '.' for each open
+			location, have been returned.
+*/
+string DescribeMaze(/* In */ const MazeClass& maze)	// The maze to describe
+{
+	string description;		// The rows described so far
+
+	for(int r = 0; r < maze.GetNumRows(); r++)
+	{
+		if(r > 0)
+		{
+			description += '/';
+
+		} // End if
+
+		for(int c = 0; c < maze.GetNumCols(); c++)
+		{
+			description += maze.GetStatus(r, c) == WALL ? '#' : '.';
+
+		} // End for
+
+	} // End for
+
+	return description;
+
+} // End DescribeMaze(const MazeClass& maze)
+
+//******************************************************************************************************
+
+/*
+Purpose:	Counts the paths of a maze with CountPaths, BuildDiagram, NextPath and, if its entrance and
+			exit are open, PathEnumeratorClass, and reports the maze if the counts do not agree.
+Pre:		maze has been built, with no location VISITED.
+Post:		If the counts differ, or a maze with a walled entrance or exit has a path, the maze and
+			its counts have been output to the console and false has been returned. Otherwise true
+			has been returned.
+Exceptions:	OutOfMemoryException
+*/
+bool CheckMaze(/* In */ const MazeClass& maze)	// The maze to check
+{
+	PathCounterClass counter(maze);		// Counts the paths without enumerating them
+	ofstream dout;						// Left unopened; the enumerator only counts
+	SolutionWriterClass writer(dout, SOLUTIONS_COUNT_ONLY);	// Counts the enumerator's solutions
+	string counted = counter.CountPaths().ToString();		// Paths counted by CountPaths
+	string built = counter.BuildDiagram().ToString();		// Paths counted by BuildDiagram
+	string directions;				// A path got from the diagram
+	long long numIterated = 0;		// # of paths got from the diagram
+	long long numEnumerated = 0;	// # of paths found by the enumerator
+
+	while( counter.NextPath(directions) )
+	{
+		numIterated++;
+
+	} // End while
+
+	// Only a maze with both ends open is searched; the others have no paths
+	if(maze.GetStatus(0, 0) != WALL &&
+	   maze.GetStatus(maze.GetNumRows() - 1, maze.GetNumCols() - 1) != WALL)
+	{
+		PathEnumeratorClass enumerator(maze, NUM_THREADS);
+
+		numEnumerated = enumerator.Enumerate(writer);
+
+	} // End if
+
+	if(counted != to_string(numEnumerated) || built != counted || numIterated != numEnumerated)
+	{
+		cout << DescribeMaze(maze) << ": CountPaths " << counted << ", BuildDiagram " << built
+			 << ", NextPath " << numIterated << ", enumerator " << numEnumerated << endl;
+		return false;
+
+	} // End if
+
+	return true;
+
+} // End CheckMaze(const MazeClass& maze)
\ No newline at end of file
@@ -0,0 +1,126 @@
+/*
+AUTHOR:
+	Chris Pray
+
+DATE:
+	10/19/26
+
+FILENAME:
+	decode.cpp
+
+PURPOSE:
+	This file turns a compact solution file, as written by client.cpp when asked for compact form,
+	back into the text client.cpp writes otherwise: each path labeled "Solution #N:", followed by its
+	directions and a blank line. The compact format is described in solutionfile.h.
+
+INPUT:
+	The names of the input file and the output file are given on the command line:
+		decode inFile outFile
+
+PROCESSING:
+	The input file is opened with a SolutionReaderClass object, which checks that it is a compact
+	solution file. Each solution is read in turn, its shared directions taken from the solution
+	before it and the rest unpacked, and handed to a SolutionWriterClass object that writes it to the
+	output file as text.
+
+OUTPUT:
+	The solutions are written to the output file as text. A message telling how many were decoded,
+	or why none could be, is output to the console. If the input file is cut short or corrupt, the
+	solutions before the damage are written, and the message says where it was found.
+
+ASSUMPTIONS:
+	(1) The input file was written by a SolutionWriterClass object in compact form.
+
+EXCEPTION HANDLING:
+	(1) nmspcMazeExceptions::OutOfMemoryException
+			Thrown on a failure to dynamically allocate memory when reading or writing the solutions.
+*/
+
+// Header Files / Libraries
+#include "solutionfile.h"	// For use of SolutionReaderClass and SolutionWriterClass objects
+#include<iostream>			// For standard input/output
+#include<fstream>			// For file output
+#include<vector>			// For vector
+#include<cstdlib>			// For EXIT_SUCCESS and EXIT_FAILURE
+using namespace std;
+
+// Constants
+const int NUM_ARGUMENTS = 3;	// # of command line arguments, counting the program name
+
+int main(/* In */ int argc,		// # of command line arguments
+		 /* In */ char* argv[])	// The command line arguments
+{
+	// Variables
+	SolutionReaderClass reader;		// Reads the input file
+	ofstream dout;					// Output file stream variable
+	vector<unsigned char> moves;	// The directions of the current solution
+
+	// If the file names were not both given
+	if(argc != NUM_ARGUMENTS)
+	{
+		cout << "Usage: decode inFile outFile" << endl;
+		return EXIT_FAILURE;
+
+	} // End if
+
+	try
+	{
+		// If the input file could not be opened as a compact solution file
+		if( !reader.Open(argv[1]) )
+		{
+			cout << "File not found or not a compact solution file: " << argv[1] << endl;
+			return EXIT_FAILURE;
+
+		} // End if
+
+		dout.open(argv[2]);
+
+		if( !dout )
+		{
+			cout << "Could not write file: " << argv[2] << endl;
+			return EXIT_FAILURE;
+
+		} // End if
+
+		// Write each solution as text
+		SolutionWriterClass writer(dout, SOLUTIONS_TEXT);
+
+		while( reader.ReadSolution(moves) )
+		{
+			writer.WriteSolution(moves.data(), int(moves.size()));
+
+		} // End while
+
+		writer.Flush();
+		dout.close();
+
+		// If the file ended before its end record, or the end record does not count what was read
+		if( !reader.IsComplete() )
+		{
+			cout << "File is cut short or corrupt after " << reader.GetNumRead() << " solutions: "
+				 << argv[1] << endl;
+			return EXIT_FAILURE;
+
+		} // End if
+
+		if( dout.fail() )
+		{
+			cout << "Could not write file: " << argv[2] << endl;
+			return EXIT_FAILURE;
+
+		} // End if
+
+		cout << "Decoded " << reader.GetNumRead() << " solutions from " << argv[1] << " to " << argv[2]
+			 << "." << endl;
+
+	} // End try
+	catch(nmspcMazeExceptions::OutOfMemoryException e)
+	{
+		cout << e.GetMessage() << endl;
+		return EXIT_FAILURE;
+
+	} // End catch
+
+	return EXIT_SUCCESS;
+
+} // End main()
\ No newline at end of file
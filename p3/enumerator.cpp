@@ -0,0 +1,1053 @@
+/*
+AUTHOR:
+	Chris Pray
+
+DATE:
+	10/19/26
+
+FILENAME:
+	enumerator.cpp
+
+PURPOSE:
+	This file contains the implementation for all of the methods declared in enumerator.h
+*/
+
+#include "enumerator.h"
+#include "pruner.h"	// For MazePrunerClass
+#include<algorithm>	// For min
+#include<chrono>	// For steady_clock
+#include<cmath>		// For HUGE_VAL
+#include<new>		// For bad_alloc
+#include<system_error>	// For system_error
+#include<thread>	// For thread
+
+const int ENTRANCE_ROW = 0;		// Row of the entrance to the maze
+const int ENTRANCE_COL = 0;		// Column of the entrance to the maze
+const int NUM_DIRECTIONS = 4;	// # of directions a search can move in
+
+// The directions a search tries from each location, in the order it tries them, with the tried flag
+//  and the change in row and column for each
+const DirectionEnum SEARCH_ORDER[NUM_DIRECTIONS] = { EAST, SOUTH, WEST, NORTH };
+const TriedEnum SEARCH_TRIED[NUM_DIRECTIONS] = { TRIED_EAST, TRIED_SOUTH, TRIED_WEST, TRIED_NORTH };
+const int ROW_STEPS[NUM_DIRECTIONS] = { 0, 1, 0, -1 };
+const int COL_STEPS[NUM_DIRECTIONS] = { 1, 0, -1, 0 };
+
+// The place of each DirectionEnum in SEARCH_ORDER, indexed by DirectionEnum
+const int SEARCH_RANK[NUM_DIRECTIONS] = { 3, 1, 0, 2 };
+
+// Where the subtree of a task lies against the route of a checkpoint, in depth-first order
+const int TASK_SEARCHED = -1;	// Wholly before the route, or within the subtree it ends at
+const int TASK_RESUMED = 0;		// The route runs through it
+const int TASK_UNSEARCHED = 1;	// Wholly after the route
+
+
+//***************************************************************************************
+//*																						*
+//*								File-scope Helpers										*
+//*																						*
+//***************************************************************************************
+
+/*
+Purpose:	Moves (row, col) one location in direction.
+Pre:		None
+Post:		(row, col) is the location one move in direction from where it was.
+*/
+static void Step(/* In */	  const DirectionEnum direction,	// The direction to move
+				 /* In/Out */ int&				  row,			// Row # in the maze
+				 /* In/Out */ int&				  col)			// Column # in the maze
+{
+	// Branch depending on the direction
+	switch( direction )
+	{
+		case EAST: col++; break;
+
+		case SOUTH: row++; break;
+
+		case WEST: col--; break;
+
+		case NORTH: row--; break;
+
+	} // End switch
+
+} // End Step(DirectionEnum direction, int& row, int& col)
+
+//***************************************************************************************
+
+/*
+Purpose:	Moves (row, col) back one location against direction.
+Pre:		None
+Post:		(row, col) is the location (row, col) was reached from by a move in direction.
+*/
+static void StepBack(/* In */	  const DirectionEnum direction,	// The direction last moved
+					 /* In/Out */ int&				  row,			// Row # in the maze
+					 /* In/Out */ int&				  col)			// Column # in the maze
+{
+	// Branch depending on the direction
+	switch( direction )
+	{
+		case EAST: col--; break;
+
+		case SOUTH: row--; break;
+
+		case WEST: col++; break;
+
+		case NORTH: row++; break;
+
+	} // End switch
+
+} // End StepBack(DirectionEnum direction, int& row, int& col)
+
+//***************************************************************************************
+
+/*
+Purpose:	Appends the directions on a stack to buffer, one DirectionEnum per byte, from the bottom
+			of the stack to the top, for a SolutionWriterClass object to format.
+Pre:		solution contains valid directions through the maze, the first move at the bottom.
+Post:		The directions followed by a newline have been appended to buffer. solution is
+			unchanged.
+*/
+static void AppendSolution(/* In */		const StackClass& solution,	// Directions through the maze
+						   /* In/Out */ string&			  buffer)	// Gets the directions
+{
+	// For each direction on the stack, from the bottom to the top
+	for(const ItemType& move : solution)
+	{
+		buffer += char(move.direction);
+
+	} // End for
+
+	buffer += '\n';
+
+} // End AppendSolution(const StackClass& solution, string& buffer)
+
+//***************************************************************************************
+
+/*
+Purpose:	Tells where the subtree of the paths that start with prefix lies against route, in
+			depth-first order, when every path up to route, and every path that starts with it, has
+			been searched.
+Pre:		prefix and route hold moves from the entrance, one DirectionEnum per byte. route is not
+			empty.
+Post:		TASK_SEARCHED has been returned if the subtree comes wholly before route or lies within
+			the subtree route ends at, TASK_RESUMED if prefix is the start of route, and
+			TASK_UNSEARCHED if the subtree comes wholly after route.
+*/
+static int PlaceTask(/* In */ const vector<unsigned char>& prefix,	// The moves to the task
+					 /* In */ const vector<unsigned char>& route)	// The moves searched up to
+{
+	// For each move the two share a place for
+	for(size_t i = 0; i < prefix.size() && i < route.size(); i++)
+	{
+		// If they part, the one whose move is tried first comes first
+		if(prefix[i] != route[i])
+		{
+			return SEARCH_RANK[prefix[i]] < SEARCH_RANK[route[i]] ? TASK_SEARCHED : TASK_UNSEARCHED;
+
+		} // End if
+
+	} // End for
+
+	return prefix.size() <= route.size() ? TASK_RESUMED : TASK_SEARCHED;
+
+} // End PlaceTask(const vector<unsigned char>& prefix, const vector<unsigned char>& route)
+
+//***************************************************************************************
+
+/*
+Purpose:	Returns the time since start.
+Pre:		None
+Post:		The # of seconds since start has been returned.
+*/
+static double SecondsSince(/* In */ const chrono::steady_clock::time_point start)	// The start
+{
+	return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+} // End SecondsSince(chrono::steady_clock::time_point start)
+
+
+//***************************************************************************************
+//*																						*
+//*						Non-default Constructor, Destructor								*
+//*																						*
+//***************************************************************************************
+
+// Non-default Constructor
+PathEnumeratorClass::PathEnumeratorClass(/* In */ const MazeClass& setMaze,		// The maze to search
+										 /* In */ const int		   setNumThreads)	// # of threads
+	: maze(setMaze), stats(setNumThreads)
+{
+	numThreads = setNumThreads < 1 ? 1 : setNumThreads;
+	outputs = NULL;
+	deques = NULL;
+	resumeTask = -1;
+	stopping = false;
+	outOfMemory = false;
+	numNodes = 0;
+	checkpointSaved = false;
+
+	// Wall off the dead ends and the blocks off the path from the entrance to the exit in the copy
+	//  of the maze, so that no task ever walks into them
+	MazePrunerClass pruner(maze);	// Finds the locations no path can pass through
+
+	pruner.SealDeadEnds();
+	pruner.SealOffPath();
+	pruner.Apply(maze);
+
+	try
+	{
+		// Dynamically allocate a deque of tasks for each worker thread
+		deques = new WorkerDequeType[numThreads];
+
+	} // End try
+	catch(bad_alloc e)
+	{
+		throw nmspcMazeExceptions::OutOfMemoryException("OutOfMemoryException: The heap has run out "
+			"of memory.");
+
+	} // End catch
+
+} // End PathEnumeratorClass(const MazeClass& setMaze, int setNumThreads)
+
+//***************************************************************************************
+
+// Destructor
+PathEnumeratorClass::~PathEnumeratorClass()
+{
+	delete [] outputs;
+	delete [] deques;
+
+} // End ~PathEnumeratorClass()
+
+
+//***************************************************************************************
+//*																						*
+//*									Search												*
+//*																						*
+//***************************************************************************************
+
+long long PathEnumeratorClass::Enumerate(/* In/Out */ SolutionWriterClass& writer)	// Writes them
+{
+	EnumerateLimitsType limits;		// No limits, and no checkpoint file
+	CheckpointClass checkpoint;		// A search that has not started
+
+	limits.maxSolutions = 0;
+	limits.maxSeconds = 0;
+	limits.checkpointSeconds = 0;
+	limits.reportSeconds = 0;
+
+	return Enumerate(writer, limits, checkpoint);
+
+} // End Enumerate(SolutionWriterClass& writer)
+
+//***************************************************************************************
+
+long long PathEnumeratorClass::Enumerate(/* In/Out */ SolutionWriterClass&		 writer,	// Writer
+										 /* In */	  const EnumerateLimitsType& limits,	// Limits
+										 /* In/Out */ CheckpointClass&			 checkpoint)	// Start
+{
+	const chrono::steady_clock::time_point startTime = chrono::steady_clock::now();	// When the
+																					//  search began
+	double endSeconds = HUGE_VAL;			// Seconds into the search to stop at
+	double checkpointSeconds = HUGE_VAL;	// Seconds into the search to save the next checkpoint at
+	vector<thread> workers;			// The worker threads
+	vector<unsigned char> route;	// The route written up to, for the checkpoint
+	string text;				// Solutions taken from a task's slot, to be written
+	long long numWritten = 0;	// # of solutions written
+	size_t numTasksWritten = 0;	// # of tasks all of whose solutions have been written
+	int place;					// Where a task lies against the checkpoint's route
+	bool done;					// True once every solution of the current task has been taken
+	bool failed = false;		// True if memory ran out, or no worker could be started
+	bool noWorkers = false;		// True if no worker could be started
+	bool limited;				// True once a limit stops the search
+	bool draining = false;		// True once the workers have been stopped for the time limit
+	size_t t;					// Index of the task whose solutions are being written
+	size_t start;				// Index in text of the first character of a solution
+	size_t end;					// Index in text of the newline that ends a solution
+	size_t lastStart;			// Index in text of the first character of the last solution written
+	size_t lastEnd = 0;			// Index in text of the newline that ends it
+
+	checkpointSaved = false;
+
+	// If the search already finished, there is nothing left to write
+	if( checkpoint.IsFinished() )
+	{
+		return 0;
+
+	} // End if
+
+	limited = limits.maxSolutions > 0 && writer.GetNumWritten() >= limits.maxSolutions;
+
+	if(limits.maxSeconds > 0)
+	{
+		endSeconds = limits.maxSeconds;
+
+	} // End if
+
+	if( !limits.checkpointFileName.empty() && limits.checkpointSeconds > 0 )
+	{
+		checkpointSeconds = limits.checkpointSeconds;
+
+	} // End if
+
+	try
+	{
+		// Split the search into tasks and give each an empty output slot
+		SplitTasks();
+
+		delete [] outputs;
+		outputs = NULL;
+		outputs = new TaskOutputType[tasks.size()];
+
+		route = checkpoint.GetRoute();
+		resumeRoute = route;
+		resumeTask = -1;
+
+		// Mark the tasks the checkpoint has already searched done, and find the one it runs through
+		for(size_t i = 0; i < tasks.size(); i++)
+		{
+			place = route.empty() ? TASK_UNSEARCHED : PlaceTask(tasks[i].prefix, route);
+			outputs[i].skipped = place == TASK_SEARCHED;
+			outputs[i].done = outputs[i].skipped;
+
+			if(place == TASK_RESUMED)
+			{
+				resumeTask = int(i);
+
+			} // End if
+
+		} // End for
+
+		// Deal the tasks left out to the workers round-robin, so each worker starts on early tasks and
+		//  the slots fill roughly in the order they are written
+		for(size_t i = 0; i < tasks.size(); i++)
+		{
+			if( !outputs[i].done )
+			{
+				deques[i % numThreads].tasks.push_back(int(i));
+
+			} // End if
+
+		} // End for
+
+		stopping = false;
+		outOfMemory = false;
+
+		// Start printing the counts, if asked, and then the workers
+		SEARCH_STAT(stats.StartReporting(limits.reportSeconds));
+
+		workers.reserve(numThreads);
+
+		for(int w = 0; w < numThreads; w++)
+		{
+			try
+			{
+				workers.push_back(thread(&PathEnumeratorClass::RunWorker, this, w));
+
+			} // End try
+			catch(system_error e)
+			{
+				// The system will not start another thread; the workers already running steal the
+				//  tasks dealt to the others
+				break;
+
+			} // End catch
+
+		} // End for
+
+	} // End try
+	catch(bad_alloc e)
+	{
+		failed = true;
+
+	} // End catch
+
+	// If not one worker could be started, nothing can be searched
+	if(workers.empty() && !failed)
+	{
+		failed = true;
+		noWorkers = true;
+
+	} // End if
+
+	// Write the solutions of each task in turn, as they are handed over, until a limit is reached
+	for(t = 0; t < tasks.size() && !failed && !limited; t++)
+	{
+		done = false;
+
+		while( !done && !failed && !limited )
+		{
+			{
+				unique_lock<mutex> guard(outputLock);
+
+				// Wait until the task has solutions to write or has finished, or it is time to stop
+				//  or to save a checkpoint, unless the workers have stopped
+				while( outputs[t].text.empty() && !outputs[t].done && !outOfMemory && !draining &&
+					   SecondsSince(startTime) < min(endSeconds, checkpointSeconds) )
+				{
+					if(min(endSeconds, checkpointSeconds) == HUGE_VAL)
+					{
+						outputReady.wait(guard);
+
+					} // End if
+					else
+					{
+						outputReady.wait_for(guard, chrono::duration<double>(
+						min(endSeconds, checkpointSeconds) - SecondsSince(startTime)));
+
+					} // End else
+
+				} // End while
+
+				text.swap(outputs[t].text);
+				done = outputs[t].done;
+				failed = outOfMemory;
+
+			} // End lock
+
+			// The slot is empty again; let a worker waiting to add to it carry on
+			slotDrained.notify_all();
+
+			lastStart = string::npos;
+
+			// Write each solution, until the limit on solutions is reached
+			for(start = 0; start < text.size() && !failed && !limited; start = end + 1)
+			{
+				end = text.find('\n', start);
+
+				try
+				{
+					writer.WriteSolution(reinterpret_cast<const unsigned char*>(text.data()) + start,
+										 int(end - start));
+					numWritten++;
+					lastStart = start;
+					lastEnd = end;
+
+				} // End try
+				catch(nmspcMazeExceptions::OutOfMemoryException e)
+				{
+					failed = true;
+
+				} // End catch
+
+				limited = limits.maxSolutions > 0 && writer.GetNumWritten() >= limits.maxSolutions;
+
+			} // End for
+
+			try
+			{
+				// If every solution of the task has been written, the search has got past its
+				//  subtree; else it has got to the last solution written, without its moves into and
+				//  out of the maze. A task the checkpoint had searched leaves the route as it is.
+				if(done && start >= text.size() && !failed)
+				{
+					if( !outputs[t].skipped )
+					{
+						route = tasks[t].prefix;
+
+					} // End if
+
+					numTasksWritten = t + 1;
+
+				} // End if
+				else if(lastStart != string::npos)
+				{
+					route.assign(text.begin() + lastStart + 1, text.begin() + lastEnd - 1);
+
+				} // End else if
+
+			} // End try
+			catch(bad_alloc e)
+			{
+				failed = true;
+
+			} // End catch
+
+			text.clear();
+
+			// If the workers have stopped and this task was cut short, nothing after it can be
+			//  written
+			if(draining && !done)
+			{
+				limited = true;
+
+			} // End if
+
+			// If the time is up, stop the workers, and then write what they had already found, up
+			//  to the first task they cut short
+			if(SecondsSince(startTime) >= endSeconds && !draining)
+			{
+				StopWorkers(workers);
+				draining = true;
+				failed = failed || outOfMemory;
+
+			} // End if
+
+			// If it is time, save a checkpoint
+			if(SecondsSince(startTime) >= checkpointSeconds && !failed && !limited && !draining)
+			{
+				try
+				{
+					checkpoint.SetProgress(route, writer.GetNumWritten(), writer.Sync(), false);
+					checkpointSaved = checkpoint.Save(limits.checkpointFileName);
+
+				} // End try
+				catch(nmspcMazeExceptions::OutOfMemoryException e)
+				{
+					failed = true;
+
+				} // End catch
+
+				checkpointSeconds = SecondsSince(startTime) + limits.checkpointSeconds;
+
+			} // End if
+
+		} // End while
+
+		// Return the finished slot's memory
+		string().swap(outputs[t].text);
+
+	} // End for
+
+	writer.Flush();
+
+	// Stop any workers still running, and the printing of the counts
+	StopWorkers(workers);
+	SEARCH_STAT(stats.StopReporting());
+
+	// Drop any tasks left undealt
+	for(int w = 0; w < numThreads; w++)
+	{
+		deques[w].tasks.clear();
+
+	} // End for
+
+	// Record where the search got to, and save it
+	if( !failed )
+	{
+		try
+		{
+			checkpoint.SetProgress(route, writer.GetNumWritten(), writer.Sync(),
+								   numTasksWritten == tasks.size());
+
+			if( !limits.checkpointFileName.empty() )
+			{
+				checkpointSaved = checkpoint.Save(limits.checkpointFileName);
+
+			} // End if
+
+		} // End try
+		catch(nmspcMazeExceptions::OutOfMemoryException e)
+		{
+			failed = true;
+
+		} // End catch
+
+	} // End if
+
+	if(noWorkers)
+	{
+		throw nmspcMazeExceptions::OutOfMemoryException("OutOfMemoryException: No thread could be "
+			"started to search the maze on.");
+
+	} // End if
+
+	if(failed)
+	{
+		throw nmspcMazeExceptions::OutOfMemoryException("OutOfMemoryException: The heap has run out "
+			"of memory.");
+
+	} // End if
+
+	return numWritten;
+
+} // End Enumerate(SolutionWriterClass& writer, const EnumerateLimitsType& limits, ...)
+
+//***************************************************************************************
+
+void PathEnumeratorClass::SplitTasks()
+{
+	vector<unsigned char> prefix;	// The moves from the entrance to the current location
+	const size_t target = numThreads == 1 ? 1 : size_t(TASKS_PER_THREAD) * numThreads;	// # of
+																						//  tasks
+																						//  wanted
+	int splitDepth = 0;		// # of moves to split the search at
+	bool deeper;			// True if some task was cut off before reaching the exit
+
+	maze.SetStatus(ENTRANCE_ROW, ENTRANCE_COL, VISITED);
+
+	// Split one move deeper until there are enough tasks, or splitting deeper cannot add more
+	do
+	{
+		tasks.clear();
+
+		// Start the counts over with the entrance, so that the moves to the tasks are counted once,
+		//  as the last split makes them, and the tasks count only the moves below them
+		numNodes = 1;
+		SEARCH_STAT(stats.Reset());
+		SEARCH_STAT(stats.AddExpanded(0, 1));
+
+		deeper = SplitFrom(ENTRANCE_ROW, ENTRANCE_COL, splitDepth, prefix);
+		splitDepth++;
+
+	} while( deeper && tasks.size() < target && splitDepth <= MAX_SPLIT_DEPTH );
+
+	maze.SetStatus(ENTRANCE_ROW, ENTRANCE_COL, UNVISITED);
+
+} // End SplitTasks()
+
+//***************************************************************************************
+
+bool PathEnumeratorClass::SplitFrom(/* In */	 const int				row,		// Row #
+									/* In */	 const int				col,		// Column #
+									/* In */	 const int				splitDepth,	// # of moves
+																					//  to split at
+									/* In/Out */ vector<unsigned char>& prefix)		// The moves to
+																					//  (row, col)
+{
+	bool deeper = false;	// True if a task below (row, col) was cut off before the exit
+	int nextRow;			// Row # of a neighbouring location
+	int nextCol;			// Column # of a neighbouring location
+
+	// If at the exit from the maze, the path is a task of its own
+	if(row == maze.GetNumRows() - 1 && col == maze.GetNumCols() - 1)
+	{
+		tasks.push_back(PathTaskType());
+		tasks.back().prefix = prefix;
+		return false;
+
+	} // End if
+
+	// If the exit can no longer be reached, no task below (row, col) has a solution
+	if( !maze.CanReachExit(row, col) )
+	{
+		SEARCH_STAT(stats.AddPruned(0));
+		SEARCH_STAT(stats.AddBacktrack(0));
+		return false;
+
+	} // End if
+
+	// If the path is long enough, the subtree below (row, col) is a task
+	if(int(prefix.size()) == splitDepth)
+	{
+		tasks.push_back(PathTaskType());
+		tasks.back().prefix = prefix;
+		return true;
+
+	} // End if
+
+	// For each direction, in the order the search tries them
+	for(int d = 0; d < NUM_DIRECTIONS; d++)
+	{
+		nextRow = row + ROW_STEPS[d];
+		nextCol = col + COL_STEPS[d];
+
+		// If the neighbour in that direction is in the maze and unvisited
+		if( nextRow >= 0 && nextRow < maze.GetNumRows() && nextCol >= 0 &&
+			nextCol < maze.GetNumCols() && maze.GetStatus(nextRow, nextCol) == UNVISITED )
+		{
+			// Move to the neighbour, split the tasks below it, and move back
+			maze.SetStatus(nextRow, nextCol, VISITED);
+			prefix.push_back((unsigned char)SEARCH_ORDER[d]);
+			numNodes++;
+			SEARCH_STAT(stats.AddExpanded(0, int(prefix.size()) + 1));
+
+			deeper = SplitFrom(nextRow, nextCol, splitDepth, prefix) || deeper;
+
+			prefix.pop_back();
+			maze.SetStatus(nextRow, nextCol, UNVISITED);
+
+		} // End if
+
+	} // End for
+
+	// Every direction has been tried, so the search backs out of (row, col)
+	SEARCH_STAT(stats.AddBacktrack(0));
+
+	return deeper;
+
+} // End SplitFrom(int row, int col, int splitDepth, vector<unsigned char>& prefix)
+
+//***************************************************************************************
+
+void PathEnumeratorClass::RunWorker(/* In */ const int worker)	// Index of the worker
+{
+	string buffer;	// Solutions found by the current task and not yet handed over
+	int task;		// Index of the current task
+	bool finished;	// True if the current task was searched to the end
+
+	try
+	{
+		MazeClass workerMaze(maze);		// The worker's own copy of the maze
+		StackClass stack;				// The worker's stack of directions
+
+		// A path visits each location at most once, plus the move out of the exit
+		stack.Reserve(workerMaze.GetNumRows() * workerMaze.GetNumCols() + 1);
+
+		// While there is a task to run or take, run it and hand over what is left of its solutions,
+		//  marking it done unless it was stopped before it finished
+		while( !stopping && TakeTask(worker, task) )
+		{
+			finished = SearchTask(worker, task, workerMaze, stack, buffer);
+			HandOver(task, buffer, finished);
+
+		} // End while
+
+	} // End try
+	catch(bad_alloc e)
+	{
+		StopOnOutOfMemory();
+
+	} // End catch
+	catch(nmspcMazeExceptions::OutOfMemoryException e)
+	{
+		StopOnOutOfMemory();
+
+	} // End catch
+	catch(nmspcStackExceptions::OutOfMemoryException e)
+	{
+		StopOnOutOfMemory();
+
+	} // End catch
+
+} // End RunWorker(int worker)
+
+//***************************************************************************************
+
+bool PathEnumeratorClass::TakeTask(/* In */  const int worker,	// Index of the worker
+								   /* Out */ int&	   task)	// Gets the index of the task
+{
+	int victim;		// Index of a worker to steal from
+
+	// Take the lowest task from the worker's own deque
+	{
+		lock_guard<mutex> guard(deques[worker].lock);
+
+		if( !deques[worker].tasks.empty() )
+		{
+			task = deques[worker].tasks.front();
+			deques[worker].tasks.pop_front();
+			return true;
+
+		} // End if
+
+	} // End lock
+
+	// Else steal the highest task from the first other worker that has one
+	for(int i = 1; i < numThreads; i++)
+	{
+		victim = (worker + i) % numThreads;
+
+		lock_guard<mutex> guard(deques[victim].lock);
+
+		if( !deques[victim].tasks.empty() )
+		{
+			task = deques[victim].tasks.back();
+			deques[victim].tasks.pop_back();
+			return true;
+
+		} // End if
+
+	} // End for
+
+	return false;
+
+} // End TakeTask(int worker, int& task)
+
+//***************************************************************************************
+
+bool PathEnumeratorClass::SearchTask(/* In */	  [[maybe_unused]] const int worker,	// Worker index
+									 /* In */	  const int	  task,			// Index of the task
+									 /* In/Out */ MazeClass&  workerMaze,	// The worker's maze
+									 /* In/Out */ StackClass& stack,		// The worker's stack
+									 /* In/Out */ string&	  buffer)		// The worker's buffer
+{
+	const vector<unsigned char>& prefix = tasks[task].prefix;	// The moves to the task's location
+	const int numRows = workerMaze.GetNumRows();	// # of rows in the maze
+	const int numCols = workerMaze.GetNumCols();	// # of columns in the maze
+	ItemType item;			// An item to be pushed onto the stack
+	int row = ENTRANCE_ROW;	// A row # in the maze
+	int col = ENTRANCE_COL;	// A column # in the maze
+	int taskLength;			// # of directions on the stack at the task's location
+	int nextRow;			// Row # of a neighbouring location
+	int nextCol;			// Column # of a neighbouring location
+	bool moved;				// True if a move was made from the current location
+	long long nodes = 0;	// # of locations moved into below the task's location
+	bool finished;			// True if the search backtracked out of the task's location
+
+	// Enter the maze and follow the prefix to the task's location, marking each location visited
+	item.direction = SOUTH;
+	stack.Push(item);
+	workerMaze.SetStatus(row, col, VISITED);
+
+	for(size_t i = 0; i < prefix.size(); i++)
+	{
+		item.direction = DirectionEnum(prefix[i]);
+		stack.Push(item);
+		Step(item.direction, row, col);
+		workerMaze.SetStatus(row, col, VISITED);
+
+	} // End for
+
+	taskLength = stack.GetLength();
+
+	// If the search of this task was interrupted, follow the rest of the route it had reached,
+	//  marking each direction up to the one taken tried, as the search had left them
+	if(task == resumeTask)
+	{
+		for(size_t i = prefix.size(); i < resumeRoute.size(); i++)
+		{
+			for(int d = 0; d <= SEARCH_RANK[resumeRoute[i]]; d++)
+			{
+				workerMaze.SetTried(row, col, SEARCH_TRIED[d], true);
+
+			} // End for
+
+			item.direction = DirectionEnum(resumeRoute[i]);
+			stack.Push(item);
+			Step(item.direction, row, col);
+			workerMaze.SetStatus(row, col, VISITED);
+
+		} // End for
+
+		// Every path that starts with the route has been searched too; if the route is a solution,
+		//  backtrack out of the exit, as the search did after recording it
+		if(row == numRows - 1 && col == numCols - 1)
+		{
+			workerMaze.SetStatus(row, col, UNVISITED);
+			StepBack(stack.Peek().direction, row, col);
+			stack.Pop();
+
+		} // End if
+		// Else leave no direction from the end of the route to try
+		else
+		{
+			for(int d = 0; d < NUM_DIRECTIONS; d++)
+			{
+				workerMaze.SetTried(row, col, SEARCH_TRIED[d], true);
+
+			} // End for
+
+		} // End else
+
+	} // End if
+
+	// While the search has not backtracked out of the task's location
+	while( stack.GetLength() >= taskLength && !stopping )
+	{
+		// If at the exit from the maze
+		if(row == numRows - 1 && col == numCols - 1)
+		{
+			// Exit the maze and record the path
+			item.direction = SOUTH;
+			stack.Push(item);
+			AppendSolution(stack, buffer);
+			stack.Pop();
+			SEARCH_STAT(stats.AddSolution(worker));
+
+			// Mark the exit unvisited and backtrack to the previous location
+			workerMaze.SetStatus(row, col, UNVISITED);
+			StepBack(stack.Peek().direction, row, col);
+			stack.Pop();
+			SEARCH_STAT(stats.AddBacktrack(worker));
+
+			// If enough solutions have gathered, hand them to the writer
+			if(buffer.size() >= size_t(SOLUTION_CHUNK_SIZE))
+			{
+				HandOver(task, buffer, false);
+
+			} // End if
+
+		} // End if
+		// Else if the current location has just been entered, and the exit can no longer be reached
+		//  from it without crossing the path so far
+		else if( !workerMaze.WasTried(row, col, TRIED_EAST) &&
+			!workerMaze.WasTried(row, col, TRIED_SOUTH) &&
+			!workerMaze.WasTried(row, col, TRIED_WEST) &&
+			!workerMaze.WasTried(row, col, TRIED_NORTH) &&
+			!workerMaze.CanReachExit(row, col) )
+		{
+			// Mark the location unvisited and backtrack to the previous location
+			workerMaze.ResetPosition(row, col);
+			StepBack(stack.Peek().direction, row, col);
+			stack.Pop();
+			SEARCH_STAT(stats.AddPruned(worker));
+			SEARCH_STAT(stats.AddBacktrack(worker));
+
+		} // End else if
+		// Else move in the first direction not yet tried, if there is one
+		else
+		{
+			moved = false;
+
+			for(int d = 0; d < NUM_DIRECTIONS && !moved; d++)
+			{
+				nextRow = row + ROW_STEPS[d];
+				nextCol = col + COL_STEPS[d];
+
+				// If the neighbour in that direction is in the maze, unvisited and not yet tried
+				if( nextRow >= 0 && nextRow < numRows && nextCol >= 0 && nextCol < numCols &&
+					workerMaze.GetStatus(nextRow, nextCol) == UNVISITED &&
+					!workerMaze.WasTried(row, col, SEARCH_TRIED[d]) )
+				{
+					// Mark the direction tried, then move to the neighbour and mark it visited
+					workerMaze.SetTried(row, col, SEARCH_TRIED[d], true);
+					item.direction = SEARCH_ORDER[d];
+					stack.Push(item);
+					row = nextRow;
+					col = nextCol;
+					workerMaze.SetStatus(row, col, VISITED);
+					moved = true;
+					nodes++;
+					SEARCH_STAT(stats.AddExpanded(worker, stack.GetLength()));
+
+				} // End if
+
+			} // End for
+
+			// If there was nowhere to go
+			if( !moved )
+			{
+				// Mark the location unvisited with no directions tried and backtrack
+				workerMaze.ResetPosition(row, col);
+				StepBack(stack.Peek().direction, row, col);
+				stack.Pop();
+				SEARCH_STAT(stats.AddBacktrack(worker));
+
+			} // End if
+
+		} // End else
+
+	} // End while
+
+	finished = stack.GetLength() < taskLength;
+
+	// Unmark the rest of the path back to the entrance
+	while( !stack.IsEmpty() )
+	{
+		workerMaze.ResetPosition(row, col);
+		StepBack(stack.Peek().direction, row, col);
+		stack.Pop();
+
+	} // End while
+
+	numNodes += nodes;
+
+	return finished;
+
+} // End SearchTask(int worker, int task, MazeClass& workerMaze, StackClass& stack, string& buffer)
+
+//***************************************************************************************
+
+void PathEnumeratorClass::HandOver(/* In */		const int task,		// Index of the task
+								   /* In/Out */ string&	  buffer,	// Solutions found by the task
+								   /* In */		const bool done)	// True if the task has finished
+{
+	unique_lock<mutex> guard(outputLock);
+
+	// If the slot is full, wait until the writer reaches the task and empties it, so that a worker
+	//  running ahead of the writer holds only so many solutions
+	while( outputs[task].text.size() >= size_t(MAX_SLOT_SIZE) && !stopping )
+	{
+		slotDrained.wait(guard);
+
+	} // End while
+
+	// If the slot is empty, give it the buffer itself rather than a copy
+	if( outputs[task].text.empty() )
+	{
+		outputs[task].text.swap(buffer);
+
+	} // End if
+	else
+	{
+		outputs[task].text += buffer;
+
+	} // End else
+
+	buffer.clear();
+	outputs[task].done = done;
+	outputReady.notify_one();
+
+} // End HandOver(int task, string& buffer, bool done)
+
+//***************************************************************************************
+
+void PathEnumeratorClass::StopWorkers(/* In/Out */ vector<thread>& workers)	// The worker threads
+{
+	// Set stopping under the lock, so that a worker waiting for its slot to be emptied sees it
+	{
+		lock_guard<mutex> guard(outputLock);
+
+		stopping = true;
+
+	} // End lock
+
+	slotDrained.notify_all();
+
+	for(size_t w = 0; w < workers.size(); w++)
+	{
+		workers[w].join();
+
+	} // End for
+
+	workers.clear();
+
+} // End StopWorkers(vector<thread>& workers)
+
+//***************************************************************************************
+
+void PathEnumeratorClass::StopOnOutOfMemory()
+{
+	lock_guard<mutex> guard(outputLock);
+
+	outOfMemory = true;
+	stopping = true;
+	outputReady.notify_one();
+	slotDrained.notify_all();
+
+} // End StopOnOutOfMemory()
+
+
+//***************************************************************************************
+//*																						*
+//*								Observer / Accessor										*
+//*																						*
+//***************************************************************************************
+
+int PathEnumeratorClass::GetNumThreads() const
+{
+	return numThreads;
+
+} // End GetNumThreads()
+
+//***************************************************************************************
+
+int PathEnumeratorClass::GetNumTasks() const
+{
+	return int(tasks.size());
+
+} // End GetNumTasks()
+
+//***************************************************************************************
+
+long long PathEnumeratorClass::GetNumNodes() const
+{
+	return numNodes;
+
+} // End GetNumNodes()
+
+//***************************************************************************************
+
+bool PathEnumeratorClass::IsCheckpointSaved() const
+{
+	return checkpointSaved;
+
+} // End IsCheckpointSaved()
+
+//***************************************************************************************
+
+const SearchStatsClass& PathEnumeratorClass::GetStats() const
+{
+	return stats;
+
+} // End GetStats()
\ No newline at end of file
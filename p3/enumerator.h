@@ -0,0 +1,442 @@
+/*
+AUTHOR:
+	Chris Pray
+
+DATE:
+	10/19/26
+
+FILENAME:
+	enumerator.h
+
+PURPOSE:
+	This file contains the specification for PathEnumeratorClass, which finds every valid path through
+	a MazeClass object, from the entrance at (0, 0) to the exit at (numRows - 1, numCols - 1), on
+	several threads at once, and writes them in the same order a single-threaded depth-first search
+	would find them.
+
+	The search is split into tasks at a shallow depth. Starting from the entrance, the paths are
+	followed depth first, trying east, south, west and then north, until they are splitDepth moves
+	long. Each path reached this way, or that reaches the exit sooner, becomes a task holding its
+	moves as a compact prefix of one byte per move. splitDepth is the smallest depth that gives every
+	thread TASKS_PER_THREAD tasks, so that a thread that draws small subtrees can take work from one
+	that draws large ones.
+
+	Before the search, a MazePrunerClass object walls off every location of the enumerator's copy of
+	the maze that no path can pass through: dead-end corridors, and side chambers that hang off the
+	way from the entrance to the exit by a single location. The search never enters them, which
+	spares it walking into each one and backing out again on every path that passes it by.
+
+	Each worker thread owns a copy of the maze and a deque of tasks; the tasks are dealt out round-robin
+	in depth-first order. A worker takes tasks from the front of its own deque, and when that runs dry
+	it steals from the back of another worker's deque. To run a task, the worker marks the prefix
+	visited in its copy of the maze, which rebuilds the task's visited bitboard, searches the subtree
+	below it the way client.cpp always has, with a StackClass of directions and the tried flags of the
+	maze, and then unmarks the prefix.
+
+	Solutions are gathered in a per-thread buffer, one byte per move, and handed, a chunk of whole
+	solutions at a time, to the slot of the task that found them. The calling thread hands the slots
+	to a SolutionWriterClass object in task order, which numbers and formats the solutions as it goes,
+	so the output is the same no matter how many threads run or which of them runs which task. A slot
+	holds at most about MAX_SLOT_SIZE bytes: a worker that fills the slot of a task the writer has not
+	reached yet waits until the writer reaches it, so that workers running ahead of the writer do not
+	hold all of their solutions in memory.
+
+	A search can be stopped early: once a number of solutions have been written in all, or once a
+	number of seconds have passed. When the time is up, the workers are stopped first, and then the
+	solutions they had already handed over are written, in order, up to the first task they cut
+	short, so that a short time limit still makes headway. While it runs, and when it stops, the
+	calling thread records in a CheckpointClass object the route it has written up to, and every so
+	often saves it to a checkpoint file, after flushing the output file so that the file holds every
+	solution the checkpoint counts. A search given a checkpoint resumes from it: the tasks wholly
+	before its route in depth-first order, or within the subtree the route ends at, are not run, and
+	the task the route runs through follows it again after its prefix, marking every direction up to
+	the one it takes tried at each location. That rebuilds the visited locations and tried
+	directions the interrupted search had there, so the search carries on with the first path after
+	the route.
+
+	When built with SEARCH_STATS defined, each worker records into its own slot of a SearchStatsClass
+	object the locations it moves into below its tasks and their depths, its backtracks, its
+	solutions and the locations it drops because the exit can no longer be reached, and the counts
+	are printed to cerr every limits.reportSeconds seconds while the search runs. The entrance, and
+	the moves that split the search into tasks, are recorded once in the first slot as they are
+	split, so that the counts do not depend on the # of threads. Built without it, the search does
+	no counting beyond GetNumNodes.
+
+ASSUMPTIONS:
+	(1) The entrance and the exit of the maze are not walls.
+	(2) The maze is not changed while Enumerate runs.
+
+EXCEPTION HANDLING:
+	bad_alloc is caught if an attempt to allocate dynamic memory fails, on the calling thread or on a
+	worker thread, and nmspcMazeExceptions::OutOfMemoryException is thrown in its place from the
+	constructor or from Enumerate. The worker threads are stopped and joined before it is thrown. If
+	the system will not start as many worker threads as asked for, Enumerate searches with those it
+	could start, and if it could start none, OutOfMemoryException is thrown.
+
+SUMMARY OF METHODS:
+
+	PathEnumeratorClass(const MazeClass& setMaze, int setNumThreads)
+		Instantiates a PathEnumeratorClass object that searches a copy of setMaze with setNumThreads
+		threads.
+
+	~PathEnumeratorClass()
+		Returns all dynamically allocated memory of a PathEnumeratorClass object back to the heap.
+
+	long long Enumerate(SolutionWriterClass& writer)
+		Writes every valid path through the maze with writer, and returns the number of paths written.
+
+	long long Enumerate(SolutionWriterClass& writer, const EnumerateLimitsType& limits,
+						CheckpointClass& checkpoint)
+		Writes the valid paths after the checkpoint's route with writer, until limits stop it, and
+		returns the number of paths written.
+
+	int GetNumThreads() const
+		Returns the number of threads the search runs on.
+
+	int GetNumTasks() const
+		Returns the number of tasks the last search was split into.
+
+	long long GetNumNodes() const
+		Returns the number of locations the last search moved into.
+
+	bool IsCheckpointSaved() const
+		Returns true if the last search saved its checkpoint when it stopped.
+
+	const SearchStatsClass& GetStats() const
+		Returns what the last search did, as counted when built with SEARCH_STATS.
+*/
+
+#ifndef PathEnumerator_h
+#define PathEnumerator_h
+
+#include "maze.h"				// For MazeClass
+#include "checkpoint.h"			// For CheckpointClass
+#include "searchstats.h"		// For SearchStatsClass
+#include "solutionfile.h"		// For SolutionWriterClass
+#include "stack.H"				// For StackClass
+#include<atomic>				// For atomic
+#include<condition_variable>	// For condition_variable
+#include<deque>					// For deque
+#include<mutex>					// For mutex
+#include<string>				// For string
+#include<thread>				// For thread
+#include<vector>				// For vector
+using namespace std;
+
+const int TASKS_PER_THREAD = 16;			// # of tasks to split off for each thread
+const int MAX_SPLIT_DEPTH = 48;				// Longest prefix a task is split off at
+const int SOLUTION_CHUNK_SIZE = 1 << 20;	// # of bytes of solutions a worker gathers before handing
+											//  them to the writer
+const int MAX_SLOT_SIZE = 4 * SOLUTION_CHUNK_SIZE;	// # of bytes of solutions a task's slot holds
+													//  before its worker waits for the writer
+
+struct PathTaskType
+{
+	vector<unsigned char> prefix;	// The moves from the entrance to the task's location, one
+									//  DirectionEnum per byte, not counting the move into the maze
+
+}; // End PathTaskType
+
+struct TaskOutputType
+{
+	string text;	// Solutions found by the task and not yet written; one DirectionEnum per move and a
+					//  newline after each solution
+	bool done;		// True once the task has handed over all of its solutions
+	bool skipped;	// True if the checkpoint resumed from had already searched the task
+
+}; // End TaskOutputType
+
+struct EnumerateLimitsType
+{
+	long long maxSolutions;		// Stop once this many solutions have been written in all, counting
+								//  those of the search resumed from, or 0 for no limit
+	double maxSeconds;			// Stop once the search has run this many seconds, or 0 for no limit
+	string checkpointFileName;	// File to save checkpoints to, or empty to save none
+	double checkpointSeconds;	// # of seconds between checkpoints, or 0 to save only when stopping
+	double reportSeconds;		// # of seconds between progress reports to cerr, when built with
+								//  SEARCH_STATS, or 0 for none
+
+}; // End EnumerateLimitsType
+
+struct WorkerDequeType
+{
+	mutex lock;			// Guards tasks
+	deque<int> tasks;	// Indexes of the tasks waiting to be run, lowest first
+
+}; // End WorkerDequeType
+
+class PathEnumeratorClass
+{
+	public:
+
+		// Constructor and Destructor
+
+		PathEnumeratorClass(/* In */ const MazeClass& setMaze,		// The maze to search
+							/* In */ const int		  setNumThreads);	// # of threads to search with
+		/*
+		Purpose:			Instantiates a PathEnumeratorClass object that searches a copy of setMaze
+							with setNumThreads threads. If setNumThreads is less than one, one thread
+							is used. The locations of the copy that no valid path passes through are
+							walled off.
+		Pre:				setMaze has been built. No location of setMaze is VISITED.
+		Post:				A PathEnumeratorClass object has been instantiated.
+		Classification:		Non-default Constructor
+		Order of Magnitude:	O(N * M), where N = # of rows and M = # of columns in setMaze
+		Exceptions Thrown:	OutOfMemoryException
+		*/
+
+		~PathEnumeratorClass();
+		/*
+		Purpose:			Returns all dynamically allocated memory of a PathEnumeratorClass object
+							back to the heap.
+		Pre:				A PathEnumeratorClass object has been instantiated.
+		Post:				All dynamically allocated memory of the object has been returned to the
+							heap.
+		Classification:		Destructor
+		Order of Magnitude:	O(T), where T = # of threads
+		*/
+
+
+		// ADT PathEnumeratorClass Operations
+
+		long long Enumerate(/* In/Out */ SolutionWriterClass& writer);	// Writes the solutions
+		/*
+		Purpose:			Finds every valid path through the maze and writes each with writer, from
+							the move into the maze to the move out of it, in the order a
+							single-threaded depth-first search would find them.
+		Pre:				writer has been instantiated for an output file. The entrance and the exit
+							of the maze are not walls.
+		Post:				Every valid path has been written with writer, and writer has been flushed.
+							The number of paths written has been returned.
+		Classification:		Mutator
+		Order of Magnitude:	O(P / T) in the best case, where P = # of locations visited by the search
+							and T = # of threads
+		Exceptions Thrown:	OutOfMemoryException
+		*/
+
+		long long Enumerate(/* In/Out */ SolutionWriterClass&		writer,			// Writes them
+							/* In */	 const EnumerateLimitsType& limits,			// When to stop
+							/* In/Out */ CheckpointClass&			checkpoint);	// Where to start
+		/*
+		Purpose:			Finds the valid paths through the maze that come after the checkpoint's
+							route in depth-first order and writes each with writer, as the other
+							Enumerate does, until every one has been written or limits stop the
+							search. The checkpoint is kept up to date as the search goes, and saved
+							to limits.checkpointFileName, if one is given, every
+							limits.checkpointSeconds seconds and when the search stops. A checkpoint
+							that cannot be saved is skipped, and IsCheckpointSaved tells whether the
+							last one was saved.
+		Pre:				checkpoint has been set for the maze, or loaded and matched against it. If
+							its route is not empty, writer has been resumed from its # of solutions,
+							on an output file cut back to its output size. The entrance and the exit
+							of the maze are not walls.
+		Post:				The paths after the route have been written with writer, up to the limits,
+							and writer has been flushed. checkpoint holds the route written up to, the
+							# of solutions written in all, the size of the output file and whether the
+							search finished. The number of paths written by this call has been
+							returned; it is 0 if checkpoint had already finished.
+		Classification:		Mutator
+		Order of Magnitude:	O(P / T) in the best case, where P = # of locations visited by the search
+							and T = # of threads
+		Exceptions Thrown:	OutOfMemoryException
+		*/
+
+		int GetNumThreads() const;
+		/*
+		Purpose:			Returns the number of threads the search runs on.
+		Pre:				A PathEnumeratorClass object has been instantiated.
+		Post:				The number of threads has been returned.
+		Classification:		Observer / Accessor
+		Order of Magnitude:	O(1)
+		*/
+
+		int GetNumTasks() const;
+		/*
+		Purpose:			Returns the number of tasks the last call to Enumerate split the search
+							into.
+		Pre:				A PathEnumeratorClass object has been instantiated.
+		Post:				The number of tasks has been returned, or 0 if Enumerate has not been
+							called.
+		Classification:		Observer / Accessor
+		Order of Magnitude:	O(1)
+		*/
+
+		long long GetNumNodes() const;
+		/*
+		Purpose:			Returns the number of locations the last call to Enumerate moved into,
+							counting the entrance and the moves that lead to the tasks once each, so
+							that it does not depend on the number of threads.
+		Pre:				A PathEnumeratorClass object has been instantiated.
+		Post:				The number of locations has been returned, or 0 if Enumerate has not been
+							called.
+		Classification:		Observer / Accessor
+		Order of Magnitude:	O(1)
+		*/
+
+		bool IsCheckpointSaved() const;
+		/*
+		Purpose:			Determines whether the last call to Enumerate saved its checkpoint to
+							limits.checkpointFileName when it stopped.
+		Pre:				A PathEnumeratorClass object has been instantiated.
+		Post:				True has been returned if the checkpoint was saved when the search stopped.
+							False has been returned if it could not be saved, if no checkpoint file
+							was given, or if Enumerate has not been called.
+		Classification:		Observer / Predicator
+		Order of Magnitude:	O(1)
+		*/
+
+		const SearchStatsClass& GetStats() const;
+		/*
+		Purpose:			Returns the counts the last call to Enumerate recorded of what its workers
+							did, when built with SEARCH_STATS.
+		Pre:				A PathEnumeratorClass object has been instantiated.
+		Post:				The counts have been returned. Every count is 0 if Enumerate has not been
+							called, or if SEARCH_STATS was not defined.
+		Classification:		Observer / Accessor
+		Order of Magnitude:	O(1)
+		*/
+
+
+	private:
+
+		PathEnumeratorClass(/* In */ const PathEnumeratorClass& orig);
+		void operator=(/* In */ const PathEnumeratorClass& orig);
+		/*
+		Purpose:			Not defined; a PathEnumeratorClass object holds locks and cannot be copied.
+		*/
+
+		void SplitTasks();
+		/*
+		Purpose:			Replaces tasks with the paths found by following the maze depth first from
+							the entrance until they are splitDepth moves long or reach the exit, for
+							the smallest splitDepth that gives TASKS_PER_THREAD tasks per thread, up to
+							MAX_SPLIT_DEPTH. Paths that can no longer reach the exit are dropped.
+		Pre:				The maze has no VISITED locations.
+		Post:				tasks holds the tasks in depth-first order. The maze has no VISITED
+							locations. numNodes and stats hold only the entrance and the moves of the
+							last split.
+		Classification:		Mutator
+		Order of Magnitude:	O(S * D), where S = # of paths of up to splitDepth moves and D = splitDepth
+		Exceptions Thrown:	bad_alloc
+		*/
+
+		bool SplitFrom(/* In */		const int			   row,			// Row # of the location
+					   /* In */		const int			   col,			// Column # of the location
+					   /* In */		const int			   splitDepth,	// # of moves to split at
+					   /* In/Out */ vector<unsigned char>& prefix);		// The moves to (row, col)
+		/*
+		Purpose:			Adds a task for every path that extends prefix to splitDepth moves or to
+							the exit, in depth-first order.
+		Pre:				Location (row, col) is VISITED and is reached from the entrance by prefix.
+		Post:				The tasks have been added. prefix and the maze are unchanged. Each move
+							from (row, col) on the way to a task's location has been counted in
+							numNodes and the first slot of stats, along with each location dropped
+							and each backtrack out of a location that is not a task's. True has been
+							returned if a task was cut off at splitDepth before reaching the exit,
+							false otherwise.
+		Classification:		Mutator
+		Order of Magnitude:	O(S * D), where S = # of paths added and D = splitDepth
+		Exceptions Thrown:	bad_alloc
+		*/
+
+		void RunWorker(/* In */ const int worker);	// Index of the worker
+		/*
+		Purpose:			Runs tasks on the calling thread until none are left to run or take, then
+							hands each task's solutions to the writer.
+		Pre:				The tasks have been dealt to the worker deques.
+		Post:				Every task this worker took has been run and its solutions handed over,
+							and marked done unless stopping cut it short. If memory ran out,
+							outOfMemory is true and stopping is set.
+		Classification:		Mutator
+		Order of Magnitude:	O(P), where P = # of locations visited in the tasks this worker ran
+		*/
+
+		bool TakeTask(/* In */  const int worker,	// Index of the worker
+					  /* Out */ int&	  task);	// Gets the index of the task to run
+		/*
+		Purpose:			Takes the next task for a worker: the front of its own deque, or else the
+							back of the first other deque that is not empty.
+		Pre:				0 <= worker < numThreads.
+		Post:				If a task was taken, it has been removed from its deque, task holds its
+							index and true has been returned. Otherwise false has been returned.
+		Classification:		Mutator
+		Order of Magnitude:	O(T), where T = # of threads
+		*/
+
+		bool SearchTask(/* In */	 const int	 worker,		// Index of the worker
+						/* In */	 const int	 task,			// Index of the task to run
+						/* In/Out */ MazeClass&	 workerMaze,	// The worker's copy of the maze
+						/* In/Out */ StackClass& stack,			// The worker's stack of directions
+						/* In/Out */ string&	 buffer);		// The worker's solution buffer
+		/*
+		Purpose:			Finds every valid path through the maze that starts with the task's prefix,
+							appending each to buffer as its moves and a newline and handing buffer to
+							the task's slot whenever it grows past SOLUTION_CHUNK_SIZE bytes.
+		Pre:				0 <= worker < numThreads. workerMaze has no VISITED locations or tried
+							directions. stack is empty.
+		Post:				Every solution of the task has been appended to buffer or handed over,
+							unless stopping was set, but for those up to resumeRoute if the task is
+							resumeTask. When built with SEARCH_STATS, what the search did below the
+							task's location has been recorded in the worker's slot of stats.
+							workerMaze has no VISITED locations or tried directions, and stack is
+							empty. True has been returned if the task was searched to the end, false if
+							stopping cut it short.
+		Classification:		Mutator
+		Order of Magnitude:	O(P * L), where P = # of locations visited in the task's subtree and
+							L = the length of the longest solution
+		Exceptions Thrown:	bad_alloc, OutOfMemoryException
+		*/
+
+		void HandOver(/* In */	   const int task,		// Index of the task
+					  /* In/Out */ string&	 buffer,	// Solutions found by the task
+					  /* In */	   const bool done);	// True if the task has finished
+		/*
+		Purpose:			Appends buffer to the task's slot for the writer, and marks the task done
+							if it has finished. If the slot already holds MAX_SLOT_SIZE bytes, first
+							waits until the writer empties it or stopping is set.
+		Pre:				buffer holds whole lines of directions.
+		Post:				buffer is empty. The writer has been woken.
+		Classification:		Mutator
+		Order of Magnitude:	O(B), where B = # of bytes in buffer
+		*/
+
+		void StopWorkers(/* In/Out */ vector<thread>& workers);	// The worker threads
+		/*
+		Purpose:			Tells the workers to stop and waits for them.
+		Pre:				None
+		Post:				stopping is set, and every thread in workers has been joined and removed.
+		Classification:		Mutator
+		Order of Magnitude:	O(T), where T = # of threads
+		*/
+
+		void StopOnOutOfMemory();
+		/*
+		Purpose:			Records that a worker ran out of memory and tells the other workers and the
+							writer to stop.
+		Pre:				None
+		Post:				outOfMemory is true, stopping is set and the writer has been woken.
+		Classification:		Mutator
+		Order of Magnitude:	O(1)
+		*/
+
+		MazeClass maze;				// A copy of the maze to search; used to split the search into tasks
+		int numThreads;				// # of threads to search with
+		vector<PathTaskType> tasks;	// The tasks of the current search, in depth-first order
+		TaskOutputType* outputs;	// One output slot per task, in the same order as tasks
+		WorkerDequeType* deques;	// One deque of tasks per worker thread
+		mutex outputLock;			// Guards outputs
+		condition_variable outputReady;	// Signalled when a slot gets solutions or is marked done
+		condition_variable slotDrained;	// Signalled when the writer empties a slot, or the workers
+										//  are told to stop
+		vector<unsigned char> resumeRoute;	// The route of the checkpoint resumed from
+		int resumeTask;				// Index of the task resumeRoute runs through, or -1 if none
+		atomic<bool> stopping;		// Set to make the workers stop early
+		atomic<long long> numNodes;	// # of locations the search has moved into
+	bool checkpointSaved;		// True if the last checkpoint Enumerate tried to save was saved
+		SearchStatsClass stats;		// What the workers did, one slot per worker; counted only when
+									//  built with SEARCH_STATS
+		bool outOfMemory;			// True if a worker ran out of memory; guarded by outputLock
+
+}; // End PathEnumeratorClass
+
+#endif
\ No newline at end of file
@@ -0,0 +1,143 @@
+/*
+AUTHOR:
+	Chris Pray
+
+DATE:
+	10/19/26
+
+FILENAME:
+	generate.cpp
+
+PURPOSE:
+	This file generates a maze of a chosen family and size and writes it to a maze file, so that a
+	reproducible corpus of mazes can be built for bench.cpp and p5's MazeBench.cpp to measure the
+	solvers on. The same arguments always write the same maze. The families are described in
+	mazegen.h.
+
+INPUT:
+	The maze to generate and the name of the output file are given on the command line:
+		generate family rows cols density seed outFile [binary]
+	family is one of backtracker, kruskal, braided, open or random. density is the probability, from
+	0 to 1, that a dead end is braided for braided, or that a location is a wall for random; it is
+	not used by the other families, but must still be given. seed is any unsigned integer. The maze
+	is written as a text maze file, which both p3 and p5 read, unless binary is given.
+
+PROCESSING:
+	A MazeClass object gets instantiated with the given dimensions, and a MazeGeneratorClass object
+	seeded with seed builds the walls of a maze of the given family in it. Then the maze is saved to
+	the output file with MazeFileClass.
+
+OUTPUT:
+	The maze is written to the output file. A message telling what was written, or why nothing could
+	be, is output to the console.
+
+ASSUMPTIONS:
+	(1) rows and cols are positive, and their product fits in an int.
+
+EXCEPTION HANDLING:
+	(1) nmspcMazeExceptions::OutOfMemoryException
+			Thrown on a failure to dynamically allocate memory when instantiating a MazeClass object, or
+			when generating or saving the maze.
+*/
+
+// Header Files / Libraries
+#include "maze.h"		// For use of MazeClass objects
+#include "mazegen.h"	// For use of MazeGeneratorClass objects
+#include "mazefile.h"	// For use of MazeFileClass objects
+#include<iostream>		// For standard input/output
+#include<string>		// For string datatype
+#include<cstdlib>		// For atoi, atof, strtoull, EXIT_SUCCESS and EXIT_FAILURE
+#include<cstring>		// For strcmp
+using namespace std;
+
+// Constants
+const int MIN_ARGUMENTS = 7;	// # of command line arguments, counting the program name
+const int MAX_ARGUMENTS = 8;	// # of command line arguments when binary is given
+const int NUM_FAMILIES = 5;		// # of maze families
+
+// The name of each family on the command line, in the order of MazeFamilyEnum
+const char* const FAMILY_NAMES[NUM_FAMILIES] = { "backtracker", "kruskal", "braided", "open",
+												 "random" };
+
+int main(/* In */ int argc,		// # of command line arguments
+		 /* In */ char* argv[])	// The command line arguments
+{
+	// Variables
+	int family = 0;		// Index of the family in FAMILY_NAMES
+	int numRows;		// # of rows in the maze
+	int numCols;		// # of columns in the maze
+	double density;		// Braid or wall probability
+	bool binary;		// True if the maze is written as a binary maze file
+	bool saved;			// Gets true if the output file was written
+
+	// If the arguments are not all given
+	if(argc < MIN_ARGUMENTS || argc > MAX_ARGUMENTS ||
+	   (argc == MAX_ARGUMENTS && strcmp(argv[MAX_ARGUMENTS - 1], "binary") != 0))
+	{
+		cout << "Usage: generate backtracker|kruskal|braided|open|random rows cols density seed "
+				"outFile [binary]" << endl;
+		return EXIT_FAILURE;
+
+	} // End if
+
+	// Find the family
+	while( family < NUM_FAMILIES && strcmp(argv[1], FAMILY_NAMES[family]) != 0 )
+	{
+		family++;
+
+	} // End while
+
+	numRows = atoi(argv[2]);
+	numCols = atoi(argv[3]);
+	density = atof(argv[4]);
+	binary = argc == MAX_ARGUMENTS;
+
+	// If the family is unknown, or the dimensions or density are out of range
+	if(family == NUM_FAMILIES || numRows <= 0 || numCols <= 0 || density < 0 || density > 1)
+	{
+		cout << "Unknown family, or rows, cols or density out of range." << endl;
+		return EXIT_FAILURE;
+
+	} // End if
+
+	try
+	{
+		// Instantiate the maze and build the walls of the family in it
+		MazeClass maze(numRows, numCols);
+		MazeGeneratorClass generator(strtoull(argv[5], NULL, 10));
+
+		generator.Generate(maze, MazeFamilyEnum(family), density);
+
+		// Save the maze in the chosen format
+		if(binary)
+		{
+			saved = MazeFileClass::SaveBinary(maze, argv[6]);
+
+		} // End if
+		else
+		{
+			saved = MazeFileClass::SaveText(maze, argv[6]);
+
+		} // End else
+
+		if( !saved )
+		{
+			cout << "Could not write file: " << argv[6] << endl;
+			return EXIT_FAILURE;
+
+		} // End if
+
+		cout << "Generated " << FAMILY_NAMES[family] << " maze of " << numRows << " x " << numCols
+			 << " in " << (binary ? "binary" : "text") << " maze file " << argv[6] << "." << endl;
+
+	} // End try
+	catch(nmspcMazeExceptions::OutOfMemoryException e)
+	{
+		cout << e.GetMessage() << endl;
+		return EXIT_FAILURE;
+
+	} // End catch
+
+	return EXIT_SUCCESS;
+
+} // End main()
\ No newline at end of file
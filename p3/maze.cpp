@@ -15,6 +15,108 @@ PURPOSE:
 #include "maze.h"
 
 
+//***************************************************************************************
+//*																						*
+//*								File-scope Helpers										*
+//*																						*
+//***************************************************************************************
+
+/*
+Purpose:	Packs a MazePositionType struct into one MazeCellType byte.
+Pre:		position.status is a PositionEnum.
+Post:		The packed byte has been returned.
+*/
+static MazeCellType PackPosition(/* In */ const MazePositionType& position)	// The location to pack
+{
+	return MazeCellType( position.status |
+						 (position.triedEast ? TRIED_EAST : 0) |
+						 (position.triedSouth ? TRIED_SOUTH : 0) |
+						 (position.triedWest ? TRIED_WEST : 0) |
+						 (position.triedNorth ? TRIED_NORTH : 0) );
+
+} // End PackPosition(const MazePositionType& position)
+
+//***************************************************************************************
+
+/*
+Purpose:	Unpacks a MazeCellType byte into a MazePositionType struct.
+Pre:		cell was returned by PackPosition or changed by MazeClass's in-place accessors.
+Post:		The unpacked MazePositionType struct has been returned.
+*/
+static MazePositionType UnpackPosition(/* In */ const MazeCellType cell)	// The byte to unpack
+{
+	MazePositionType position;	// Gets the unpacked location
+
+	position.status = PositionEnum(cell & STATUS_MASK);
+	position.triedEast = (cell & TRIED_EAST) != 0;
+	position.triedSouth = (cell & TRIED_SOUTH) != 0;
+	position.triedWest = (cell & TRIED_WEST) != 0;
+	position.triedNorth = (cell & TRIED_NORTH) != 0;
+
+	return position;
+
+} // End UnpackPosition(MazeCellType cell)
+
+//***************************************************************************************
+
+/*
+Purpose:	Fills reached toward the higher bits of a word along the runs of open bits it lies in,
+			doubling the distance covered at each of six steps (a Kogge-Stone fill).
+Pre:		reached is a subset of open.
+Post:		Every open bit that can be reached from a bit of reached by stepping to higher bits
+			through open bits has been set in the returned word.
+*/
+static uint64_t FillEast(/* In */ uint64_t reached,	// The bits to fill from
+						 /* In */ uint64_t open)	// The bits the fill may enter
+{
+	// Fill 1, 2, 4, 8, 16 and then 32 bits further, keeping in open only the bits whose whole
+	//  stretch of that length below them is open
+	reached |= open & (reached << 1);
+	open &= open << 1;
+	reached |= open & (reached << 2);
+	open &= open << 2;
+	reached |= open & (reached << 4);
+	open &= open << 4;
+	reached |= open & (reached << 8);
+	open &= open << 8;
+	reached |= open & (reached << 16);
+	open &= open << 16;
+	reached |= open & (reached << 32);
+
+	return reached;
+
+} // End FillEast(uint64_t reached, uint64_t open)
+
+//***************************************************************************************
+
+/*
+Purpose:	Fills reached toward the lower bits of a word along the runs of open bits it lies in.
+Pre:		reached is a subset of open.
+Post:		Every open bit that can be reached from a bit of reached by stepping to lower bits
+			through open bits has been set in the returned word.
+*/
+static uint64_t FillWest(/* In */ uint64_t reached,	// The bits to fill from
+						 /* In */ uint64_t open)	// The bits the fill may enter
+{
+	// Fill 1, 2, 4, 8, 16 and then 32 bits further, keeping in open only the bits whose whole
+	//  stretch of that length above them is open
+	reached |= open & (reached >> 1);
+	open &= open >> 1;
+	reached |= open & (reached >> 2);
+	open &= open >> 2;
+	reached |= open & (reached >> 4);
+	open &= open >> 4;
+	reached |= open & (reached >> 8);
+	open &= open >> 8;
+	reached |= open & (reached >> 16);
+	open &= open >> 16;
+	reached |= open & (reached >> 32);
+
+	return reached;
+
+} // End FillWest(uint64_t reached, uint64_t open)
+
+
 //***************************************************************************************
 //*																						*
 //*				Non-default Constructor, Copy Constructor, Destructor					*
@@ -28,31 +130,58 @@ MazeClass::MazeClass(/* In */ const int setNumRows,	// # of rows to instantiate
 	// Assign values to PDMs numRows and numCols
 	numRows = setNumRows;
 	numCols = setNumCols;
+	wordsPerRow = (numCols + BITS_PER_WORD - 1) / BITS_PER_WORD;
+	maze = NULL;
+	wallPlane = NULL;
+	visitedPlane = NULL;
+	reachPlane = NULL;
+	reachValid = false;
 	
 	try
 	{
-		// Dynamically allocate memory for a maze with numRows rows and numCols cols
-		maze = new MazePositionType[numRows * numCols];
+		// Dynamically allocate memory for a maze with numRows rows and numCols cols, and for its
+		//  bitboards
+		maze = new MazeCellType[numRows * numCols];
+		wallPlane = new uint64_t[numRows * wordsPerRow];
+		visitedPlane = new uint64_t[numRows * wordsPerRow];
+		reachPlane = new uint64_t[numRows * wordsPerRow];
 
 		// For each location in the maze
 		for(int i = 0; i < numRows; i++)
 		{
 			for(int j = 0; j < numCols; j++)
 			{
-				// Assign values to each struct member
-				maze[i * numCols + j].status = UNVISITED;
-				maze[i * numCols + j].triedEast = false;
-				maze[i * numCols + j].triedSouth = false;
-				maze[i * numCols + j].triedWest = false;
-				maze[i * numCols + j].triedNorth = false;
+				// Mark the location unvisited with no directions tried
+				maze[i * numCols + j] = UNVISITED;
+
+			} // End for
+
+			// Clear the row of each bitboard
+			for(int w = 0; w < wordsPerRow; w++)
+			{
+				wallPlane[i * wordsPerRow + w] = 0;
+				visitedPlane[i * wordsPerRow + w] = 0;
 
 			} // End for
 
+			// If the last word of the row has padding bits past the last column
+			if(numCols % BITS_PER_WORD != 0)
+			{
+				// Mark the padding bits as walls so the flood fill never enters them
+				wallPlane[i * wordsPerRow + wordsPerRow - 1] =
+					~uint64_t(0) << (numCols % BITS_PER_WORD);
+
+			} // End if
+
 		} // End for
 
 	} // End try
 	catch(bad_alloc e)
 	{
+		delete [] maze;
+		delete [] wallPlane;
+		delete [] visitedPlane;
+		delete [] reachPlane;
 		throw OutOfMemoryException("OutOfMemoryException: The heap has run out of memory.");
 
 	} // End catch
@@ -68,27 +197,49 @@ MazeClass::MazeClass(/* In */ const MazeClass& orig)	// The MazeClass object to
 	// Assign values to PDMs numRows and numCols
 	numRows = orig.numRows;
 	numCols = orig.numCols;
+	wordsPerRow = orig.wordsPerRow;
+	maze = NULL;
+	wallPlane = NULL;
+	visitedPlane = NULL;
+	reachPlane = NULL;
+	reachValid = false;
 
 	try
 	{
-		// Dynamically allocate memory for a maze with numRows rows and numCols cols
-		maze = new MazePositionType[numRows * numCols];
+		// Dynamically allocate memory for a maze with numRows rows and numCols cols, and for its
+		//  bitboards
+		maze = new MazeCellType[numRows * numCols];
+		wallPlane = new uint64_t[numRows * wordsPerRow];
+		visitedPlane = new uint64_t[numRows * wordsPerRow];
+		reachPlane = new uint64_t[numRows * wordsPerRow];
 
 		// For each location in the maze
 		for(int i = 0; i < numRows; i++)
 		{
 			for(int j = 0; j < numCols; j++)
 			{
-				// Assign values to each struct member
+				// Copy the location's packed byte
 				maze[i * numCols + j] = orig.maze[i * numCols + j];
 
 			} // End for
 
+			// Copy the row of each bitboard
+			for(int w = 0; w < wordsPerRow; w++)
+			{
+				wallPlane[i * wordsPerRow + w] = orig.wallPlane[i * wordsPerRow + w];
+				visitedPlane[i * wordsPerRow + w] = orig.visitedPlane[i * wordsPerRow + w];
+
+			} // End for
+
 		} // End for
 
 	} // End try
 	catch(bad_alloc e)
 	{
+		delete [] maze;
+		delete [] wallPlane;
+		delete [] visitedPlane;
+		delete [] reachPlane;
 		throw OutOfMemoryException("OutOfMemoryException: The heap has run out of memory.");
 
 	} // End catch
@@ -101,6 +252,9 @@ MazeClass::MazeClass(/* In */ const MazeClass& orig)	// The MazeClass object to
 MazeClass::~MazeClass()
 {
 	delete [] maze;
+	delete [] wallPlane;
+	delete [] visitedPlane;
+	delete [] reachPlane;
 
 } // End ~MazeClass()
 
@@ -124,12 +278,167 @@ void MazeClass::SetPosition(/* In */ const int			    row,		 // The row at which
 	if(row >= 0 && row < numRows && col >= 0 && col < numCols)
 	{
 		// Assign the MazePositionType struct at position (row, col) to newPosition
-		maze[row * numCols + col] = newPosition;
+		maze[row * numCols + col] = PackPosition(newPosition);
+		UpdatePlanes(row, col);
 
 	} // End if
 
 } // End SetPosition(int row, int col, MazePositionType newPosition)
 
+//***************************************************************************************
+
+void MazeClass::SetStatus(/* In */ const int		  row,			// The row of the location
+						  /* In */ const int		  col,			// The column of the location
+						  /* In */ const PositionEnum newStatus)	// The status to give the location
+{
+	// If location (row, col) is within the bounds of the maze
+	if(row >= 0 && row < numRows && col >= 0 && col < numCols)
+	{
+		// Replace the status bits of the location, keeping its tried bits
+		maze[row * numCols + col] = MazeCellType( (maze[row * numCols + col] & ~STATUS_MASK) |
+												  newStatus );
+		UpdatePlanes(row, col);
+
+	} // End if
+
+} // End SetStatus(int row, int col, PositionEnum newStatus)
+
+//***************************************************************************************
+
+void MazeClass::SetTried(/* In */ const int		  row,			// The row of the location
+						 /* In */ const int		  col,			// The column of the location
+						 /* In */ const TriedEnum direction,	// The direction to record
+						 /* In */ const bool	  tried)		// True if direction has been tried
+{
+	// If location (row, col) is within the bounds of the maze
+	if(row >= 0 && row < numRows && col >= 0 && col < numCols)
+	{
+		// If direction has been tried
+		if(tried)
+		{
+			// Set the direction's bit
+			maze[row * numCols + col] |= direction;
+
+		} // End if
+		// Else direction has not been tried
+		else
+		{
+			// Clear the direction's bit
+			maze[row * numCols + col] &= MazeCellType(~direction);
+
+		} // End else
+
+	} // End if
+
+} // End SetTried(int row, int col, TriedEnum direction, bool tried)
+
+//***************************************************************************************
+
+void MazeClass::ResetPosition(/* In */ const int row,	// The row of the location
+							  /* In */ const int col)	// The column of the location
+{
+	// If location (row, col) is within the bounds of the maze
+	if(row >= 0 && row < numRows && col >= 0 && col < numCols)
+	{
+		// Mark the location unvisited with no directions tried
+		maze[row * numCols + col] = UNVISITED;
+		UpdatePlanes(row, col);
+
+	} // End if
+
+} // End ResetPosition(int row, int col)
+
+//***************************************************************************************
+
+void MazeClass::SetRowWalls(/* In */ const int		 row,		// The row to rebuild
+							/* In */ const uint64_t* walls)	// One bit per location of the row
+{
+	uint64_t bits;	// The walls of one word of the row
+
+	// If row is within the bounds of the maze
+	if(row >= 0 && row < numRows)
+	{
+		for(int w = 0; w < wordsPerRow; w++)
+		{
+			bits = walls[w];
+
+			// If the word holds the end of the row, mark its padding bits as walls
+			if(w == wordsPerRow - 1 && numCols % BITS_PER_WORD != 0)
+			{
+				bits |= ~uint64_t(0) << (numCols % BITS_PER_WORD);
+
+			} // End if
+
+			wallPlane[row * wordsPerRow + w] = bits;
+			visitedPlane[row * wordsPerRow + w] = 0;
+
+		} // End for
+
+		// Give each location of the row its status, with no directions tried
+		for(int col = 0; col < numCols; col++)
+		{
+			bits = walls[col / BITS_PER_WORD] >> (col % BITS_PER_WORD);
+			maze[row * numCols + col] = (bits & 1) != 0 ? WALL : UNVISITED;
+
+		} // End for
+
+		// Walls may have moved anywhere in the row, so the last fill is stale
+		reachValid = false;
+
+	} // End if
+
+} // End SetRowWalls(int row, const uint64_t* walls)
+
+//***************************************************************************************
+
+void MazeClass::UpdatePlanes(/* In */ const int row,	// The row of the location
+							 /* In */ const int col)	// The column of the location
+{
+	const int word = row * wordsPerRow + col / BITS_PER_WORD;	// The word holding the location
+	const uint64_t bit = uint64_t(1) << (col % BITS_PER_WORD);	// The location's bit in word
+	const PositionEnum status = PositionEnum(maze[row * numCols + col] & STATUS_MASK);	// Its status
+
+	// If the location is being closed off
+	if( (status == WALL || status == VISITED) && ((wallPlane[word] | visitedPlane[word]) & bit) == 0 )
+	{
+		// If closing it off could cut some locations off from the exit, the last fill is stale
+		if( (row == numRows - 1 && col == numCols - 1) || SplitsNeighbours(row, col) )
+		{
+			reachValid = false;
+
+		} // End if
+
+		// The location itself can no longer be passed through
+		reachPlane[word] &= ~bit;
+
+	} // End if
+
+	// Set or clear the location's wall bit
+	if(status == WALL)
+	{
+		wallPlane[word] |= bit;
+
+	} // End if
+	else
+	{
+		wallPlane[word] &= ~bit;
+
+	} // End else
+
+	// Set or clear the location's visited bit
+	if(status == VISITED)
+	{
+		visitedPlane[word] |= bit;
+
+	} // End if
+	else
+	{
+		visitedPlane[word] &= ~bit;
+
+	} // End else
+
+} // End UpdatePlanes(int row, int col)
+
 
 //***************************************************************************************
 //*																						*
@@ -144,7 +453,7 @@ MazePositionType MazeClass::GetPosition(/* In */ const int row,	// The row at wh
 	if(row >= 0 && row < numRows && col >= 0 && col < numCols)
 	{
 		// Return the MazePositionType struct at location (row, col) in the maze
-		return maze[row * numCols + col];
+		return UnpackPosition(maze[row * numCols + col]);
 
 	} // End if
 	// Else location (row, col) is not within the bounds of the maze
@@ -160,7 +469,277 @@ MazePositionType MazeClass::GetPosition(/* In */ const int row,	// The row at wh
 
 //***************************************************************************************
 
-int MazeClass::GetNumRows()
+PositionEnum MazeClass::GetStatus(/* In */ const int row,			// The row of the location
+								  /* In */ const int col) const	// The column of the location
+{
+	// If location (row, col) is within the bounds of the maze
+	if(row >= 0 && row < numRows && col >= 0 && col < numCols)
+	{
+		// Return the status bits of the location
+		return PositionEnum(maze[row * numCols + col] & STATUS_MASK);
+
+	} // End if
+	// Else location (row, col) is not within the bounds of the maze
+	else
+	{
+		throw RetrieveFromOutOfBoundsException("RetrieveFromOutOfBoundsException: Cannot retrieve a "
+			"position from a location\n                                  outside the bounds of the "
+			"maze.");
+
+	} // End else
+
+} // End GetStatus(int row, int col)
+
+//***************************************************************************************
+
+bool MazeClass::WasTried(/* In */ const int		  row,				// The row of the location
+						 /* In */ const int		  col,				// The column of the location
+						 /* In */ const TriedEnum direction) const	// The direction to check
+{
+	// If location (row, col) is within the bounds of the maze
+	if(row >= 0 && row < numRows && col >= 0 && col < numCols)
+	{
+		// Return true if the direction's bit is set
+		return (maze[row * numCols + col] & direction) != 0;
+
+	} // End if
+	// Else location (row, col) is not within the bounds of the maze
+	else
+	{
+		throw RetrieveFromOutOfBoundsException("RetrieveFromOutOfBoundsException: Cannot retrieve a "
+			"position from a location\n                                  outside the bounds of the "
+			"maze.");
+
+	} // End else
+
+} // End WasTried(int row, int col, TriedEnum direction)
+
+//***************************************************************************************
+
+bool MazeClass::CanReachExit(/* In */ const int row,			// The row of the location
+							 /* In */ const int col) const	// The column of the location
+{
+	const int exitWord = (numRows - 1) * wordsPerRow + (numCols - 1) / BITS_PER_WORD;	// Word
+																						//  holding
+																						//  the exit
+	const uint64_t exitBit = uint64_t(1) << ((numCols - 1) % BITS_PER_WORD);	// The exit's bit
+	bool changed;	// True if a sweep reached a new location
+
+	// If (row, col) is the exit, it has already been reached
+	if(row == numRows - 1 && col == numCols - 1)
+	{
+		return true;
+
+	} // End if
+
+	// If the last fill is still valid and reaches a neighbour of (row, col), there is no need to
+	//  fill again
+	if( reachValid && (IsReached(row, col + 1) || IsReached(row + 1, col) ||
+					   IsReached(row, col - 1) || IsReached(row - 1, col)) )
+	{
+		return true;
+
+	} // End if
+
+	// If the exit is a wall or is visited, nothing can reach it
+	if( ((wallPlane[exitWord] | visitedPlane[exitWord]) & exitBit) != 0 )
+	{
+		return false;
+
+	} // End if
+
+	// Clear the reach plane and seed it with the exit
+	for(int i = 0; i < numRows * wordsPerRow; i++)
+	{
+		reachPlane[i] = 0;
+
+	} // End for
+
+	reachPlane[exitWord] = exitBit;
+	reachValid = true;
+
+	do
+	{
+		changed = false;
+
+		// Sweep up the maze from the exit's row, growing each row from its neighbours
+		for(int r = numRows - 1; r >= 0; r--)
+		{
+			changed = DilateRow(r) || changed;
+
+		} // End for
+
+		// If a neighbour of (row, col) has been reached, the exit can be reached from (row, col)
+		if( IsReached(row, col + 1) || IsReached(row + 1, col) ||
+			IsReached(row, col - 1) || IsReached(row - 1, col) )
+		{
+			return true;
+
+		} // End if
+
+		// Sweep back down the maze
+		for(int r = 0; r < numRows; r++)
+		{
+			changed = DilateRow(r) || changed;
+
+		} // End for
+
+		// If a neighbour of (row, col) has been reached, the exit can be reached from (row, col)
+		if( IsReached(row, col + 1) || IsReached(row + 1, col) ||
+			IsReached(row, col - 1) || IsReached(row - 1, col) )
+		{
+			return true;
+
+		} // End if
+
+	} while(changed);
+
+	return false;
+
+} // End CanReachExit(int row, int col)
+
+//***************************************************************************************
+
+bool MazeClass::DilateRow(/* In */ const int row) const	// The row to dilate into
+{
+	uint64_t* reached = reachPlane + row * wordsPerRow;	// The row's words of the reach plane
+	uint64_t carry = 0;		// 1 if the fill runs off the end of the previous word into this one
+	bool changed = false;	// True if the row changed
+	uint64_t open;			// The locations of a word that are neither walls nor visited
+	uint64_t grown;			// A word of the row after growing
+
+	// Grow each word from the rows above and below it and fill it eastward, carrying the fill
+	//  into the next word
+	for(int w = 0; w < wordsPerRow; w++)
+	{
+		open = ~(wallPlane[row * wordsPerRow + w] | visitedPlane[row * wordsPerRow + w]);
+		grown = reached[w];
+
+		if(row > 0)
+		{
+			grown |= reached[w - wordsPerRow];
+
+		} // End if
+
+		if(row < numRows - 1)
+		{
+			grown |= reached[w + wordsPerRow];
+
+		} // End if
+
+		grown = FillEast((grown | carry) & open, open);
+		carry = grown >> (BITS_PER_WORD - 1);
+
+		if(grown != reached[w])
+		{
+			reached[w] = grown;
+			changed = true;
+
+		} // End if
+
+	} // End for
+
+	carry = 0;
+
+	// Fill each word westward, carrying the fill into the previous word
+	for(int w = wordsPerRow - 1; w >= 0; w--)
+	{
+		open = ~(wallPlane[row * wordsPerRow + w] | visitedPlane[row * wordsPerRow + w]);
+		grown = FillWest(reached[w] | (carry & open), open);
+		carry = (grown & 1) << (BITS_PER_WORD - 1);
+
+		if(grown != reached[w])
+		{
+			reached[w] = grown;
+			changed = true;
+
+		} // End if
+
+	} // End for
+
+	return changed;
+
+} // End DilateRow(int row)
+
+//***************************************************************************************
+
+bool MazeClass::SplitsNeighbours(/* In */ const int row,			// The row of the location
+								 /* In */ const int col) const	// The column of the location
+{
+	// Offsets to the eight locations around (row, col), going clockwise from the north; the
+	//  neighbours are at the even indexes and the diagonals between them at the odd ones
+	const int ROW_OFFSETS[8] = { -1, -1, 0, 1, 1, 1, 0, -1 };
+	const int COL_OFFSETS[8] = { 0, 1, 1, 1, 0, -1, -1, -1 };
+	bool open[8];			// True if the location at each offset is open
+	int numNeighbours = 0;	// # of open neighbours
+	int numJoins = 0;		// # of pairs of open neighbours joined through an open diagonal
+
+	for(int i = 0; i < 8; i++)
+	{
+		open[i] = IsOpen(row + ROW_OFFSETS[i], col + COL_OFFSETS[i]);
+
+	} // End for
+
+	// Count the open neighbours, and how many of them are joined to the next one clockwise
+	for(int i = 0; i < 8; i += 2)
+	{
+		if(open[i])
+		{
+			numNeighbours++;
+
+			if(open[i + 1] && open[(i + 2) % 8])
+			{
+				numJoins++;
+
+			} // End if
+
+		} // End if
+
+	} // End for
+
+	// Each join merges two groups, except that four joins close a ring of four neighbours
+	return numNeighbours - numJoins > 1;
+
+} // End SplitsNeighbours(int row, int col)
+
+//***************************************************************************************
+
+bool MazeClass::IsOpen(/* In */ const int row,			// The row of the location
+					   /* In */ const int col) const	// The column of the location
+{
+	// If location (row, col) is within the bounds of the maze
+	if(row >= 0 && row < numRows && col >= 0 && col < numCols)
+	{
+		return ( (wallPlane[row * wordsPerRow + col / BITS_PER_WORD] |
+				  visitedPlane[row * wordsPerRow + col / BITS_PER_WORD]) >>
+				 (col % BITS_PER_WORD) & 1 ) == 0;
+
+	} // End if
+
+	return false;
+
+} // End IsOpen(int row, int col)
+
+//***************************************************************************************
+
+bool MazeClass::IsReached(/* In */ const int row,			// The row of the location
+						  /* In */ const int col) const	// The column of the location
+{
+	// If location (row, col) is within the bounds of the maze
+	if(row >= 0 && row < numRows && col >= 0 && col < numCols)
+	{
+		return ( reachPlane[row * wordsPerRow + col / BITS_PER_WORD] >>
+				 (col % BITS_PER_WORD) & 1 ) != 0;
+
+	} // End if
+
+	return false;
+
+} // End IsReached(int row, int col)
+
+//***************************************************************************************
+
+int MazeClass::GetNumRows() const
 {
 	return numRows;
 
@@ -168,8 +747,33 @@ int MazeClass::GetNumRows()
 
 //***************************************************************************************
 
-int MazeClass::GetNumCols()
+int MazeClass::GetNumCols() const
 {
 	return numCols;
 
-} // End GetNumCols()
\ No newline at end of file
+} // End GetNumCols()
+
+//***************************************************************************************
+
+void MazeClass::GetRowWalls(/* In */  const int row,			// The row to copy
+							/* Out */ uint64_t* walls) const	// Gets the row's walls
+{
+	// If row is within the bounds of the maze
+	if(row >= 0 && row < numRows)
+	{
+		for(int w = 0; w < wordsPerRow; w++)
+		{
+			walls[w] = wallPlane[row * wordsPerRow + w];
+
+		} // End for
+
+		// Clear the padding bits past the last column
+		if(numCols % BITS_PER_WORD != 0)
+		{
+			walls[wordsPerRow - 1] &= ~(~uint64_t(0) << (numCols % BITS_PER_WORD));
+
+		} // End if
+
+	} // End if
+
+} // End GetRowWalls(int row, uint64_t* walls)
\ No newline at end of file
@@ -13,7 +13,19 @@ PURPOSE:
 	user of this class supplies the dimensions of a maze object at run-time. A maze is instantiated as
 	an open two-dimensional plane and it is up to the user to build the maze through the use of this
 	class's operations. The data that each location in the maze will contain is defined in
-	MazePositionType.h, which must be supplied by the user.
+	MazePositionType.h, which must be supplied by the user. Each location is stored packed into one
+	MazeCellType byte, and its status and tried directions can be read and changed in place with
+	GetStatus, SetStatus, WasTried, SetTried and ResetPosition, without copying a MazePositionType in
+	and out.
+
+	Alongside the packed bytes, the maze keeps two bitboards: a wall plane and a visited plane, each
+	holding one bit per location, row by row, with every row padded out to a whole number of 64-bit
+	words. Bit (col % 64) of word (col / 64) of a row stands for column col, and the padding bits are
+	marked as walls. CanReachExit uses the planes to flood fill outward from the exit 64 locations at a
+	time, dilating each row into its neighbours with shifts, ANDs and ORs, so that a search can drop a
+	path as soon as the exit can no longer be reached from its end. The result of the last fill is
+	kept, and visiting a location whose open neighbours stay joined around it cannot cut anything
+	off, so most calls are answered from the kept result without filling again.
 	
 ASSUMPTIONS:
 	(1) When using the class non-default constructor, the user must pass positive integers as the
@@ -24,7 +36,7 @@ ASSUMPTIONS:
 
 EXCEPTION HANDLING:
 	bad_alloc is caught in the non-default constructor and the copy constructor if an attempt to
-	allocate dynamic memory fails 
+	allocate dynamic memory fails, including the memory for the bitboards
 
 SUMMARY OF METHODS:
 
@@ -45,22 +57,50 @@ SUMMARY OF METHODS:
 	MazePositionType GetPosition(int row, int col)
 		Retrieves the MazePositionType struct from a specified location in the maze.
 
-	int GetNumRows()
+	int GetNumRows() const
 		Returns the # of rows in the maze.
 
-	int GetNumCols()
+	int GetNumCols() const
 		Returns the # of columns in the maze.
+
+	PositionEnum GetStatus(int row, int col) const
+		Returns the status of a specified location in the maze.
+
+	void SetStatus(int row, int col, PositionEnum newStatus)
+		Sets the status of a specified location in the maze, leaving its tried directions unchanged.
+
+	bool WasTried(int row, int col, TriedEnum direction) const
+		Returns true if direction has been tried from a specified location in the maze.
+
+	void SetTried(int row, int col, TriedEnum direction, bool tried)
+		Records whether direction has been tried from a specified location in the maze.
+
+	void ResetPosition(int row, int col)
+		Marks a specified location in the maze as unvisited with no directions tried.
+
+	void SetRowWalls(int row, const uint64_t* walls)
+		Rebuilds a whole row of the maze from a packed bitmap of its walls.
+
+	bool CanReachExit(int row, int col) const
+		Returns true if the exit can be reached from a specified location without crossing a wall or a
+		visited location.
+
+	void GetRowWalls(int row, uint64_t* walls) const
+		Copies the packed bitmap of the walls of a whole row of the maze into walls.
 */
 
 #ifndef MazeClass_h
 #define MazeClass_h
 
+#include<cstdint>				// For uint64_t
 #include "MazePositionType.h"	// Provides the structure of the type of data to be stored in each 
 								//  location of the maze
 #include "MazeExceptions.h"		// For custom exceptions, RetrieveFromOutOfBoundsException and
 								//  OutOfMemoryException
 using namespace nmspcMazeExceptions;
 
+const int BITS_PER_WORD = 64;	// # of locations held by each word of a bitboard or packed wall row
+
 class MazeClass
 {
 	public:
@@ -140,7 +180,7 @@ class MazeClass
 		Exceptions Thrown:	RetrieveFromOutOfBoundsException
 		*/
 
-		int GetNumRows();
+		int GetNumRows() const;
 		/*
 		Purpose:			Returns the # of rows in the maze.
 		Pre:				A MazeClass object has been instantiated.
@@ -149,7 +189,7 @@ class MazeClass
 		Order of Magnitude:	O(1)
 		*/
 
-		int GetNumCols();
+		int GetNumCols() const;
 		/*
 		Purpose:			Returns the # of columns in the maze.
 		Pre:				A MazeClass object has been instantiated.
@@ -158,12 +198,199 @@ class MazeClass
 		Order of Magnitude:	O(1)
 		*/
 
+		PositionEnum GetStatus(/* In */ const int row,			// The row of the location
+							   /* In */ const int col) const;	// The column of the location
+		/*
+		Purpose:			Returns the status of location (row, col) in the maze, read straight from
+							its packed byte.
+		Pre:				A MazeClass object has been instantiated. (row, col) is a valid location
+							within the maze.
+		Post:				The status of location (row, col) has been returned.
+		Classification:		Observer / Accessor
+		Order of Magnitude:	O(1)
+		Exceptions Thrown:	RetrieveFromOutOfBoundsException
+		*/
+
+		void SetStatus(/* In */ const int		   row,			// The row of the location
+					   /* In */ const int		   col,			// The column of the location
+					   /* In */ const PositionEnum newStatus);	// The status to give the location
+		/*
+		Purpose:			Sets the status of location (row, col) in the maze in place, leaving the
+							directions tried from it unchanged.
+		Pre:				A MazeClass object has been instantiated.
+		Post:				If (row, col) is within the maze, its status is newStatus. Otherwise the
+							maze is unchanged.
+		Classification:		Mutator
+		Order of Magnitude:	O(1)
+		*/
+
+		bool WasTried(/* In */ const int	   row,				// The row of the location
+					  /* In */ const int	   col,				// The column of the location
+					  /* In */ const TriedEnum direction) const;	// The direction to check
+		/*
+		Purpose:			Determines whether direction has been tried from location (row, col).
+		Pre:				A MazeClass object has been instantiated. (row, col) is a valid location
+							within the maze.
+		Post:				True has been returned if direction has been tried from location
+							(row, col), false otherwise.
+		Classification:		Observer / Predicator
+		Order of Magnitude:	O(1)
+		Exceptions Thrown:	RetrieveFromOutOfBoundsException
+		*/
+
+		void SetTried(/* In */ const int	   row,			// The row of the location
+					  /* In */ const int	   col,			// The column of the location
+					  /* In */ const TriedEnum direction,	// The direction to record
+					  /* In */ const bool	   tried);		// True if direction has been tried
+		/*
+		Purpose:			Records in place whether direction has been tried from location (row, col),
+							leaving the location's status and other directions unchanged.
+		Pre:				A MazeClass object has been instantiated.
+		Post:				If (row, col) is within the maze, WasTried(row, col, direction) returns
+							tried. Otherwise the maze is unchanged.
+		Classification:		Mutator
+		Order of Magnitude:	O(1)
+		*/
+
+		void ResetPosition(/* In */ const int row,	// The row of the location
+						   /* In */ const int col);	// The column of the location
+		/*
+		Purpose:			Marks location (row, col) as unvisited with no directions tried, with a
+							single store.
+		Pre:				A MazeClass object has been instantiated.
+		Post:				If (row, col) is within the maze, it is UNVISITED and no direction has been
+							tried from it. Otherwise the maze is unchanged.
+		Classification:		Mutator
+		Order of Magnitude:	O(1)
+		*/
+
+		void SetRowWalls(/* In */ const int		 row,		// The row to rebuild
+						 /* In */ const uint64_t* walls);	// One bit per location of the row
+		/*
+		Purpose:			Rebuilds row row of the maze from a packed bitmap of its walls, laid out
+							like a row of the wall plane: bit (col % BITS_PER_WORD) of word
+							(col / BITS_PER_WORD) is set if column col is a wall. Meant for loading a
+							maze a row at a time, without the cost of a SetStatus call per wall.
+		Pre:				A MazeClass object has been instantiated. walls holds
+							(numCols + BITS_PER_WORD - 1) / BITS_PER_WORD words.
+		Post:				If row is within the maze, each location of it is a WALL if its bit is set
+							and UNVISITED otherwise, with no directions tried; bits past the last
+							column are ignored. Otherwise the maze is unchanged.
+		Classification:		Mutator
+		Order of Magnitude:	O(M), where M = numCols
+		*/
+
+		bool CanReachExit(/* In */ const int row,			// The row of the location
+						  /* In */ const int col) const;	// The column of the location
+		/*
+		Purpose:			Determines whether the exit, at location (numRows - 1, numCols - 1), can be
+							reached from location (row, col) by moving east, south, west or north
+							without entering a wall or a VISITED location. The locations that can
+							reach the exit are found by flood filling outward from the exit over the
+							bitboards: each row is dilated into the rows above and below it and then
+							filled along its runs of open locations a 64-bit word at a time, sweeping
+							down and up the maze until nothing changes. The fill stops as soon as a
+							neighbour of (row, col) is reached. If the result of an earlier fill is
+							still valid and already reaches a neighbour of (row, col), no fill is done.
+		Pre:				A MazeClass object has been instantiated. (row, col) is a valid location
+							within the maze.
+		Post:				True has been returned if (row, col) is the exit or the exit can be reached
+							from one of its neighbours, false otherwise.
+		Classification:		Observer / Predicator
+		Order of Magnitude:	O(1) when answered from an earlier fill, otherwise O(K * N * W), where
+							N = numRows, W = # of words per row and K = # of sweeps needed, which is
+							small unless paths to the exit wind up and down the maze
+		*/
+
+		void GetRowWalls(/* In */  const int row,			// The row to copy
+						 /* Out */ uint64_t* walls) const;	// Gets one bit per location of the row
+		/*
+		Purpose:			Copies the walls of row row into walls, packed as SetRowWalls takes them.
+		Pre:				A MazeClass object has been instantiated. walls has room for
+							(numCols + BITS_PER_WORD - 1) / BITS_PER_WORD words.
+		Post:				If row is within the maze, walls holds its packed walls, with the bits past
+							the last column clear. Otherwise walls is unchanged.
+		Classification:		Observer / Accessor
+		Order of Magnitude:	O(M / BITS_PER_WORD)
+		*/
+
 
 	private:
 
-		MazePositionType* maze;	// Pointer to the dynamically allocated memory for the maze
+		void UpdatePlanes(/* In */ const int row,	// The row of the location
+						  /* In */ const int col);	// The column of the location
+		/*
+		Purpose:			Copies the status of location (row, col) from its packed byte into the
+							wall plane and the visited plane.
+		Pre:				(row, col) is a valid location within the maze.
+		Post:				The wall bit of (row, col) is set if it is a WALL, and its visited bit is
+							set if it is VISITED. If (row, col) has just been closed off and it is the
+							exit or SplitsNeighbours(row, col) is true, the reach plane is no longer
+							valid.
+		Classification:		Mutator
+		Order of Magnitude:	O(1)
+		*/
+
+		bool DilateRow(/* In */ const int row) const;	// The row to dilate into
+		/*
+		Purpose:			Grows the reach plane within row: every open location next to a reached
+							location in the rows above and below is reached, and then every open
+							location joined to a reached location along the row is reached, carrying
+							the fill from word to word eastward and then westward.
+		Pre:				0 <= row < numRows. The reach plane has been seeded by CanReachExit.
+		Post:				The reach plane holds the grown row. True has been returned if the row
+							changed, false otherwise.
+		Classification:		Mutator
+		Order of Magnitude:	O(W), where W = # of words per row
+		*/
+
+		bool SplitsNeighbours(/* In */ const int row,			// The row of the location
+							  /* In */ const int col) const;	// The column of the location
+		/*
+		Purpose:			Determines whether closing off location (row, col) could disconnect its open
+							neighbours from each other. Two neighbours stay joined if they are on
+							adjacent sides and the diagonal location between them is open, so the
+							neighbours form one group unless they are split by a blocked diagonal.
+		Pre:				(row, col) is a valid location within the maze.
+		Post:				True has been returned if the open neighbours of (row, col) fall into more
+							than one group, false otherwise.
+		Classification:		Observer / Predicator
+		Order of Magnitude:	O(1)
+		*/
+
+		bool IsOpen(/* In */ const int row,			// The row of the location
+					/* In */ const int col) const;	// The column of the location
+		/*
+		Purpose:			Determines whether location (row, col) is neither a wall nor visited.
+		Pre:				None
+		Post:				True has been returned if (row, col) is within the maze and open, false
+							otherwise.
+		Classification:		Observer / Predicator
+		Order of Magnitude:	O(1)
+		*/
+
+		bool IsReached(/* In */ const int row,			// The row of the location
+					   /* In */ const int col) const;	// The column of the location
+		/*
+		Purpose:			Determines whether location (row, col) is set in the reach plane.
+		Pre:				None
+		Post:				True has been returned if (row, col) is within the maze and reached, false
+							otherwise.
+		Classification:		Observer / Predicator
+		Order of Magnitude:	O(1)
+		*/
+
+		MazeCellType* maze;		// Pointer to the dynamically allocated memory for the maze; one packed
+								//  byte per location, row by row
 		int numRows,			// # of rows in the maze
 			numCols;			// # of columns in the maze
+		int wordsPerRow;		// # of 64-bit words in each row of a bitboard
+		uint64_t* wallPlane;	// One bit per location; set if the location is a WALL or padding
+		uint64_t* visitedPlane;	// One bit per location; set if the location is VISITED
+		mutable uint64_t* reachPlane;	// Result of the last fill by CanReachExit; set if the exit can
+										//  be reached from the location
+		mutable bool reachValid;		// True if every location set in reachPlane can still reach
+										//  the exit
 
 }; // End MazeClass
 
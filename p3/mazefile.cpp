@@ -0,0 +1,471 @@
+/*
+AUTHOR:
+	Chris Pray
+
+DATE:
+	10/19/26
+
+FILENAME:
+	mazefile.cpp
+
+PURPOSE:
+	This file contains the implementation for all of the methods declared in mazefile.h
+*/
+
+#include "mazefile.h"
+#include<charconv>	// For from_chars
+#include<climits>	// For INT_MAX
+#include<cstdint>	// For uint32_t and uint64_t
+#include<cstring>	// For memcmp and memcpy
+#include<fstream>	// For ifstream and ofstream
+#include<new>		// For bad_alloc
+#ifndef _WIN32
+#include<fcntl.h>		// For open
+#include<sys/mman.h>	// For mmap, madvise and munmap
+#include<sys/stat.h>	// For fstat
+#include<unistd.h>		// For close
+#endif
+
+
+//***************************************************************************************
+//*																						*
+//*								File-scope Helpers										*
+//*																						*
+//***************************************************************************************
+
+/*
+Purpose:	Skips the white space at the start of the text from next to end.
+Pre:		next <= end.
+Post:		The address of the first character that is not white space, or end, has been returned.
+*/
+static const char* SkipSpace(/* In */ const char* next,	// Start of the text
+							 /* In */ const char* end)	// End of the text
+{
+	while( next < end && (*next == ' ' || (*next >= '\t' && *next <= '\r')) )
+	{
+		next++;
+
+	} // End while
+
+	return next;
+
+} // End SkipSpace(const char* next, const char* end)
+
+//***************************************************************************************
+
+/*
+Purpose:	Parses the integer after any white space at the start of the text from next to end.
+Pre:		next <= end.
+Post:		If an integer was found, value holds it and the address just past it has been returned.
+			Otherwise NULL has been returned.
+*/
+static const char* ParseInt(/* In */  const char* next,		// Start of the text
+							/* In */  const char* end,		// End of the text
+							/* Out */ int&		  value)	// Gets the integer
+{
+	const from_chars_result result = from_chars(SkipSpace(next, end), end, value);	// The parse
+
+	if(result.ec != errc())
+	{
+		return NULL;
+
+	} // End if
+
+	return result.ptr;
+
+} // End ParseInt(const char* next, const char* end, int& value)
+
+//***************************************************************************************
+
+/*
+Purpose:	Returns the # of 64-bit words in each row of a packed wall bitmap numCols wide.
+Pre:		numCols > 0.
+Post:		The # of words has been returned.
+*/
+static int WordsPerRow(/* In */ const int numCols)	// # of columns in the maze
+{
+	return (numCols + BITS_PER_WORD - 1) / BITS_PER_WORD;
+
+} // End WordsPerRow(int numCols)
+
+
+//***************************************************************************************
+//*																						*
+//*							Default Constructor and Destructor							*
+//*																						*
+//***************************************************************************************
+
+// Default Constructor
+MazeFileClass::MazeFileClass()
+{
+	data = NULL;
+	size = 0;
+	wallsStart = 0;
+	binary = false;
+	numRows = 0;
+	numCols = 0;
+
+} // End MazeFileClass()
+
+//***************************************************************************************
+
+// Destructor
+MazeFileClass::~MazeFileClass()
+{
+	Close();
+
+} // End ~MazeFileClass()
+
+
+//***************************************************************************************
+//*																						*
+//*									Mutator												*
+//*																						*
+//***************************************************************************************
+
+bool MazeFileClass::Open(/* In */ const string& fileName)	// Name of the maze file
+{
+	uint32_t dimensions[2];	// The # of rows and # of columns in a binary maze file's header
+	const char* next;		// The next character of a text maze file to parse
+
+	Close();
+
+	try
+	{
+#ifdef _WIN32
+		// Read the whole file into buffer
+		ifstream fin(fileName.c_str(), ios::binary);	// The maze file
+
+		if( !fin )
+		{
+			return false;
+
+		} // End if
+
+		buffer.assign(istreambuf_iterator<char>(fin), istreambuf_iterator<char>());
+		data = buffer.data();
+		size = buffer.size();
+#else
+		// Map the whole file into memory, read only
+		const int fd = open(fileName.c_str(), O_RDONLY);	// Descriptor of the maze file
+		struct stat status;									// Gets the size of the file
+
+		if(fd < 0)
+		{
+			return false;
+
+		} // End if
+
+		if(fstat(fd, &status) != 0)
+		{
+			close(fd);
+			return false;
+
+		} // End if
+
+		size = size_t(status.st_size);
+
+		// If the file is empty there is nothing to map; point at an empty buffer instead
+		if(size == 0)
+		{
+			buffer.assign(1, '\0');
+			data = buffer.data();
+
+		} // End if
+		else
+		{
+			void* mapping = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);	// The mapped file
+
+			if(mapping == MAP_FAILED)
+			{
+				close(fd);
+				size = 0;
+				return false;
+
+			} // End if
+
+			// The file is read once, front to back
+			madvise(mapping, size, MADV_SEQUENTIAL);
+			data = static_cast<const char*>(mapping);
+
+		} // End else
+
+		// The mapping outlives the descriptor
+		close(fd);
+#endif
+
+	} // End try
+	catch(bad_alloc e)
+	{
+		Close();
+		throw OutOfMemoryException("OutOfMemoryException: The heap has run out of memory.");
+
+	} // End catch
+
+	// If the file starts with the magic bytes, it is a binary maze file
+	binary = size >= size_t(BINARY_MAZE_MAGIC_SIZE) &&
+			 memcmp(data, BINARY_MAZE_MAGIC, BINARY_MAZE_MAGIC_SIZE) == 0;
+
+	if(binary)
+	{
+		// Read the dimensions from the header
+		if( size < size_t(BINARY_MAZE_HEADER_SIZE) )
+		{
+			Close();
+			return false;
+
+		} // End if
+
+		memcpy(dimensions, data + BINARY_MAZE_MAGIC_SIZE, sizeof(dimensions));
+
+		// If the dimensions cannot be a maze, or the bitmap is cut short
+		if( dimensions[0] == 0 || dimensions[0] > uint32_t(INT_MAX) ||
+			dimensions[1] == 0 || dimensions[1] > uint32_t(INT_MAX) ||
+			(size - BINARY_MAZE_HEADER_SIZE) / sizeof(uint64_t) / WordsPerRow(int(dimensions[1])) <
+				dimensions[0] )
+		{
+			Close();
+			return false;
+
+		} // End if
+
+		numRows = int(dimensions[0]);
+		numCols = int(dimensions[1]);
+		wallsStart = BINARY_MAZE_HEADER_SIZE;
+
+	} // End if
+	// Else it is a text maze file, which starts with the dimensions
+	else
+	{
+		next = ParseInt(data, data + size, numRows);
+
+		if(next != NULL)
+		{
+			next = ParseInt(next, data + size, numCols);
+
+		} // End if
+
+		if(next == NULL || numRows <= 0 || numCols <= 0)
+		{
+			Close();
+			return false;
+
+		} // End if
+
+		wallsStart = size_t(next - data);
+
+	} // End else
+
+	return true;
+
+} // End Open(const string& fileName)
+
+//***************************************************************************************
+
+void MazeFileClass::Close()
+{
+#ifndef _WIN32
+	// If the file was mapped rather than read into buffer, unmap it
+	if(data != NULL && buffer.empty())
+	{
+		munmap(const_cast<char*>(data), size);
+
+	} // End if
+#endif
+
+	vector<char>().swap(buffer);
+	data = NULL;
+	size = 0;
+	wallsStart = 0;
+	binary = false;
+	numRows = 0;
+	numCols = 0;
+
+} // End Close()
+
+
+//***************************************************************************************
+//*																						*
+//*								Observer / Accessor										*
+//*																						*
+//***************************************************************************************
+
+bool MazeFileClass::IsBinary() const
+{
+	return binary;
+
+} // End IsBinary()
+
+//***************************************************************************************
+
+int MazeFileClass::GetNumRows() const
+{
+	return numRows;
+
+} // End GetNumRows()
+
+//***************************************************************************************
+
+int MazeFileClass::GetNumCols() const
+{
+	return numCols;
+
+} // End GetNumCols()
+
+//***************************************************************************************
+
+void MazeFileClass::LoadWalls(/* In/Out */ MazeClass& maze) const	// The maze to build
+{
+	const int wordsPerRow = WordsPerRow(numCols);	// # of words in each row of the bitmap
+	vector<uint64_t> walls;		// The packed walls of the maze, or of one row of a binary file
+	const char* next;			// The next character of a text maze file to parse
+	int row;					// A row # in the maze
+	int col;					// A column # in the maze
+
+	try
+	{
+		// If the file is binary, copy each row of its bitmap into the maze
+		if(binary)
+		{
+			walls.resize(wordsPerRow);
+
+			for(row = 0; row < numRows; row++)
+			{
+				memcpy(walls.data(),
+					   data + wallsStart + size_t(row) * wordsPerRow * sizeof(uint64_t),
+					   wordsPerRow * sizeof(uint64_t));
+				maze.SetRowWalls(row, walls.data());
+
+			} // End for
+
+		} // End if
+		// Else parse every wall into a bitmap of the whole maze, then hand it over a row at a time
+		else
+		{
+			walls.assign(size_t(numRows) * wordsPerRow, 0);
+			next = data + wallsStart;
+
+			// Get the coordinates of each wall until the end of the file
+			while( (next = ParseInt(next, data + size, row)) != NULL &&
+				   (next = ParseInt(next, data + size, col)) != NULL )
+			{
+				// If location (row, col) is within the bounds of the maze, mark it a wall
+				if(row >= 0 && row < numRows && col >= 0 && col < numCols)
+				{
+					walls[size_t(row) * wordsPerRow + col / BITS_PER_WORD] |=
+						uint64_t(1) << (col % BITS_PER_WORD);
+
+				} // End if
+
+			} // End while
+
+			for(row = 0; row < numRows; row++)
+			{
+				maze.SetRowWalls(row, walls.data() + size_t(row) * wordsPerRow);
+
+			} // End for
+
+		} // End else
+
+	} // End try
+	catch(bad_alloc e)
+	{
+		throw OutOfMemoryException("OutOfMemoryException: The heap has run out of memory.");
+
+	} // End catch
+
+} // End LoadWalls(MazeClass& maze)
+
+//***************************************************************************************
+
+bool MazeFileClass::SaveText(/* In */ const MazeClass& maze,		// The maze to save
+							 /* In */ const string&	   fileName)	// Name of the file to write
+{
+	const int wordsPerRow = WordsPerRow(maze.GetNumCols());	// # of words in each row
+	ofstream dout(fileName.c_str());	// The file to write
+	vector<uint64_t> walls;				// The packed walls of one row
+
+	if( !dout )
+	{
+		return false;
+
+	} // End if
+
+	try
+	{
+		walls.resize(wordsPerRow);
+		dout << maze.GetNumRows() << ' ' << maze.GetNumCols() << '\n';
+
+		// Write each wall, row by row
+		for(int row = 0; row < maze.GetNumRows(); row++)
+		{
+			maze.GetRowWalls(row, walls.data());
+
+			for(int col = 0; col < maze.GetNumCols(); col++)
+			{
+				if( ((walls[col / BITS_PER_WORD] >> (col % BITS_PER_WORD)) & 1) != 0 )
+				{
+					dout << row << ' ' << col << '\n';
+
+				} // End if
+
+			} // End for
+
+		} // End for
+
+	} // End try
+	catch(bad_alloc e)
+	{
+		throw OutOfMemoryException("OutOfMemoryException: The heap has run out of memory.");
+
+	} // End catch
+
+	dout.close();
+
+	return !dout.fail();
+
+} // End SaveText(const MazeClass& maze, const string& fileName)
+
+//***************************************************************************************
+
+bool MazeFileClass::SaveBinary(/* In */ const MazeClass& maze,		// The maze to save
+							   /* In */ const string&	 fileName)	// Name of the file to write
+{
+	const int wordsPerRow = WordsPerRow(maze.GetNumCols());	// # of words in each row
+	const uint32_t dimensions[2] = { uint32_t(maze.GetNumRows()), uint32_t(maze.GetNumCols()) };
+		// The header's # of rows and # of columns
+	ofstream dout(fileName.c_str(), ios::binary);	// The file to write
+	vector<uint64_t> walls;							// The packed walls of one row
+
+	if( !dout )
+	{
+		return false;
+
+	} // End if
+
+	try
+	{
+		walls.resize(wordsPerRow);
+		dout.write(BINARY_MAZE_MAGIC, BINARY_MAZE_MAGIC_SIZE);
+		dout.write(reinterpret_cast<const char*>(dimensions), sizeof(dimensions));
+
+		// Write each row of the bitmap
+		for(int row = 0; row < maze.GetNumRows(); row++)
+		{
+			maze.GetRowWalls(row, walls.data());
+			dout.write(reinterpret_cast<const char*>(walls.data()), wordsPerRow * sizeof(uint64_t));
+
+		} // End for
+
+	} // End try
+	catch(bad_alloc e)
+	{
+		throw OutOfMemoryException("OutOfMemoryException: The heap has run out of memory.");
+
+	} // End catch
+
+	dout.close();
+
+	return !dout.fail();
+
+} // End SaveBinary(const MazeClass& maze, const string& fileName)
\ No newline at end of file
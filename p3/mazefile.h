@@ -0,0 +1,224 @@
+/*
+AUTHOR:
+	Chris Pray
+
+DATE:
+	10/19/26
+
+FILENAME:
+	mazefile.h
+
+PURPOSE:
+	This file contains the specification for MazeFileClass, which loads a maze from a file into a
+	MazeClass object and saves one to a file, in either of two formats.
+
+	A text maze file holds the # of rows and the # of columns of the maze, followed by the row # and
+	column # of each wall, all separated by white space, as client.cpp has always read them. The file is
+	mapped into memory whole and its numbers are parsed with from_chars in one pass, instead of being
+	extracted one at a time from a stream. The walls are gathered into a packed bitmap and handed to
+	the maze a row at a time with SetRowWalls, instead of through a SetStatus call, and its bounds
+	checks and bitboard updates, per wall.
+
+	A binary maze file holds a header and then the walls as a packed bitmap:
+		Bytes 0-7		the magic bytes "P3MAZEB1"
+		Bytes 8-11		the # of rows, a 32-bit unsigned integer
+		Bytes 12-15		the # of columns, a 32-bit unsigned integer
+		Bytes 16-		for each row, (numCols + 63) / 64 64-bit words; bit (col % 64) of word
+						(col / 64) is set if column col of the row is a wall, and the bits past the
+						last column are clear
+	All integers are little-endian. The bitmap is laid out exactly like a row of the maze's wall
+	plane, so loading a binary maze file is a copy of each row, at the speed the disk can supply it.
+	The format of a file is told from its first eight bytes, not from its name.
+
+ASSUMPTIONS:
+	(1) The machine is little-endian.
+	(2) A text maze file begins with the dimensions of the maze, as positive integers.
+
+EXCEPTION HANDLING:
+	bad_alloc is caught if an attempt to allocate dynamic memory fails, and OutOfMemoryException is
+	thrown in its place.
+
+SUMMARY OF METHODS:
+
+	MazeFileClass()
+		Instantiates a MazeFileClass object with no file open.
+
+	~MazeFileClass()
+		Closes the file, if one is open.
+
+	bool Open(const string& fileName)
+		Maps a maze file into memory and reads its dimensions.
+
+	void Close()
+		Unmaps the file, if one is open.
+
+	bool IsBinary() const
+		Returns true if the open file is a binary maze file.
+
+	int GetNumRows() const
+		Returns the # of rows of the maze in the open file.
+
+	int GetNumCols() const
+		Returns the # of columns of the maze in the open file.
+
+	void LoadWalls(MazeClass& maze) const
+		Builds the walls of the maze in the open file in maze.
+
+	static bool SaveText(const MazeClass& maze, const string& fileName)
+		Writes maze to a text maze file.
+
+	static bool SaveBinary(const MazeClass& maze, const string& fileName)
+		Writes maze to a binary maze file.
+*/
+
+#ifndef MazeFile_h
+#define MazeFile_h
+
+#include "maze.h"	// For MazeClass
+#include<cstddef>	// For size_t
+#include<string>	// For string
+#include<vector>	// For vector
+using namespace std;
+
+const char BINARY_MAZE_MAGIC[] = "P3MAZEB1";	// First bytes of a binary maze file
+const int BINARY_MAZE_MAGIC_SIZE = 8;			// # of magic bytes
+const int BINARY_MAZE_HEADER_SIZE = 16;			// # of bytes before the wall bitmap
+
+class MazeFileClass
+{
+	public:
+
+		// Constructor and Destructor
+
+		MazeFileClass();
+		/*
+		Purpose:			Instantiates a MazeFileClass object with no file open.
+		Pre:				None
+		Post:				A MazeFileClass object with no file open has been instantiated.
+		Classification:		Default Constructor
+		Order of Magnitude:	O(1)
+		*/
+
+		~MazeFileClass();
+		/*
+		Purpose:			Closes the file, if one is open.
+		Pre:				A MazeFileClass object has been instantiated.
+		Post:				The file has been unmapped.
+		Classification:		Destructor
+		Order of Magnitude:	O(1)
+		*/
+
+
+		// ADT MazeFileClass Operations
+
+		bool Open(/* In */ const string& fileName);	// Name of the maze file
+		/*
+		Purpose:			Closes any file already open, maps the file named fileName into memory,
+							and reads the dimensions of its maze.
+		Pre:				A MazeFileClass object has been instantiated.
+		Post:				If the file was opened, and is a text maze file or a whole binary maze
+							file, it is mapped, its dimensions have been read and true has been
+							returned. Otherwise no file is open and false has been returned.
+		Classification:		Mutator
+		Order of Magnitude:	O(1)
+		Exceptions Thrown:	OutOfMemoryException
+		*/
+
+		void Close();
+		/*
+		Purpose:			Unmaps the file, if one is open.
+		Pre:				A MazeFileClass object has been instantiated.
+		Post:				No file is open.
+		Classification:		Mutator
+		Order of Magnitude:	O(1)
+		*/
+
+		bool IsBinary() const;
+		/*
+		Purpose:			Determines whether the open file is a binary maze file.
+		Pre:				A file has been opened.
+		Post:				True has been returned if the file is a binary maze file, false if it is a
+							text maze file.
+		Classification:		Observer / Predicator
+		Order of Magnitude:	O(1)
+		*/
+
+		int GetNumRows() const;
+		/*
+		Purpose:			Returns the # of rows of the maze in the open file.
+		Pre:				A file has been opened.
+		Post:				The # of rows has been returned.
+		Classification:		Observer / Accessor
+		Order of Magnitude:	O(1)
+		*/
+
+		int GetNumCols() const;
+		/*
+		Purpose:			Returns the # of columns of the maze in the open file.
+		Pre:				A file has been opened.
+		Post:				The # of columns has been returned.
+		Classification:		Observer / Accessor
+		Order of Magnitude:	O(1)
+		*/
+
+		void LoadWalls(/* In/Out */ MazeClass& maze) const;	// The maze to build
+		/*
+		Purpose:			Builds the walls of the maze in the open file in maze, a row at a time.
+							The walls of a text maze file are read until the end of the file or the
+							first token that is not a number, and walls outside the maze are ignored,
+							as SetStatus ignores them.
+		Pre:				A file has been opened. maze has GetNumRows() rows and GetNumCols()
+							columns.
+		Post:				Each location of maze is a WALL if the file lists it as one and UNVISITED
+							otherwise, with no directions tried.
+		Classification:		Observer / Accessor
+		Order of Magnitude:	O(N * M + S), where N = # of rows, M = # of columns and S = size of the
+							file
+		Exceptions Thrown:	OutOfMemoryException
+		*/
+
+		static bool SaveText(/* In */ const MazeClass& maze,			// The maze to save
+							 /* In */ const string&	   fileName);	// Name of the file to write
+		/*
+		Purpose:			Writes maze to the file named fileName as a text maze file, with one wall
+							per line, row by row.
+		Pre:				maze has been built.
+		Post:				If the file could be written, it holds maze and true has been returned.
+							Otherwise false has been returned.
+		Classification:		Observer / Accessor
+		Order of Magnitude:	O(N * M)
+		Exceptions Thrown:	OutOfMemoryException
+		*/
+
+		static bool SaveBinary(/* In */ const MazeClass& maze,			// The maze to save
+							   /* In */ const string&	 fileName);	// Name of the file to write
+		/*
+		Purpose:			Writes maze to the file named fileName as a binary maze file.
+		Pre:				maze has been built.
+		Post:				If the file could be written, it holds maze and true has been returned.
+							Otherwise false has been returned.
+		Classification:		Observer / Accessor
+		Order of Magnitude:	O(N * M / 64)
+		Exceptions Thrown:	OutOfMemoryException
+		*/
+
+
+	private:
+
+		MazeFileClass(/* In */ const MazeFileClass& orig);
+		void operator=(/* In */ const MazeFileClass& orig);
+		/*
+		Purpose:			Not defined; a MazeFileClass object owns a mapping and cannot be copied.
+		*/
+
+		const char* data;		// The contents of the open file, or NULL if none is open
+		size_t size;			// # of bytes in data
+		size_t wallsStart;		// Offset in data of the first wall
+		vector<char> buffer;	// Holds the contents where files cannot be mapped
+		bool binary;			// True if the open file is a binary maze file
+		int numRows;			// # of rows of the maze in the open file
+		int numCols;			// # of columns of the maze in the open file
+
+}; // End MazeFileClass
+
+#endif
\ No newline at end of file
@@ -0,0 +1,360 @@
+/*
+AUTHOR:
+	Chris Pray
+
+DATE:
+	10/19/26
+
+FILENAME:
+	mazegen.cpp
+
+PURPOSE:
+	This file contains the implementation for all of the methods declared in mazegen.h
+*/
+
+#include "mazegen.h"
+#include<new>		// For bad_alloc
+#include<utility>	// For swap
+
+const int NUM_NEIGHBOURS = 4;	// # of neighbouring cells a cell has: east, south, west and north
+
+// The change in row and column to the neighbouring cell in each direction; the passage between
+//  them is half way
+const int ROW_STEPS[NUM_NEIGHBOURS] = { 0, 2, 0, -2 };
+const int COL_STEPS[NUM_NEIGHBOURS] = { 2, 0, -2, 0 };
+
+
+//***************************************************************************************
+//*																						*
+//*								File-scope Helpers										*
+//*																						*
+//***************************************************************************************
+
+/*
+Purpose:	Finds the set that holds a cell, halving the path to it on the way.
+Pre:		parent holds a forest of sets, each cell pointing at itself or at another of its set.
+Post:		The cell at the root of the set has been returned.
+*/
+static int FindSet(/* In/Out */ vector<int>& parent,	// Parent of each cell in its set
+				   /* In */		int			 cell)		// The cell to find the set of
+{
+	while(parent[cell] != cell)
+	{
+		parent[cell] = parent[parent[cell]];
+		cell = parent[cell];
+
+	} // End while
+
+	return cell;
+
+} // End FindSet(vector<int>& parent, int cell)
+
+
+//***************************************************************************************
+//*																						*
+//*								Non-default Constructor									*
+//*																						*
+//***************************************************************************************
+
+// Non-default Constructor
+MazeGeneratorClass::MazeGeneratorClass(/* In */ const uint64_t seed)	// First state
+	: random(seed)
+{
+	numRows = 0;
+	numCols = 0;
+
+} // End MazeGeneratorClass(uint64_t seed)
+
+
+//***************************************************************************************
+//*																						*
+//*									Mutator												*
+//*																						*
+//***************************************************************************************
+
+void MazeGeneratorClass::Generate(/* In/Out */ MazeClass&			maze,		// The maze to build
+								  /* In */	   const MazeFamilyEnum family,		// Family to build
+								  /* In */	   const double			density)	// Braid or wall
+																				//  probability
+{
+	vector<uint64_t> rowWalls;	// The packed walls of one row
+
+	numRows = maze.GetNumRows();
+	numCols = maze.GetNumCols();
+
+	try
+	{
+		walls.assign(size_t(numRows) * numCols, 1);
+		rowWalls.resize((numCols + BITS_PER_WORD - 1) / BITS_PER_WORD);
+
+		// Branch depending on the family
+		switch( family )
+		{
+			case MAZE_BACKTRACKER: CarveBacktracker(); JoinExit(); break;
+
+			case MAZE_KRUSKAL: CarveKruskal(); JoinExit(); break;
+
+			case MAZE_BRAIDED: CarveBacktracker(); Braid(density); JoinExit(); break;
+
+			case MAZE_OPEN: walls.assign(walls.size(), 0); break;
+
+			case MAZE_RANDOM:
+			{
+				for(size_t i = 0; i < walls.size(); i++)
+				{
+					walls[i] = NextChance(density);
+
+				} // End for
+
+				walls.front() = 0;
+				walls.back() = 0;
+				break;
+
+			} // End case
+
+		} // End switch
+
+		// Hand the walls to the maze a row at a time
+		for(int r = 0; r < numRows; r++)
+		{
+			rowWalls.assign(rowWalls.size(), 0);
+
+			for(int c = 0; c < numCols; c++)
+			{
+				if(walls[size_t(r) * numCols + c])
+				{
+					rowWalls[c / BITS_PER_WORD] |= uint64_t(1) << (c % BITS_PER_WORD);
+
+				} // End if
+
+			} // End for
+
+			maze.SetRowWalls(r, rowWalls.data());
+
+		} // End for
+
+	} // End try
+	catch(bad_alloc e)
+	{
+		throw OutOfMemoryException("OutOfMemoryException: The heap has run out of memory.");
+
+	} // End catch
+
+	vector<unsigned char>().swap(walls);
+
+} // End Generate(MazeClass& maze, MazeFamilyEnum family, double density)
+
+//***************************************************************************************
+
+uint64_t MazeGeneratorClass::NextBelow(/* In */ const uint64_t bound)	// One more than the largest
+{
+	return random() % bound;
+
+} // End NextBelow(uint64_t bound)
+
+//***************************************************************************************
+
+bool MazeGeneratorClass::NextChance(/* In */ const double probability)	// Chance of returning true
+{
+	// The top 53 bits give a number from 0 up to, but not including, 1
+	return double(random() >> 11) / double(uint64_t(1) << 53) < probability;
+
+} // End NextChance(double probability)
+
+//***************************************************************************************
+
+void MazeGeneratorClass::CarveBacktracker()
+{
+	vector<int> path;				// The cells from the first cell to the current one
+	int neighbours[NUM_NEIGHBOURS];	// Directions to the uncarved neighbouring cells
+	int numNeighbours;				// # of entries in neighbours
+	int row;						// Row # of the current cell
+	int col;						// Column # of the current cell
+	int nextRow;					// Row # of a neighbouring cell
+	int nextCol;					// Column # of a neighbouring cell
+	int d;							// A direction
+
+	walls[0] = 0;
+	path.push_back(0);
+
+	// While some cell on the path may still have an uncarved neighbour
+	while( !path.empty() )
+	{
+		row = path.back() / numCols;
+		col = path.back() % numCols;
+		numNeighbours = 0;
+
+		// Gather the neighbouring cells that are still walls
+		for(d = 0; d < NUM_NEIGHBOURS; d++)
+		{
+			nextRow = row + ROW_STEPS[d];
+			nextCol = col + COL_STEPS[d];
+
+			if( nextRow >= 0 && nextRow < numRows && nextCol >= 0 && nextCol < numCols &&
+				walls[size_t(nextRow) * numCols + nextCol] )
+			{
+				neighbours[numNeighbours++] = d;
+
+			} // End if
+
+		} // End for
+
+		// If there is one, carve through to a random one and go on from it
+		if(numNeighbours > 0)
+		{
+			d = neighbours[NextBelow(numNeighbours)];
+			nextRow = row + ROW_STEPS[d];
+			nextCol = col + COL_STEPS[d];
+
+			walls[size_t(row + ROW_STEPS[d] / 2) * numCols + col + COL_STEPS[d] / 2] = 0;
+			walls[size_t(nextRow) * numCols + nextCol] = 0;
+			path.push_back(nextRow * numCols + nextCol);
+
+		} // End if
+		// Else back up to the cell before
+		else
+		{
+			path.pop_back();
+
+		} // End else
+
+	} // End while
+
+} // End CarveBacktracker()
+
+//***************************************************************************************
+
+void MazeGeneratorClass::CarveKruskal()
+{
+	vector<int> parent;		// Parent of each cell in the set of cells it is joined to
+	vector<int> passages;	// Location of each passage between two cells, in random order
+	int row;				// Row # of a passage
+	int col;				// Column # of a passage
+	int first;				// The cell west of or north of a passage
+	int second;				// The cell east of or south of a passage
+
+	parent.resize(walls.size());
+
+	// Open every cell, each in a set of its own, and gather the passages between them
+	for(row = 0; row < numRows; row++)
+	{
+		for(col = 0; col < numCols; col++)
+		{
+			if(row % 2 == 0 && col % 2 == 0)
+			{
+				walls[size_t(row) * numCols + col] = 0;
+				parent[row * numCols + col] = row * numCols + col;
+
+			} // End if
+			// Else if between two cells across a row or down a column
+			else if( (row % 2 == 0 && col + 1 < numCols) || (col % 2 == 0 && row + 1 < numRows) )
+			{
+				passages.push_back(row * numCols + col);
+
+			} // End else if
+
+		} // End for
+
+	} // End for
+
+	// Shuffle the passages
+	for(size_t i = passages.size(); i > 1; i--)
+	{
+		swap(passages[i - 1], passages[NextBelow(i)]);
+
+	} // End for
+
+	// Open each passage that joins two cells not yet joined
+	for(size_t i = 0; i < passages.size(); i++)
+	{
+		row = passages[i] / numCols;
+		col = passages[i] % numCols;
+
+		// A passage in an even row joins the cells west and east of it; one in an even column, the
+		//  cells north and south of it
+		first = row % 2 == 0 ? passages[i] - 1 : passages[i] - numCols;
+		second = row % 2 == 0 ? passages[i] + 1 : passages[i] + numCols;
+
+		first = FindSet(parent, first);
+		second = FindSet(parent, second);
+
+		if(first != second)
+		{
+			parent[first] = second;
+			walls[passages[i]] = 0;
+
+		} // End if
+
+	} // End for
+
+} // End CarveKruskal()
+
+//***************************************************************************************
+
+void MazeGeneratorClass::Braid(/* In */ const double density)	// Chance of braiding each dead end
+{
+	int closed[NUM_NEIGHBOURS];	// Directions to neighbouring cells behind a wall
+	int numClosed;				// # of entries in closed
+	int numOpen;				// # of open passages from the current cell
+	int passageRow;				// Row # of a passage
+	int passageCol;				// Column # of a passage
+	int d;						// A direction
+
+	// For each cell, in row order
+	for(int row = 0; row < numRows; row += 2)
+	{
+		for(int col = 0; col < numCols; col += 2)
+		{
+			numOpen = 0;
+			numClosed = 0;
+
+			// Sort the passages to its neighbouring cells into open and closed
+			for(d = 0; d < NUM_NEIGHBOURS; d++)
+			{
+				if( row + ROW_STEPS[d] >= 0 && row + ROW_STEPS[d] < numRows &&
+					col + COL_STEPS[d] >= 0 && col + COL_STEPS[d] < numCols )
+				{
+					passageRow = row + ROW_STEPS[d] / 2;
+					passageCol = col + COL_STEPS[d] / 2;
+
+					if(walls[size_t(passageRow) * numCols + passageCol])
+					{
+						closed[numClosed++] = d;
+
+					} // End if
+					else
+					{
+						numOpen++;
+
+					} // End else
+
+				} // End if
+
+			} // End for
+
+			// If the cell is a dead end, maybe knock out one of its walls
+			if(numOpen == 1 && numClosed > 0 && NextChance(density))
+			{
+				d = closed[NextBelow(numClosed)];
+				walls[size_t(row + ROW_STEPS[d] / 2) * numCols + col + COL_STEPS[d] / 2] = 0;
+
+			} // End if
+
+		} // End for
+
+	} // End for
+
+} // End Braid(double density)
+
+//***************************************************************************************
+
+void MazeGeneratorClass::JoinExit()
+{
+	const int lastRow = (numRows - 1) / 2 * 2;	// Row # of the last row of cells
+
+	// Open the way east from the last cell of the last row of cells to the last column, then south
+	//  to the exit; each step is either a cell, already open, or a single location
+	walls[size_t(lastRow) * numCols + numCols - 1] = 0;
+	walls[size_t(numRows - 1) * numCols + numCols - 1] = 0;
+
+} // End JoinExit()
\ No newline at end of file
@@ -0,0 +1,169 @@
+/*
+AUTHOR:
+	Chris Pray
+
+DATE:
+	10/19/26
+
+FILENAME:
+	mazegen.h
+
+PURPOSE:
+	This file contains the specification for MazeGeneratorClass, which builds the walls of a MazeClass
+	object from one of several families of mazes, at any size, so that a corpus of mazes can be made
+	for measuring the solvers. The same seed always builds the same maze, on any platform: the random
+	numbers come from mt19937_64, whose output the standard fixes, and are mapped onto ranges without
+	the standard distributions, whose output it does not.
+
+	The families are:
+		MAZE_BACKTRACKER	A perfect maze, with exactly one path from the entrance to the exit, carved
+							by a randomized depth-first search. It has long winding corridors.
+		MAZE_KRUSKAL		A perfect maze carved by Kruskal's algorithm, joining randomly chosen
+							neighbouring cells that are not yet connected. It has many short dead ends.
+		MAZE_BRAIDED		A backtracker maze in which each dead end, with probability density, has a
+							wall knocked out to join it to another cell, making loops. At density 0 it
+							is perfect; at density 1 it has no dead ends.
+		MAZE_OPEN			No walls at all.
+		MAZE_RANDOM			Each location other than the entrance and the exit is a wall with
+							probability density.
+
+	The perfect and braided families carve on a lattice: the cells are the locations whose row # and
+	column # are both even, and the locations between two cells are the passages that may be carved
+	between them. Every other location is a wall. When the # of rows or columns is even, the last row
+	or column holds no cells, and a short corridor joins the exit to the nearest cell.
+
+	The new walls replace those of the maze a row at a time, through SetRowWalls.
+
+ASSUMPTIONS:
+	(1) numRows * numCols of the maze fits in an int.
+
+EXCEPTION HANDLING:
+	bad_alloc is caught if an attempt to allocate dynamic memory fails, and OutOfMemoryException is
+	thrown in its place.
+
+SUMMARY OF METHODS:
+
+	MazeGeneratorClass(uint64_t seed)
+		Instantiates a MazeGeneratorClass object whose random numbers start from seed.
+
+	void Generate(MazeClass& maze, MazeFamilyEnum family, double density)
+		Builds the walls of a maze of the given family in maze.
+*/
+
+#ifndef MazeGenerator_h
+#define MazeGenerator_h
+
+#include "maze.h"	// For MazeClass
+#include<cstdint>	// For uint64_t
+#include<random>	// For mt19937_64
+#include<vector>	// For vector
+using namespace std;
+
+enum MazeFamilyEnum { MAZE_BACKTRACKER, MAZE_KRUSKAL, MAZE_BRAIDED, MAZE_OPEN, MAZE_RANDOM };
+
+class MazeGeneratorClass
+{
+	public:
+
+		// Constructor
+
+		MazeGeneratorClass(/* In */ const uint64_t seed);	// First state of the random numbers
+		/*
+		Purpose:			Instantiates a MazeGeneratorClass object whose random numbers start from
+							seed.
+		Pre:				None
+		Post:				A MazeGeneratorClass object has been instantiated.
+		Classification:		Non-default Constructor
+		Order of Magnitude:	O(1)
+		*/
+
+
+		// ADT MazeGeneratorClass Operations
+
+		void Generate(/* In/Out */ MazeClass&			maze,		// The maze to build
+					  /* In */	   const MazeFamilyEnum family,		// The family of maze to build
+					  /* In */	   const double			density);	// Braid or wall probability
+		/*
+		Purpose:			Builds the walls of a maze of the given family in maze. density is the
+							probability that a dead end is braided for MAZE_BRAIDED, or that a location
+							is a wall for MAZE_RANDOM, and is not used for the other families.
+		Pre:				maze has been built. 0 <= density <= 1.
+		Post:				Every location of maze is a WALL or UNVISITED, as the new maze has it,
+							with no directions tried. The entrance and the exit are not walls and, for
+							every family but MAZE_RANDOM, are joined by a path. The random numbers have
+							moved on, so the next call builds a different maze.
+		Classification:		Mutator
+		Order of Magnitude:	O(N * M), where N = # of rows and M = # of columns
+		Exceptions Thrown:	OutOfMemoryException
+		*/
+
+
+	private:
+
+		uint64_t NextBelow(/* In */ const uint64_t bound);	// One more than the largest value wanted
+		/*
+		Purpose:			Returns the next random number from 0 to bound - 1.
+		Pre:				bound > 0.
+		Post:				The number has been returned.
+		Classification:		Mutator
+		Order of Magnitude:	O(1)
+		*/
+
+		bool NextChance(/* In */ const double probability);	// Chance of returning true
+		/*
+		Purpose:			Returns true with the given probability.
+		Pre:				0 <= probability <= 1.
+		Post:				True or false has been returned.
+		Classification:		Mutator
+		Order of Magnitude:	O(1)
+		*/
+
+		void CarveBacktracker();
+		/*
+		Purpose:			Carves a perfect maze into walls by a randomized depth-first search from
+							the cell at the entrance.
+		Pre:				walls marks every location a wall.
+		Post:				Every cell, and one passage into each cell but the first, is open.
+		Classification:		Mutator
+		Order of Magnitude:	O(N * M)
+		Exceptions Thrown:	bad_alloc
+		*/
+
+		void CarveKruskal();
+		/*
+		Purpose:			Carves a perfect maze into walls by Kruskal's algorithm.
+		Pre:				walls marks every location a wall.
+		Post:				Every cell is open, and the passages that join them into a tree are open.
+		Classification:		Mutator
+		Order of Magnitude:	O(N * M)
+		Exceptions Thrown:	bad_alloc
+		*/
+
+		void Braid(/* In */ const double density);	// Chance of braiding each dead end
+		/*
+		Purpose:			Opens a passage from each dead-end cell, with probability density, to a
+							random neighbouring cell it is not yet joined to.
+		Pre:				walls holds a carved maze.
+		Post:				The braided dead ends have a second open passage.
+		Classification:		Mutator
+		Order of Magnitude:	O(N * M)
+		*/
+
+		void JoinExit();
+		/*
+		Purpose:			Opens the exit and, when it is not a cell, a corridor from the last cell of
+							the lattice to it.
+		Pre:				walls holds a carved maze.
+		Post:				The exit is open and joined to the maze.
+		Classification:		Mutator
+		Order of Magnitude:	O(1)
+		*/
+
+		mt19937_64 random;				// The random numbers
+		int numRows;					// # of rows in the maze being built
+		int numCols;					// # of columns in the maze being built
+		vector<unsigned char> walls;	// 1 for each wall of the maze being built, row by row
+
+}; // End MazeGeneratorClass
+
+#endif
\ No newline at end of file
@@ -0,0 +1,776 @@
+/*
+AUTHOR:
+	Chris Pray
+
+DATE:
+	10/19/26
+
+FILENAME:
+	pathcount.cpp
+
+PURPOSE:
+	This file contains the implementation for all of the methods declared in pathcount.h
+*/
+
+#include "pathcount.h"
+#include<map>				// For map
+#include<new>				// For bad_alloc
+#include<unordered_map>		// For unordered_map
+
+
+//***************************************************************************************
+//*																						*
+//*								File-scope Helpers										*
+//*																						*
+//***************************************************************************************
+
+/*
+Purpose:	Returns plug plug of frontier key.
+Pre:		0 <= plug <= MAX_FRONTIER_WIDTH.
+Post:		The plug's PlugEnum value has been returned.
+*/
+static int GetPlug(/* In */ const uint64_t key,		// The frontier
+				   /* In */ const int	   plug)	// Index of the plug
+{
+	return int(key >> (2 * plug)) & 3;
+
+} // End GetPlug(uint64_t key, int plug)
+
+//***************************************************************************************
+
+/*
+Purpose:	Returns frontier key with plug plug set to value.
+Pre:		0 <= plug <= MAX_FRONTIER_WIDTH. value is a PlugEnum.
+Post:		The changed frontier has been returned.
+*/
+static uint64_t SetPlug(/* In */ const uint64_t key,	// The frontier
+						/* In */ const int		plug,	// Index of the plug
+						/* In */ const int		value)	// The plug's new value
+{
+	return (key & ~(uint64_t(3) << (2 * plug))) | (uint64_t(value) << (2 * plug));
+
+} // End SetPlug(uint64_t key, int plug, int value)
+
+
+//***************************************************************************************
+//*																						*
+//*								Non-default Constructor									*
+//*																						*
+//***************************************************************************************
+
+// Non-default Constructor
+PathCounterClass::PathCounterClass(/* In */ const MazeClass& maze)	// The maze whose paths are
+																	//  counted
+{
+	// Sweep along the shorter dimension, so the frontier is as narrow as it can be
+	transposed = maze.GetNumCols() > maze.GetNumRows();
+	numRows = transposed ? maze.GetNumCols() : maze.GetNumRows();
+	numCols = transposed ? maze.GetNumRows() : maze.GetNumCols();
+	exhausted = false;
+
+	if(numCols > MAX_FRONTIER_WIDTH)
+	{
+		throw MazeTooWideException("MazeTooWideException: Paths can only be counted in a maze with "
+			"at most 31 rows or\n                      at most 31 columns.");
+
+	} // End if
+
+	try
+	{
+		open.resize(size_t(numRows) * numCols);
+
+		// Copy each location's wall, in sweep order
+		for(int r = 0; r < numRows; r++)
+		{
+			for(int c = 0; c < numCols; c++)
+			{
+				open[size_t(r) * numCols + c] =
+					(transposed ? maze.GetStatus(c, r) : maze.GetStatus(r, c)) != WALL;
+
+			} // End for
+
+		} // End for
+
+	} // End try
+	catch(bad_alloc e)
+	{
+		throw OutOfMemoryException("OutOfMemoryException: The heap has run out of memory.");
+
+	} // End catch
+
+} // End PathCounterClass(const MazeClass& maze)
+
+
+//***************************************************************************************
+//*																						*
+//*								Observer / Summarizer									*
+//*																						*
+//***************************************************************************************
+
+BigCountClass PathCounterClass::CountPaths() const
+{
+	const int numLocations = numRows * numCols;	// # of locations to sweep
+	unordered_map<uint64_t, BigCountClass> frontier;	// Count of the ways to reach each key
+	unordered_map<uint64_t, BigCountClass> next;		// Counts of the keys after one more location
+	uint64_t successors[2];		// The keys after a location
+	unsigned char choices[2];	// How each successor uses the location
+	int numSuccessors;			// # of successors
+
+	// If the entrance or the exit is a wall, no path can get in or out; otherwise the empty
+	//  frontier would carry through every location and be counted as a path
+	if( !open[0] || !open[numLocations - 1] )
+	{
+		return BigCountClass();
+
+	} // End if
+
+	// A maze of one location has one path, straight in and straight out
+	if(numLocations == 1)
+	{
+		return BigCountClass(1);
+
+	} // End if
+
+	try
+	{
+		// Before anything is swept, there is one way to have an empty frontier
+		frontier[0] = BigCountClass(1);
+
+		// Sweep each location, adding the count of every key to each of its successors
+		for(int k = 0; k < numLocations; k++)
+		{
+			next.clear();
+
+			for(const auto& entry : frontier)
+			{
+				numSuccessors = Advance(entry.first, k / numCols, k % numCols, successors, choices);
+
+				for(int i = 0; i < numSuccessors; i++)
+				{
+					next[successors[i]] += entry.second;
+
+				} // End for
+
+			} // End for
+
+			frontier.swap(next);
+
+		} // End for
+
+	} // End try
+	catch(bad_alloc e)
+	{
+		throw OutOfMemoryException("OutOfMemoryException: The heap has run out of memory.");
+
+	} // End catch
+
+	// Once everything is swept, only the empty frontier is a finished path
+	if(frontier.count(0) == 0)
+	{
+		return BigCountClass();
+
+	} // End if
+
+	return frontier[0];
+
+} // End CountPaths()
+
+
+//***************************************************************************************
+//*																						*
+//*									Mutator												*
+//*																						*
+//***************************************************************************************
+
+BigCountClass PathCounterClass::BuildDiagram()
+{
+	const int numLocations = numRows * numCols;		// # of locations to sweep
+	vector<uint64_t> keys;			// Key of each node in the level being swept
+	vector<uint64_t> nextKeys;		// Key of each node in the next level
+	unordered_map<uint64_t, int> nodeIndexes;	// Index in the next level of each key
+	map< vector<int>, int > mergedIndexes;		// Index of the node kept for each set of arcs
+	vector<int> remap;				// New index of each node in a level, or -1 if it is removed
+	vector<int> nextRemap;			// New index of each node in the level below
+	vector< vector<DiagramNodeType> > reduced;	// The reduced diagram
+	vector<BigCountClass> counts;	// # of ways to reach each node of a level
+	vector<BigCountClass> nextCounts;	// # of ways to reach each node of the next level
+	vector<int> arcs;				// The arcs of a node, used to find its twins
+	uint64_t successors[2];			// The keys after a location
+	unsigned char choices[2];		// How each successor uses the location
+	int numSuccessors;				// # of successors
+	DiagramNodeType node;			// A node being built
+	BigCountClass total;			// # of paths
+
+	levels.clear();
+	pathNodes.clear();
+	pathArcs.clear();
+	exhausted = false;
+
+	// If the entrance or the exit is a wall, there is no path, and the diagram is left empty
+	if( !open[0] || !open[numLocations - 1] )
+	{
+		return total;
+
+	} // End if
+
+	try
+	{
+		// A maze of one location has one path, and its diagram is a single level
+		if(numLocations == 1)
+		{
+			levels.resize(1);
+			node.numChildren = 0;
+			levels[0].push_back(node);
+			return BigCountClass(1);
+
+		} // End if
+
+		levels.resize(numLocations + 1);
+		keys.push_back(0);
+		node.numChildren = 0;
+		levels[0].push_back(node);
+
+		// Sweep each location, giving each node an arc to the node of each of its successors
+		for(int k = 0; k < numLocations; k++)
+		{
+			nodeIndexes.clear();
+			nextKeys.clear();
+
+			for(size_t i = 0; i < levels[k].size(); i++)
+			{
+				numSuccessors = Advance(keys[i], k / numCols, k % numCols, successors, choices);
+				levels[k][i].numChildren = (unsigned char)numSuccessors;
+
+				for(int j = 0; j < numSuccessors; j++)
+				{
+					// If the successor is new, add a node for it to the next level
+					if(nodeIndexes.count(successors[j]) == 0)
+					{
+						nodeIndexes[successors[j]] = int(nextKeys.size());
+						nextKeys.push_back(successors[j]);
+						node.numChildren = 0;
+						levels[k + 1].push_back(node);
+
+					} // End if
+
+					levels[k][i].children[j] = nodeIndexes[successors[j]];
+					levels[k][i].choices[j] = choices[j];
+
+				} // End for
+
+			} // End for
+
+			keys.swap(nextKeys);
+
+		} // End for
+
+		// Reduce the diagram from the bottom up: keep only the final node, with the empty key, at
+		//  the last level, then at each level above drop arcs to removed nodes, remove nodes left
+		//  with no arcs, and merge nodes whose arcs are the same
+		reduced.resize(numLocations + 1);
+		nextRemap.assign(levels[numLocations].size(), -1);
+
+		for(size_t i = 0; i < keys.size(); i++)
+		{
+			if(keys[i] == 0)
+			{
+				nextRemap[i] = 0;
+				reduced[numLocations].push_back(levels[numLocations][i]);
+
+			} // End if
+
+		} // End for
+
+		for(int k = numLocations - 1; k >= 0; k--)
+		{
+			remap.assign(levels[k].size(), -1);
+			mergedIndexes.clear();
+
+			for(size_t i = 0; i < levels[k].size(); i++)
+			{
+				node.numChildren = 0;
+				arcs.clear();
+
+				// Keep the arcs to nodes that were kept
+				for(int j = 0; j < levels[k][i].numChildren; j++)
+				{
+					if(nextRemap[levels[k][i].children[j]] >= 0)
+					{
+						node.children[node.numChildren] = nextRemap[levels[k][i].children[j]];
+						node.choices[node.numChildren] = levels[k][i].choices[j];
+						arcs.push_back(node.children[node.numChildren]);
+						arcs.push_back(node.choices[node.numChildren]);
+						node.numChildren++;
+
+					} // End if
+
+				} // End for
+
+				// If the node still leads to the final node, keep it or merge it with its twin
+				if(node.numChildren > 0)
+				{
+					if(mergedIndexes.count(arcs) == 0)
+					{
+						mergedIndexes[arcs] = int(reduced[k].size());
+						reduced[k].push_back(node);
+
+					} // End if
+
+					remap[i] = mergedIndexes[arcs];
+
+				} // End if
+
+			} // End for
+
+			// The level below is no longer needed
+			vector<DiagramNodeType>().swap(levels[k + 1]);
+			nextRemap.swap(remap);
+
+		} // End for
+
+		levels.swap(reduced);
+
+		// If no path survived, leave the diagram empty
+		if(levels[0].empty())
+		{
+			levels.clear();
+			return total;
+
+		} // End if
+
+		// Count the paths by counting the ways to reach each node, level by level
+		counts.assign(1, BigCountClass(1));
+
+		for(int k = 0; k < numLocations; k++)
+		{
+			nextCounts.assign(levels[k + 1].size(), BigCountClass());
+
+			for(size_t i = 0; i < levels[k].size(); i++)
+			{
+				for(int j = 0; j < levels[k][i].numChildren; j++)
+				{
+					nextCounts[levels[k][i].children[j]] += counts[i];
+
+				} // End for
+
+			} // End for
+
+			counts.swap(nextCounts);
+
+		} // End for
+
+		total = counts[0];
+
+	} // End try
+	catch(bad_alloc e)
+	{
+		levels.clear();
+		throw OutOfMemoryException("OutOfMemoryException: The heap has run out of memory.");
+
+	} // End catch
+
+	return total;
+
+} // End BuildDiagram()
+
+//***************************************************************************************
+
+bool PathCounterClass::NextPath(/* Out */ string& directions)	// Gets the next path
+{
+	const int numLocations = int(levels.size()) - 1;	// # of levels with arcs
+	vector<unsigned char> used;		// The edges the path uses out of each location
+	int k;							// A level of the diagram
+
+	// If there is no diagram, or every path has been got
+	if(levels.empty() || levels[0].empty() || exhausted)
+	{
+		return false;
+
+	} // End if
+
+	try
+	{
+		// If this is the first path, start from the top of the diagram
+		if(pathNodes.empty())
+		{
+			pathNodes.assign(numLocations + 1, 0);
+			pathArcs.assign(numLocations, 0);
+			k = 0;
+
+		} // End if
+		// Else find the deepest node with an arc not yet taken, and take it
+		else
+		{
+			k = numLocations - 1;
+
+			while( k >= 0 && pathArcs[k] + 1 >= levels[k][pathNodes[k]].numChildren )
+			{
+				k--;
+
+			} // End while
+
+			if(k < 0)
+			{
+				exhausted = true;
+				return false;
+
+			} // End if
+
+			pathArcs[k]++;
+			pathNodes[k + 1] = levels[k][pathNodes[k]].children[pathArcs[k]];
+			k++;
+
+		} // End else
+
+		// Follow the first arc down from there; every node leads to the final node
+		for( ; k < numLocations; k++)
+		{
+			pathArcs[k] = 0;
+			pathNodes[k + 1] = levels[k][pathNodes[k]].children[0];
+
+		} // End for
+
+		// Gather the edges the path uses out of each location and trace it
+		used.resize(numLocations);
+
+		for(k = 0; k < numLocations; k++)
+		{
+			used[k] = levels[k][pathNodes[k]].choices[pathArcs[k]];
+
+		} // End for
+
+		TracePath(used, directions);
+
+	} // End try
+	catch(bad_alloc e)
+	{
+		throw OutOfMemoryException("OutOfMemoryException: The heap has run out of memory.");
+
+	} // End catch
+
+	return true;
+
+} // End NextPath(string& directions)
+
+
+//***************************************************************************************
+//*																						*
+//*								Observer / Accessor										*
+//*																						*
+//***************************************************************************************
+
+int PathCounterClass::GetDiagramSize() const
+{
+	int numNodes = 0;	// # of nodes counted so far
+
+	// Count the nodes of every level but the last, which holds only the final node
+	for(size_t k = 0; k + 1 < levels.size(); k++)
+	{
+		numNodes += int(levels[k].size());
+
+	} // End for
+
+	return numNodes;
+
+} // End GetDiagramSize()
+
+//***************************************************************************************
+
+int PathCounterClass::Advance(/* In */  const uint64_t key,			// Frontier before the location
+							  /* In */  const int	   row,			// Row # of the location
+							  /* In */  const int	   col,			// Column # of the location
+							  /* Out */ uint64_t	   successors[2],	// Gets the frontiers after it
+							  /* Out */ unsigned char  choices[2]) const	// Gets how each uses it
+{
+	const int left = GetPlug(key, col);			// Plug on the edge in from the left
+	const int up = GetPlug(key, col + 1);		// Plug on the edge in from above
+	const size_t here = size_t(row) * numCols + col;	// Index of the location in open
+
+	// The other plugs, which the location leaves alone
+	const uint64_t rest = SetPlug(SetPlug(key, col, PLUG_NONE), col + 1, PLUG_NONE);
+
+	// Whether the path can leave the location down or right, and whether it ends there
+	const bool canGoDown = row < numRows - 1 && open[here + numCols];
+	const bool canGoRight = col < numCols - 1 && open[here + 1];
+	const bool isEnd = (row == 0 && col == 0) || (row == numRows - 1 && col == numCols - 1);
+
+	int numSuccessors = 0;	// # of ways the path can use the location
+	int plug;				// Index of the plug coming in, when only one comes in
+
+	// If the location is a wall, no path can use it
+	if( !open[here] )
+	{
+		if(left == PLUG_NONE && up == PLUG_NONE)
+		{
+			successors[numSuccessors] = rest;
+			choices[numSuccessors++] = USES_NONE;
+
+		} // End if
+
+	} // End if
+	// Else if the location is the entrance or the exit, the path ends there
+	else if(isEnd)
+	{
+		// If no path comes in, start a piece of path going down or right
+		if(left == PLUG_NONE && up == PLUG_NONE)
+		{
+			if(canGoDown)
+			{
+				successors[numSuccessors] = SetPlug(rest, col, PLUG_END);
+				choices[numSuccessors++] = USES_DOWN;
+
+			} // End if
+
+			if(canGoRight)
+			{
+				successors[numSuccessors] = SetPlug(rest, col + 1, PLUG_END);
+				choices[numSuccessors++] = USES_RIGHT;
+
+			} // End if
+
+		} // End if
+		// Else if one piece of path comes in, end it here
+		else if(left == PLUG_NONE || up == PLUG_NONE)
+		{
+			plug = left != PLUG_NONE ? col : col + 1;
+
+			// If the piece already joins the other end, the path is finished, as long as nothing
+			//  else is left on the frontier
+			if(GetPlug(key, plug) == PLUG_END)
+			{
+				if(rest == 0)
+				{
+					successors[numSuccessors] = rest;
+					choices[numSuccessors++] = USES_NONE;
+
+				} // End if
+
+			} // End if
+			// Else the other end of the piece now leads to this end
+			else
+			{
+				successors[numSuccessors] = SetPlug(rest, MatchPlug(key, plug), PLUG_END);
+				choices[numSuccessors++] = USES_NONE;
+
+			} // End else
+
+		} // End else if
+
+	} // End else if
+	// Else if no path comes in, leave the location out or pass through it from down to right
+	else if(left == PLUG_NONE && up == PLUG_NONE)
+	{
+		successors[numSuccessors] = rest;
+		choices[numSuccessors++] = USES_NONE;
+
+		if(canGoDown && canGoRight)
+		{
+			successors[numSuccessors] = SetPlug(SetPlug(rest, col, PLUG_OPEN), col + 1, PLUG_CLOSE);
+			choices[numSuccessors++] = USES_BOTH;
+
+		} // End if
+
+	} // End else if
+	// Else if one piece of path comes in, carry it on down or right
+	else if(left == PLUG_NONE || up == PLUG_NONE)
+	{
+		if(canGoDown)
+		{
+			successors[numSuccessors] = SetPlug(rest, col, left | up);
+			choices[numSuccessors++] = USES_DOWN;
+
+		} // End if
+
+		if(canGoRight)
+		{
+			successors[numSuccessors] = SetPlug(rest, col + 1, left | up);
+			choices[numSuccessors++] = USES_RIGHT;
+
+		} // End if
+
+	} // End else if
+	// Else two pieces of path come in and are joined here
+	else
+	{
+		// If both are left ends, the right end of the inner piece becomes a left end
+		if(left == PLUG_OPEN && up == PLUG_OPEN)
+		{
+			successors[numSuccessors] = SetPlug(rest, MatchPlug(key, col + 1), PLUG_OPEN);
+			choices[numSuccessors++] = USES_NONE;
+
+		} // End if
+		// Else if both are right ends, the left end of the inner piece becomes a right end
+		else if(left == PLUG_CLOSE && up == PLUG_CLOSE)
+		{
+			successors[numSuccessors] = SetPlug(rest, MatchPlug(key, col), PLUG_CLOSE);
+			choices[numSuccessors++] = USES_NONE;
+
+		} // End else if
+		// Else if a right end meets a left end, the two pieces become one
+		else if(left == PLUG_CLOSE && up == PLUG_OPEN)
+		{
+			successors[numSuccessors] = rest;
+			choices[numSuccessors++] = USES_NONE;
+
+		} // End else if
+		// Else if a piece from an end meets a piece between two plugs, the far plug now leads to
+		//  that end
+		else if(left == PLUG_END && up != PLUG_END)
+		{
+			successors[numSuccessors] = SetPlug(rest, MatchPlug(key, col + 1), PLUG_END);
+			choices[numSuccessors++] = USES_NONE;
+
+		} // End else if
+		else if(up == PLUG_END && left != PLUG_END)
+		{
+			successors[numSuccessors] = SetPlug(rest, MatchPlug(key, col), PLUG_END);
+			choices[numSuccessors++] = USES_NONE;
+
+		} // End else if
+
+		// Else the two ends of one piece would close a loop, or the pieces from the entrance and
+		//  the exit would meet away from both, and the key is dropped
+
+	} // End else
+
+	// If the location ends its row, shift the frontier to start the next row; the plug on the
+	//  edge right out of the row is always empty
+	if(col == numCols - 1)
+	{
+		for(int i = 0; i < numSuccessors; i++)
+		{
+			successors[i] <<= 2;
+
+		} // End for
+
+	} // End if
+
+	return numSuccessors;
+
+} // End Advance(uint64_t key, int row, int col, uint64_t successors[2], unsigned char choices[2])
+
+//***************************************************************************************
+
+int PathCounterClass::MatchPlug(/* In */ const uint64_t key,		// The frontier
+								/* In */ const int	  plug) const	// Index of the plug to match
+{
+	int depth = 0;	// # of pieces opened and not yet closed between plug and the current plug
+	int value;		// Value of the current plug
+
+	// If plug is a left end, its match is the first unmatched right end to its right
+	if(GetPlug(key, plug) == PLUG_OPEN)
+	{
+		for(int i = plug + 1; i <= numCols; i++)
+		{
+			value = GetPlug(key, i);
+
+			if(value == PLUG_OPEN)
+			{
+				depth++;
+
+			} // End if
+			else if(value == PLUG_CLOSE)
+			{
+				if(depth == 0)
+				{
+					return i;
+
+				} // End if
+
+				depth--;
+
+			} // End else if
+
+		} // End for
+
+	} // End if
+	// Else plug is a right end, and its match is the first unmatched left end to its left
+	else
+	{
+		for(int i = plug - 1; i >= 0; i--)
+		{
+			value = GetPlug(key, i);
+
+			if(value == PLUG_CLOSE)
+			{
+				depth++;
+
+			} // End if
+			else if(value == PLUG_OPEN)
+			{
+				if(depth == 0)
+				{
+					return i;
+
+				} // End if
+
+				depth--;
+
+			} // End else if
+
+		} // End for
+
+	} // End else
+
+	return plug;
+
+} // End MatchPlug(uint64_t key, int plug)
+
+//***************************************************************************************
+
+void PathCounterClass::TracePath(/* In */  const vector<unsigned char>& used,		// Choices
+								 /* Out */ string&						directions) const	// Path
+{
+	// Names of the moves east, south, west and north in sweep order; when the maze was transposed,
+	//  a move along a swept row is a move down a column of the maze
+	const char* const SWEEP_NAMES[4] = { "EAST ", "SOUTH ", "WEST ", "NORTH " };
+	const char* const TRANSPOSED_NAMES[4] = { "SOUTH ", "EAST ", "NORTH ", "WEST " };
+	const char* const* names = transposed ? TRANSPOSED_NAMES : SWEEP_NAMES;	// Names to use
+	int row = 0;			// Row # of the current location, in sweep order
+	int col = 0;			// Column # of the current location, in sweep order
+	int cameFrom = -1;		// Index in names of the move back the way the path came, or -1
+	int k;					// Index of the current location
+
+	// Enter the maze
+	directions = "SOUTH ";
+
+	// Until at the exit, take the one edge out of the location that does not lead back
+	while( row != numRows - 1 || col != numCols - 1 )
+	{
+		k = row * numCols + col;
+
+		if(cameFrom != 0 && (used[k] & USES_RIGHT) != 0)
+		{
+			directions += names[0];
+			col++;
+			cameFrom = 2;
+
+		} // End if
+		else if(cameFrom != 1 && (used[k] & USES_DOWN) != 0)
+		{
+			directions += names[1];
+			row++;
+			cameFrom = 3;
+
+		} // End else if
+		else if(cameFrom != 2 && col > 0 && (used[k - 1] & USES_RIGHT) != 0)
+		{
+			directions += names[2];
+			col--;
+			cameFrom = 0;
+
+		} // End else if
+		else
+		{
+			directions += names[3];
+			row--;
+			cameFrom = 1;
+
+		} // End else
+
+	} // End while
+
+	// Leave the maze
+	directions += "SOUTH ";
+
+} // End TracePath(const vector<unsigned char>& used, string& directions)
\ No newline at end of file
@@ -0,0 +1,214 @@
+/*
+AUTHOR:
+	Chris Pray
+
+DATE:
+	10/19/26
+
+FILENAME:
+	pathcount.h
+
+PURPOSE:
+	This file contains the specification for PathCounterClass, which counts the valid paths through a
+	MazeClass object, from the entrance at (0, 0) to the exit at (numRows - 1, numCols - 1) without
+	crossing any location twice, without enumerating them. It uses the frontier method behind Knuth's
+	SIMPATH: the locations are swept one at a time, row by row, and for every way the part of a path
+	already swept can meet the frontier between swept and unswept locations, only the number of ways
+	to get there is kept.
+
+	The frontier crosses numCols + 1 edges: the edge down out of each of the last numCols locations
+	swept, plus the edge right out of the last location swept. Each edge gets a 2-bit plug:
+		PLUG_NONE	the path does not use the edge
+		PLUG_OPEN	the edge is the left end of a piece of path whose other end is also on the frontier
+		PLUG_CLOSE	the edge is the right end of such a piece
+		PLUG_END	the edge is on a piece whose other end is the entrance or the exit
+	Pieces of path cannot cross, so the open and close plugs pair up like parentheses, and the plugs
+	of a frontier pack into one 64-bit key. A hash map from keys to BigCountClass counts holds one
+	frontier. Sweeping a location replaces each key with the keys of the ways the path can use that
+	location: not at all, passing through it, or ending there if it is the entrance or the exit. Keys
+	that would close a loop or leave a piece of path stranded are dropped. The maze is transposed
+	first if that makes the frontier narrower.
+
+	BuildDiagram keeps every frontier instead of only the last, as a decision diagram with one level
+	per location, in which each node is a frontier key and each arc a way of using a location. Nodes
+	that cannot reach the end are removed and nodes at the same level with the same arcs are merged,
+	which is how a zero-suppressed decision diagram (ZDD) is reduced. NextPath then iterates over the
+	paths lazily by walking the diagram, one path per call.
+
+ASSUMPTIONS:
+	(1) Only WALL locations block a path. VISITED locations count as open.
+
+EXCEPTION HANDLING:
+	MazeTooWideException is thrown by the constructor if both dimensions of the maze exceed
+	MAX_FRONTIER_WIDTH. bad_alloc is caught if an attempt to allocate dynamic memory fails, and
+	OutOfMemoryException is thrown in its place.
+
+SUMMARY OF METHODS:
+
+	PathCounterClass(const MazeClass& maze)
+		Instantiates a PathCounterClass object for the walls of maze.
+
+	BigCountClass CountPaths() const
+		Returns the number of valid paths through the maze.
+
+	BigCountClass BuildDiagram()
+		Builds the reduced decision diagram of the valid paths and returns their number.
+
+	bool NextPath(string& directions)
+		Gets the next path from the diagram as a line of directions.
+
+	int GetDiagramSize() const
+		Returns the number of nodes in the diagram.
+*/
+
+#ifndef PathCount_h
+#define PathCount_h
+
+#include "maze.h"		// For MazeClass
+#include "bigcount.h"	// For BigCountClass
+#include<cstdint>		// For uint64_t
+#include<string>		// For string
+#include<vector>		// For vector
+using namespace std;
+
+const int MAX_FRONTIER_WIDTH = 31;	// Widest maze whose numCols + 1 plugs fit in a 64-bit key
+
+enum PlugEnum { PLUG_NONE, PLUG_OPEN, PLUG_CLOSE, PLUG_END };
+
+enum ChoiceEnum { USES_NONE = 0, USES_DOWN = 1, USES_RIGHT = 2, USES_BOTH = 3 };
+	// Which of the edges down and right out of a location a path uses
+
+struct DiagramNodeType
+{
+	int children[2];				// Index of the node each arc leads to, in the next level
+	unsigned char choices[2];		// The ChoiceEnum of each arc
+	unsigned char numChildren;		// # of arcs out of the node
+
+}; // End DiagramNodeType
+
+class PathCounterClass
+{
+	public:
+
+		// Constructor
+
+		PathCounterClass(/* In */ const MazeClass& maze);	// The maze whose paths are counted
+		/*
+		Purpose:			Instantiates a PathCounterClass object for the walls of maze, transposing
+							them if the maze has more columns than rows.
+		Pre:				maze has been built.
+		Post:				A PathCounterClass object has been instantiated with no diagram.
+		Classification:		Non-default Constructor
+		Order of Magnitude:	O(N * M), where N = # of rows and M = # of columns
+		Exceptions Thrown:	MazeTooWideException, OutOfMemoryException
+		*/
+
+
+		// ADT PathCounterClass Operations
+
+		BigCountClass CountPaths() const;
+		/*
+		Purpose:			Returns the number of valid paths through the maze, keeping only one
+							frontier at a time.
+		Pre:				A PathCounterClass object has been instantiated.
+		Post:				The number of paths from the entrance to the exit that cross no wall and
+							no location twice has been returned; it is 0 if the entrance or the exit
+							is a wall.
+		Classification:		Observer / Summarizer
+		Order of Magnitude:	O(N * M * F * W), where F = # of keys on the widest frontier and
+							W = # of columns after transposing
+		Exceptions Thrown:	OutOfMemoryException
+		*/
+
+		BigCountClass BuildDiagram();
+		/*
+		Purpose:			Builds the reduced decision diagram of the valid paths through the maze,
+							replacing any diagram built before, and restarts NextPath.
+		Pre:				A PathCounterClass object has been instantiated.
+		Post:				The diagram holds every valid path, and is empty if there are none. The
+							number of paths has been returned.
+		Classification:		Mutator
+		Order of Magnitude:	O(N * M * F * W)
+		Exceptions Thrown:	OutOfMemoryException
+		*/
+
+		bool NextPath(/* Out */ string& directions);	// Gets the directions of the next path
+		/*
+		Purpose:			Gets the next valid path from the diagram, in the word format of
+							solution.out: SOUTH into the maze, each move, and SOUTH out of it, each
+							followed by a space.
+		Pre:				BuildDiagram has been called.
+		Post:				If a path remains, directions holds it and true has been returned.
+							Otherwise false has been returned. Every path is got exactly once.
+		Classification:		Mutator
+		Order of Magnitude:	O(N * M)
+		Exceptions Thrown:	OutOfMemoryException
+		*/
+
+		int GetDiagramSize() const;
+		/*
+		Purpose:			Returns the number of nodes in the diagram, not counting the final node.
+		Pre:				A PathCounterClass object has been instantiated.
+		Post:				The number of nodes has been returned, or 0 if there is no diagram or no
+							path.
+		Classification:		Observer / Accessor
+		Order of Magnitude:	O(N * M)
+		*/
+
+
+	private:
+
+		int Advance(/* In */  const uint64_t key,			// The frontier before the location
+					/* In */  const int		 row,			// Row # of the location
+					/* In */  const int		 col,			// Column # of the location
+					/* Out */ uint64_t		 successors[2],	// Gets the frontiers after it
+					/* Out */ unsigned char	 choices[2]) const;	// Gets how each uses it
+		/*
+		Purpose:			Sweeps location (row, col) from frontier key, finding each way a path can
+							use it.
+		Pre:				key is a frontier reached by sweeping every location before (row, col).
+		Post:				successors holds the frontier after each way, and choices the edges out of
+							(row, col) it uses. The number of ways, 0, 1 or 2, has been returned. If
+							(row, col) is the last location of its row, each successor has been
+							shifted to start the next row.
+		Classification:		Observer / Accessor
+		Order of Magnitude:	O(W)
+		*/
+
+		int MatchPlug(/* In */ const uint64_t key,			// The frontier
+					  /* In */ const int	  plug) const;	// Index of an open or close plug
+		/*
+		Purpose:			Finds the plug at the other end of the piece of path an open or close plug
+							is on.
+		Pre:				Plug plug of key is PLUG_OPEN or PLUG_CLOSE.
+		Post:				The index of the matching close or open plug has been returned.
+		Classification:		Observer / Accessor
+		Order of Magnitude:	O(W)
+		*/
+
+		void TracePath(/* In */  const vector<unsigned char>& used,		// Choice at each location
+						/* Out */ string&					   directions) const;	// Gets the path
+		/*
+		Purpose:			Turns the edges a path uses out of each location into its directions.
+		Pre:				used holds a ChoiceEnum for each location, forming one path from the
+							entrance to the exit.
+		Post:				directions holds the path in the word format of solution.out, in the
+							maze's own orientation.
+		Classification:		Observer / Accessor
+		Order of Magnitude:	O(N * M)
+		*/
+
+		int numRows;				// # of rows swept, after transposing
+		int numCols;				// # of columns swept, after transposing; at most MAX_FRONTIER_WIDTH
+		bool transposed;			// True if the maze's rows are swept as columns
+		vector<unsigned char> open;	// 1 for each location that is not a wall, row by row
+		vector< vector<DiagramNodeType> > levels;	// The diagram; level k holds the nodes before
+													//  location k is swept, and the last level the
+													//  final node
+		vector<int> pathNodes;		// Node at each level on the path NextPath got last
+		vector<int> pathArcs;		// Arc taken from each of those nodes
+		bool exhausted;				// True once NextPath has got every path
+
+}; // End PathCounterClass
+
+#endif
\ No newline at end of file
@@ -0,0 +1,373 @@
+/*
+AUTHOR:
+	Chris Pray
+
+DATE:
+	10/19/26
+
+FILENAME:
+	pruner.cpp
+
+PURPOSE:
+	This file contains the implementation for all of the methods declared in pruner.h
+*/
+
+#include "pruner.h"
+#include<algorithm>	// For min
+#include<new>		// For bad_alloc
+
+const int NUM_NEIGHBOURS = 4;	// # of neighbours a location has: east, south, west and north
+
+
+//***************************************************************************************
+//*																						*
+//*								Non-default Constructor									*
+//*																						*
+//***************************************************************************************
+
+// Non-default Constructor
+MazePrunerClass::MazePrunerClass(/* In */ const MazeClass& maze)	// The maze to prune
+{
+	numRows = maze.GetNumRows();
+	numCols = maze.GetNumCols();
+	numBlocks = 0;
+	numSealed = 0;
+
+	try
+	{
+		open.resize(size_t(numRows) * numCols);
+
+		// Copy each location's wall
+		for(int r = 0; r < numRows; r++)
+		{
+			for(int c = 0; c < numCols; c++)
+			{
+				open[size_t(r) * numCols + c] = maze.GetStatus(r, c) != WALL;
+
+			} // End for
+
+		} // End for
+
+	} // End try
+	catch(bad_alloc e)
+	{
+		throw OutOfMemoryException("OutOfMemoryException: The heap has run out of memory.");
+
+	} // End catch
+
+} // End MazePrunerClass(const MazeClass& maze)
+
+
+//***************************************************************************************
+//*																						*
+//*									Mutator												*
+//*																						*
+//***************************************************************************************
+
+int MazePrunerClass::SealDeadEnds()
+{
+	const int numLocations = numRows * numCols;	// # of locations in the maze
+	const int exitLocation = numLocations - 1;	// Index of the exit; the entrance is 0
+	vector<unsigned char> degree;	// # of open neighbours of each open location
+	vector<int> deadEnds;			// Dead ends waiting to be sealed
+	int location;					// The dead end being sealed
+	int next;						// A neighbour of location
+	int sealed = 0;					// # of locations sealed by this call
+
+	try
+	{
+		degree.assign(numLocations, 0);
+
+		// Count the open neighbours of each open location, and queue those with fewer than two
+		for(int i = 0; i < numLocations; i++)
+		{
+			if(open[i])
+			{
+				for(int d = 0; d < NUM_NEIGHBOURS; d++)
+				{
+					degree[i] += GetNeighbour(i, d) >= 0;
+
+				} // End for
+
+				if(degree[i] < 2 && i != 0 && i != exitLocation)
+				{
+					deadEnds.push_back(i);
+
+				} // End if
+
+			} // End if
+
+		} // End for
+
+		// Seal each dead end, and queue each neighbour it leaves a dead end in turn
+		while( !deadEnds.empty() )
+		{
+			location = deadEnds.back();
+			deadEnds.pop_back();
+
+			for(int d = 0; d < NUM_NEIGHBOURS; d++)
+			{
+				next = GetNeighbour(location, d);
+
+				if(next >= 0)
+				{
+					degree[next]--;
+
+					// A neighbour just dropped to one open neighbour; it is queued once, since a
+					//  location with none left was queued when it had one
+					if(degree[next] == 1 && next != 0 && next != exitLocation)
+					{
+						deadEnds.push_back(next);
+
+					} // End if
+
+				} // End if
+
+			} // End for
+
+			open[location] = 0;
+			sealed++;
+
+		} // End while
+
+	} // End try
+	catch(bad_alloc e)
+	{
+		throw OutOfMemoryException("OutOfMemoryException: The heap has run out of memory.");
+
+	} // End catch
+
+	numSealed += sealed;
+
+	return sealed;
+
+} // End SealDeadEnds()
+
+//***************************************************************************************
+
+int MazePrunerClass::SealOffPath()
+{
+	const int numLocations = numRows * numCols;	// # of locations in the maze
+	const int exitLocation = numLocations - 1;	// Index of the exit; the entrance is 0
+	vector<int> discovered;			// Order in which the search reached each location, or -1
+	vector<int> low;				// Earliest location reachable from each one's subtree by one
+									//  back edge
+	vector<int> parent;				// Location each was reached from, or -1 for the entrance
+	vector<int> block;				// Block of each location other than the entrance, or -1
+	vector<unsigned char> nextDirection;	// Next direction to look in from each location
+	vector<int> path;				// The search path from the entrance to the current location
+	vector<int> unassigned;			// Locations reached but not yet given a block
+	vector<bool> onPath;			// True for each block on the block-cut tree path
+	int time = 0;					// # of locations reached so far
+	int location;					// The location at the end of the search path
+	int next;						// A neighbour of location
+	int member;						// A location being given a block
+	int sealed = 0;					// # of locations sealed by this call
+
+	numBlocks = 0;
+
+	try
+	{
+		discovered.assign(numLocations, -1);
+		low.assign(numLocations, 0);
+		parent.assign(numLocations, -1);
+		block.assign(numLocations, -1);
+		nextDirection.assign(numLocations, 0);
+
+		// Search depth first from the entrance, if it is open
+		if(open[0])
+		{
+			discovered[0] = low[0] = time++;
+			path.push_back(0);
+
+		} // End if
+
+		while( !path.empty() )
+		{
+			location = path.back();
+
+			// If a direction is left to look in, look in it
+			if(nextDirection[location] < NUM_NEIGHBOURS)
+			{
+				next = GetNeighbour(location, nextDirection[location]++);
+
+				// If the neighbour has not been reached, go on to it
+				if(next >= 0 && discovered[next] < 0)
+				{
+					discovered[next] = low[next] = time++;
+					parent[next] = location;
+					path.push_back(next);
+					unassigned.push_back(next);
+
+				} // End if
+				// Else if it has been reached and is not where location was reached from, it is a
+				//  back edge
+				else if(next >= 0 && next != parent[location])
+				{
+					low[location] = min(low[location], discovered[next]);
+
+				} // End else if
+
+			} // End if
+			// Else location is finished; back up to its parent
+			else
+			{
+				path.pop_back();
+
+				if( !path.empty() )
+				{
+					low[path.back()] = min(low[path.back()], low[location]);
+
+					// If nothing below location reaches above its parent, its parent cuts location's
+					//  subtree off, and what is left of the subtree forms a block with the parent
+					if(low[location] >= discovered[path.back()])
+					{
+						do
+						{
+							member = unassigned.back();
+							unassigned.pop_back();
+							block[member] = numBlocks;
+
+						} while( member != location );
+
+						numBlocks++;
+
+					} // End if
+
+				} // End if
+
+			} // End else
+
+		} // End while
+
+		// Every block on the block-cut tree path holds a location on the search tree path from the
+		//  exit back to the entrance, since a block is entered from the location that heads it
+		onPath.assign(numBlocks, false);
+
+		if(discovered[exitLocation] >= 0)
+		{
+			for(location = exitLocation; location != 0; location = parent[location])
+			{
+				onPath[block[location]] = true;
+
+			} // End for
+
+		} // End if
+
+		// Seal every open location outside those blocks, other than the entrance and the exit; the
+		//  entrance heads the first of them
+		for(int i = 1; i < exitLocation; i++)
+		{
+			if( open[i] && (discovered[exitLocation] < 0 || block[i] < 0 || !onPath[block[i]]) )
+			{
+				open[i] = 0;
+				sealed++;
+
+			} // End if
+
+		} // End for
+
+	} // End try
+	catch(bad_alloc e)
+	{
+		throw OutOfMemoryException("OutOfMemoryException: The heap has run out of memory.");
+
+	} // End catch
+
+	numSealed += sealed;
+
+	return sealed;
+
+} // End SealOffPath()
+
+
+//***************************************************************************************
+//*																						*
+//*								Observer / Accessor										*
+//*																						*
+//***************************************************************************************
+
+void MazePrunerClass::Apply(/* In/Out */ MazeClass& maze) const	// The maze to wall off
+{
+	vector<uint64_t> walls;		// The packed walls of one row
+
+	try
+	{
+		walls.resize((numCols + BITS_PER_WORD - 1) / BITS_PER_WORD);
+
+		// Add the sealed locations of each row to its walls
+		for(int r = 0; r < numRows; r++)
+		{
+			maze.GetRowWalls(r, walls.data());
+
+			for(int c = 0; c < numCols; c++)
+			{
+				if( !open[size_t(r) * numCols + c] )
+				{
+					walls[c / BITS_PER_WORD] |= uint64_t(1) << (c % BITS_PER_WORD);
+
+				} // End if
+
+			} // End for
+
+			maze.SetRowWalls(r, walls.data());
+
+		} // End for
+
+	} // End try
+	catch(bad_alloc e)
+	{
+		throw OutOfMemoryException("OutOfMemoryException: The heap has run out of memory.");
+
+	} // End catch
+
+} // End Apply(MazeClass& maze)
+
+//***************************************************************************************
+
+int MazePrunerClass::GetNumBlocks() const
+{
+	return numBlocks;
+
+} // End GetNumBlocks()
+
+//***************************************************************************************
+
+int MazePrunerClass::GetNumSealed() const
+{
+	return numSealed;
+
+} // End GetNumSealed()
+
+//***************************************************************************************
+
+int MazePrunerClass::GetNeighbour(/* In */ const int location,			// Index of the location
+								  /* In */ const int direction) const	// 0 to 3: E, S, W, N
+{
+	const int row = location / numCols;	// Row # of the location
+	const int col = location % numCols;	// Column # of the location
+	int next = -1;						// Index of the neighbour
+
+	// Branch depending on the direction
+	switch( direction )
+	{
+		case 0: next = col < numCols - 1 ? location + 1 : -1; break;
+
+		case 1: next = row < numRows - 1 ? location + numCols : -1; break;
+
+		case 2: next = col > 0 ? location - 1 : -1; break;
+
+		case 3: next = row > 0 ? location - numCols : -1; break;
+
+	} // End switch
+
+	// If the neighbour is in the maze but not open
+	if(next >= 0 && !open[next])
+	{
+		next = -1;
+
+	} // End if
+
+	return next;
+
+} // End GetNeighbour(int location, int direction)
\ No newline at end of file
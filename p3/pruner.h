@@ -0,0 +1,172 @@
+/*
+AUTHOR:
+	Chris Pray
+
+DATE:
+	10/19/26
+
+FILENAME:
+	pruner.h
+
+PURPOSE:
+	This file contains the specification for MazePrunerClass, which finds the open locations of a
+	MazeClass object that no valid path, from the entrance at (0, 0) to the exit at
+	(numRows - 1, numCols - 1), can pass through, so that they can be walled off before a search
+	wastes time walking into them and backing out again.
+
+	Two passes are made over the open locations, each treated as a vertex of a graph whose edges join
+	neighbouring open locations:
+		SealDeadEnds	A location other than the entrance and the exit with at most one open
+						neighbour cannot be on a path, since a path enters and leaves every location
+						it passes through. Sealing one can leave its neighbour a dead end in turn, so
+						dead ends are sealed from a queue until none are left, which seals whole
+						dead-end corridors.
+		SealOffPath		The graph is split into its biconnected components, or blocks, by Tarjan's
+						algorithm, run as an iterative depth-first search from the entrance. Blocks
+						meet at articulation locations, and the blocks and articulation locations form
+						the block-cut tree. A path that left the blocks on the tree path from the
+						entrance's block to the exit's block would have to come back through the same
+						articulation location, so every location outside those blocks, including every
+						location that cannot be reached from the entrance, is sealed. This seals side
+						chambers hanging off a single location, however many loops they hold.
+
+	Sealed locations are marked as walls by Apply. Neither pass seals the entrance or the exit, or
+	any location on a valid path, so the paths of the maze are the same afterwards.
+
+ASSUMPTIONS:
+	(1) Only WALL locations block a path. VISITED locations count as open.
+
+EXCEPTION HANDLING:
+	bad_alloc is caught if an attempt to allocate dynamic memory fails, and OutOfMemoryException is
+	thrown in its place.
+
+SUMMARY OF METHODS:
+
+	MazePrunerClass(const MazeClass& maze)
+		Instantiates a MazePrunerClass object for the walls of maze.
+
+	int SealDeadEnds()
+		Seals every dead end, until none are left, and returns the number sealed.
+
+	int SealOffPath()
+		Seals every location outside the blocks on the block-cut tree path from the entrance to the
+		exit, and returns the number sealed.
+
+	void Apply(MazeClass& maze) const
+		Marks every sealed location of maze as a wall.
+
+	int GetNumBlocks() const
+		Returns the number of blocks SealOffPath found.
+
+	int GetNumSealed() const
+		Returns the number of locations sealed so far.
+*/
+
+#ifndef MazePruner_h
+#define MazePruner_h
+
+#include "maze.h"	// For MazeClass
+#include<vector>	// For vector
+using namespace std;
+
+class MazePrunerClass
+{
+	public:
+
+		// Constructor
+
+		MazePrunerClass(/* In */ const MazeClass& maze);	// The maze to prune
+		/*
+		Purpose:			Instantiates a MazePrunerClass object for the walls of maze, with nothing
+							sealed.
+		Pre:				maze has been built.
+		Post:				A MazePrunerClass object has been instantiated.
+		Classification:		Non-default Constructor
+		Order of Magnitude:	O(N * M), where N = # of rows and M = # of columns
+		Exceptions Thrown:	OutOfMemoryException
+		*/
+
+
+		// ADT MazePrunerClass Operations
+
+		int SealDeadEnds();
+		/*
+		Purpose:			Seals every open location, other than the entrance and the exit, with at
+							most one open neighbour, and every location that becomes one as others
+							are sealed.
+		Pre:				A MazePrunerClass object has been instantiated.
+		Post:				No location other than the entrance and the exit has fewer than two open
+							neighbours. The number of locations sealed has been returned.
+		Classification:		Mutator
+		Order of Magnitude:	O(N * M)
+		Exceptions Thrown:	OutOfMemoryException
+		*/
+
+		int SealOffPath();
+		/*
+		Purpose:			Splits the open locations into blocks and seals every location that is not
+							in a block on the block-cut tree path from the entrance to the exit.
+		Pre:				A MazePrunerClass object has been instantiated.
+		Post:				Only the entrance, the exit and the locations of the blocks on the path
+							are open; if the entrance and the exit are not joined, only they are. The
+							number of locations sealed has been returned.
+		Classification:		Mutator
+		Order of Magnitude:	O(N * M)
+		Exceptions Thrown:	OutOfMemoryException
+		*/
+
+		void Apply(/* In/Out */ MazeClass& maze) const;	// The maze to wall off
+		/*
+		Purpose:			Marks every sealed location of maze as a wall.
+		Pre:				maze is the maze the object was instantiated for. No location of maze is
+							VISITED.
+		Post:				Every sealed location of maze is a WALL. The other locations are
+							unchanged.
+		Classification:		Observer / Accessor
+		Order of Magnitude:	O(N * M)
+		Exceptions Thrown:	OutOfMemoryException
+		*/
+
+		int GetNumBlocks() const;
+		/*
+		Purpose:			Returns the number of blocks SealOffPath found.
+		Pre:				A MazePrunerClass object has been instantiated.
+		Post:				The number of blocks has been returned, or 0 if SealOffPath has not been
+							called.
+		Classification:		Observer / Accessor
+		Order of Magnitude:	O(1)
+		*/
+
+		int GetNumSealed() const;
+		/*
+		Purpose:			Returns the number of locations sealed so far.
+		Pre:				A MazePrunerClass object has been instantiated.
+		Post:				The number of locations sealed by both passes has been returned.
+		Classification:		Observer / Accessor
+		Order of Magnitude:	O(1)
+		*/
+
+
+	private:
+
+		int GetNeighbour(/* In */ const int location,			// Index of the location
+						 /* In */ const int direction) const;	// 0 to 3: east, south, west, north
+		/*
+		Purpose:			Returns the open neighbour of location in direction.
+		Pre:				0 <= location < numRows * numCols.
+		Post:				The index of the neighbour has been returned, or -1 if it is outside the
+							maze or not open.
+		Classification:		Observer / Accessor
+		Order of Magnitude:	O(1)
+		*/
+
+		int numRows;				// # of rows in the maze
+		int numCols;				// # of columns in the maze
+		vector<unsigned char> open;	// 1 for each location that is neither a wall nor sealed, row by
+									//  row
+		int numBlocks;				// # of blocks SealOffPath found
+		int numSealed;				// # of locations sealed so far
+
+}; // End MazePrunerClass
+
+#endif
\ No newline at end of file
@@ -0,0 +1,284 @@
+/*
+AUTHOR:
+	Chris Pray
+
+DATE:
+	10/19/26
+
+FILENAME:
+	searchstats.cpp
+
+PURPOSE:
+	This file contains the implementation for all of the methods declared in searchstats.h
+*/
+
+#include "searchstats.h"
+#include "MazeExceptions.h"	// For OutOfMemoryException
+#include<iostream>				// For cerr
+#include<new>					// For bad_alloc
+
+
+//***************************************************************************************
+//*																						*
+//*						Non-default Constructor, Destructor								*
+//*																						*
+//***************************************************************************************
+
+// Non-default Constructor
+SearchStatsClass::SearchStatsClass(/* In */ const int setNumSlots)	// # of threads that record
+{
+	numSlots = setNumSlots < 1 ? 1 : setNumSlots;
+	slots = NULL;
+	seconds = 0;
+	reportSeconds = 0;
+	stopReporting = false;
+
+	try
+	{
+		// Dynamically allocate a slot for each recording thread
+		slots = new SearchStatsSlotType[numSlots];
+
+	} // End try
+	catch(bad_alloc e)
+	{
+		throw nmspcMazeExceptions::OutOfMemoryException("OutOfMemoryException: The heap has run out "
+			"of memory.");
+
+	} // End catch
+
+	Reset();
+
+} // End SearchStatsClass(int setNumSlots)
+
+//***************************************************************************************
+
+// Destructor
+SearchStatsClass::~SearchStatsClass()
+{
+	StopReporting();
+	delete [] slots;
+
+} // End ~SearchStatsClass()
+
+
+//***************************************************************************************
+//*																						*
+//*									Mutator												*
+//*																						*
+//***************************************************************************************
+
+void SearchStatsClass::Reset()
+{
+	for(int s = 0; s < numSlots; s++)
+	{
+		slots[s].expanded = 0;
+		slots[s].backtracks = 0;
+		slots[s].solutions = 0;
+		slots[s].pruned = 0;
+		slots[s].maxDepth = 0;
+		slots[s].depths.clear();
+
+	} // End for
+
+	startTime = chrono::steady_clock::now();
+	seconds = 0;
+
+} // End Reset()
+
+//***************************************************************************************
+
+void SearchStatsClass::AddExpanded(/* In */ const int slot,		// Slot of the recording thread
+								   /* In */ const int depth)	// Depth of the location moved into
+{
+	SearchStatsSlotType& counts = slots[slot];	// The thread's own slot
+
+	// Only this thread writes the slot, so a relaxed load and store will do, without a locked add
+	counts.expanded.store(counts.expanded.load(memory_order_relaxed) + 1, memory_order_relaxed);
+
+	if(depth > counts.maxDepth.load(memory_order_relaxed))
+	{
+		counts.maxDepth.store(depth, memory_order_relaxed);
+
+	} // End if
+
+	// Grow the histogram to reach depth, if it does not yet
+	if(size_t(depth) >= counts.depths.size())
+	{
+		counts.depths.resize(depth + 1, 0);
+
+	} // End if
+
+	counts.depths[depth]++;
+
+} // End AddExpanded(int slot, int depth)
+
+//***************************************************************************************
+
+void SearchStatsClass::AddBacktrack(/* In */ const int slot)	// Slot of the recording thread
+{
+	slots[slot].backtracks.store(slots[slot].backtracks.load(memory_order_relaxed) + 1,
+								 memory_order_relaxed);
+
+} // End AddBacktrack(int slot)
+
+//***************************************************************************************
+
+void SearchStatsClass::AddSolution(/* In */ const int slot)	// Slot of the recording thread
+{
+	slots[slot].solutions.store(slots[slot].solutions.load(memory_order_relaxed) + 1,
+								memory_order_relaxed);
+
+} // End AddSolution(int slot)
+
+//***************************************************************************************
+
+void SearchStatsClass::AddPruned(/* In */ const int slot)	// Slot of the recording thread
+{
+	slots[slot].pruned.store(slots[slot].pruned.load(memory_order_relaxed) + 1,
+							 memory_order_relaxed);
+
+} // End AddPruned(int slot)
+
+//***************************************************************************************
+
+void SearchStatsClass::StartReporting(/* In */ const double setSeconds)	// # of seconds between
+																		//  reports
+{
+	// If no reports are wanted
+	if(setSeconds <= 0)
+	{
+		return;
+
+	} // End if
+
+	reportSeconds = setSeconds;
+	stopReporting = false;
+
+	reporter = thread(&SearchStatsClass::Report, this);
+
+} // End StartReporting(double setSeconds)
+
+//***************************************************************************************
+
+void SearchStatsClass::StopReporting()
+{
+	// If the reporting thread runs, tell it to stop and wait for it
+	if( reporter.joinable() )
+	{
+		{
+			lock_guard<mutex> guard(reportLock);
+
+			stopReporting = true;
+			reportWake.notify_one();
+
+		} // End lock
+
+		reporter.join();
+
+	} // End if
+
+	seconds = chrono::duration<double>(chrono::steady_clock::now() - startTime).count();
+
+} // End StopReporting()
+
+//***************************************************************************************
+
+void SearchStatsClass::Report()
+{
+	const chrono::steady_clock::duration period =
+		chrono::duration_cast<chrono::steady_clock::duration>(chrono::duration<double>(reportSeconds));
+		// Time between reports
+	chrono::steady_clock::time_point nextReport = chrono::steady_clock::now();	// When to report next
+	unique_lock<mutex> guard(reportLock);
+	SearchCountsType counts;	// The counts summed over the slots
+
+	// Until told to stop, wait out each period and then print the counts
+	while( !stopReporting )
+	{
+		nextReport += period;
+
+		while( !stopReporting && chrono::steady_clock::now() < nextReport )
+		{
+			reportWake.wait_until(guard, nextReport);
+
+		} // End while
+
+		if( !stopReporting )
+		{
+			counts = GetCounts();
+
+			cerr << "[stats] " << chrono::duration<double>(chrono::steady_clock::now() -
+				startTime).count() << " s: " << counts.expanded << " expanded, " << counts.backtracks
+				 << " backtracks, " << counts.solutions << " solutions, " << counts.pruned
+				 << " pruned, max depth " << counts.maxDepth << endl;
+
+		} // End if
+
+	} // End while
+
+} // End Report()
+
+
+//***************************************************************************************
+//*																						*
+//*								Observer / Accessor										*
+//*																						*
+//***************************************************************************************
+
+SearchCountsType SearchStatsClass::GetCounts() const
+{
+	SearchCountsType counts = { 0, 0, 0, 0, 0 };	// The counts summed so far
+
+	for(int s = 0; s < numSlots; s++)
+	{
+		counts.expanded += slots[s].expanded.load(memory_order_relaxed);
+		counts.backtracks += slots[s].backtracks.load(memory_order_relaxed);
+		counts.solutions += slots[s].solutions.load(memory_order_relaxed);
+		counts.pruned += slots[s].pruned.load(memory_order_relaxed);
+
+		if(slots[s].maxDepth.load(memory_order_relaxed) > counts.maxDepth)
+		{
+			counts.maxDepth = slots[s].maxDepth.load(memory_order_relaxed);
+
+		} // End if
+
+	} // End for
+
+	return counts;
+
+} // End GetCounts()
+
+//***************************************************************************************
+
+void SearchStatsClass::WriteJson(/* In/Out */ ostream& dout) const	// The stream to write to
+{
+	const SearchCountsType counts = GetCounts();	// The counts summed over the slots
+	long long depthCount;							// # of locations moved into at one depth
+
+	dout << "{\"threads\": " << numSlots << ", \"seconds\": " << seconds << ", \"expanded\": "
+		 << counts.expanded << ", \"backtracks\": " << counts.backtracks << ", \"solutions\": "
+		 << counts.solutions << ", \"pruned\": " << counts.pruned << ", \"max_depth\": "
+		 << counts.maxDepth << ", \"depth_histogram\": [";
+
+	// Sum each depth over the slots, out to the greatest depth of any
+	for(int d = 0; d <= counts.maxDepth; d++)
+	{
+		depthCount = 0;
+
+		for(int s = 0; s < numSlots; s++)
+		{
+			if(size_t(d) < slots[s].depths.size())
+			{
+				depthCount += slots[s].depths[d];
+
+			} // End if
+
+		} // End for
+
+		dout << (d > 0 ? ", " : "") << depthCount;
+
+	} // End for
+
+	dout << "]}" << endl;
+
+} // End WriteJson(ostream& dout) const
\ No newline at end of file
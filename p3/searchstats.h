@@ -0,0 +1,276 @@
+/*
+AUTHOR:
+	Chris Pray
+
+DATE:
+	10/19/26
+
+FILENAME:
+	searchstats.h
+
+PURPOSE:
+	This file contains the specification for SearchStatsClass, which counts what a search for the
+	valid paths through a maze does while it runs: the locations it moves into, the times it backs
+	out of a location, the solutions it finds, the locations it drops because the exit can no longer
+	be reached from them, and the greatest depth it reaches, along with a histogram of the depths of
+	the locations it moves into. The depth of a location is the # of locations on the path to it,
+	counting the entrance and the location itself.
+
+	Each thread of the search records into a slot of its own, laid out on a cache line of its own, so
+	that the threads never write to the same line. Only the thread that owns a slot writes to it, so
+	a count is bumped with a relaxed load and store rather than a locked add, which costs no more than
+	a plain increment. The counts can be read at any time by another thread, and are summed over the
+	slots when they are. The histogram is only read once the search has stopped.
+
+	While the search runs, a reporting thread can print the sums to cerr every so often, and once it
+	has stopped, the counts and the histogram can be written out as a JSON object.
+
+	The counting is compiled in only when SEARCH_STATS is defined. Every call into a SearchStatsClass
+	object from the search is wrapped in SEARCH_STAT, which drops the call when SEARCH_STATS is not
+	defined, so that a build without it runs the search exactly as it did before.
+
+ASSUMPTIONS:
+	(1) Each slot is recorded into by one thread at a time.
+	(2) Reset and WriteJson are not called while the search runs.
+
+EXCEPTION HANDLING:
+	bad_alloc is caught if an attempt to allocate dynamic memory fails, and OutOfMemoryException is
+	thrown in its place, but for AddExpanded, which lets bad_alloc through to the worker thread that
+	called it.
+
+SUMMARY OF METHODS:
+
+	SearchStatsClass(int setNumSlots)
+		Instantiates a SearchStatsClass object with setNumSlots slots, all counts 0.
+
+	~SearchStatsClass()
+		Stops the reporting thread, and returns all dynamically allocated memory of a
+		SearchStatsClass object back to the heap.
+
+	void Reset()
+		Sets every count to 0 and empties the histogram.
+
+	void AddExpanded(int slot, int depth)
+		Records a move into a location at depth.
+
+	void AddBacktrack(int slot)
+		Records a move back out of a location.
+
+	void AddSolution(int slot)
+		Records a solution found.
+
+	void AddPruned(int slot)
+		Records a location dropped because the exit can no longer be reached from it.
+
+	void StartReporting(double setSeconds)
+		Starts a thread that prints the counts to cerr every setSeconds seconds, if setSeconds > 0.
+
+	void StopReporting()
+		Stops the reporting thread.
+
+	SearchCountsType GetCounts() const
+		Returns the counts summed over the slots.
+
+	void WriteJson(ostream& dout) const
+		Writes the counts and the histogram as a JSON object.
+*/
+
+#ifndef SearchStats_h
+#define SearchStats_h
+
+#include<atomic>				// For atomic
+#include<chrono>				// For steady_clock
+#include<condition_variable>	// For condition_variable
+#include<mutex>					// For mutex
+#include<ostream>				// For ostream
+#include<thread>				// For thread
+#include<vector>				// For vector
+using namespace std;
+
+// Wraps a statement that records into a SearchStatsClass object, so that it is only compiled in
+//  when SEARCH_STATS is defined
+#ifdef SEARCH_STATS
+#define SEARCH_STAT(...) __VA_ARGS__
+#else
+#define SEARCH_STAT(...)
+#endif
+
+const int STATS_LINE_SIZE = 64;		// # of bytes in a cache line; each slot starts on one of its own
+
+struct SearchCountsType
+{
+	long long expanded;		// # of locations moved into
+	long long backtracks;	// # of times the search moved back out of a location
+	long long solutions;	// # of solutions found
+	long long pruned;		// # of locations dropped because the exit could no longer be reached
+	int maxDepth;			// Greatest depth moved into
+
+}; // End SearchCountsType
+
+struct alignas(STATS_LINE_SIZE) SearchStatsSlotType
+{
+	atomic<long long> expanded;		// # of locations moved into
+	atomic<long long> backtracks;	// # of times the search moved back out of a location
+	atomic<long long> solutions;	// # of solutions found
+	atomic<long long> pruned;		// # of locations dropped
+	atomic<int> maxDepth;			// Greatest depth moved into
+	vector<long long> depths;		// # of locations moved into at each depth
+
+}; // End SearchStatsSlotType
+
+class SearchStatsClass
+{
+	public:
+
+		// Constructor and Destructor
+
+		SearchStatsClass(/* In */ const int setNumSlots);	// # of threads that record
+		/*
+		Purpose:			Instantiates a SearchStatsClass object with a slot for each of
+							setNumSlots threads. If setNumSlots is less than one, one slot is made.
+		Pre:				None
+		Post:				A SearchStatsClass object with every count 0, an empty histogram and no
+							reporting thread has been instantiated.
+		Classification:		Non-default Constructor
+		Order of Magnitude:	O(T), where T = # of slots
+		Exceptions Thrown:	OutOfMemoryException
+		*/
+
+		~SearchStatsClass();
+		/*
+		Purpose:			Stops the reporting thread, if one runs, and returns all dynamically
+							allocated memory of a SearchStatsClass object back to the heap.
+		Pre:				A SearchStatsClass object has been instantiated.
+		Post:				No reporting thread runs. All dynamically allocated memory of the object has
+							been returned to the heap.
+		Classification:		Destructor
+		Order of Magnitude:	O(T), where T = # of slots
+		*/
+
+
+		// ADT SearchStatsClass Operations
+
+		void Reset();
+		/*
+		Purpose:			Starts the counts over for a new search.
+		Pre:				No thread records into the object.
+		Post:				Every count is 0 and the histogram is empty. The time the counts were reset
+							has been noted.
+		Classification:		Mutator
+		Order of Magnitude:	O(T), where T = # of slots
+		*/
+
+		void AddExpanded(/* In */ const int slot,		// Slot of the recording thread
+						 /* In */ const int depth);		// Depth of the location moved into
+		/*
+		Purpose:			Records a move into a location at depth.
+		Pre:				0 <= slot < # of slots. depth >= 0.
+		Post:				The # of locations moved into, the histogram at depth and, if depth is
+							greater, the greatest depth of slot have been updated.
+		Classification:		Mutator
+		Order of Magnitude:	O(1) amortized
+		Exceptions Thrown:	bad_alloc
+		*/
+
+		void AddBacktrack(/* In */ const int slot);	// Slot of the recording thread
+		/*
+		Purpose:			Records a move back out of a location.
+		Pre:				0 <= slot < # of slots.
+		Post:				The # of backtracks of slot has been increased by one.
+		Classification:		Mutator
+		Order of Magnitude:	O(1)
+		*/
+
+		void AddSolution(/* In */ const int slot);	// Slot of the recording thread
+		/*
+		Purpose:			Records a solution found.
+		Pre:				0 <= slot < # of slots.
+		Post:				The # of solutions of slot has been increased by one.
+		Classification:		Mutator
+		Order of Magnitude:	O(1)
+		*/
+
+		void AddPruned(/* In */ const int slot);	// Slot of the recording thread
+		/*
+		Purpose:			Records a location dropped because the exit can no longer be reached from
+							it.
+		Pre:				0 <= slot < # of slots.
+		Post:				The # of locations dropped by slot has been increased by one.
+		Classification:		Mutator
+		Order of Magnitude:	O(1)
+		*/
+
+		void StartReporting(/* In */ const double setSeconds);	// # of seconds between reports
+		/*
+		Purpose:			Starts a thread that prints the counts summed over the slots to cerr, one
+							line every setSeconds seconds, until StopReporting is called. If
+							setSeconds is not positive, no thread is started.
+		Pre:				No reporting thread runs.
+		Post:				The reporting thread has been started if setSeconds > 0.
+		Classification:		Mutator
+		Order of Magnitude:	O(1)
+		*/
+
+		void StopReporting();
+		/*
+		Purpose:			Stops the reporting thread, if one runs, and waits for it.
+		Pre:				None
+		Post:				No reporting thread runs. The time the search ran has been noted.
+		Classification:		Mutator
+		Order of Magnitude:	O(1)
+		*/
+
+		SearchCountsType GetCounts() const;
+		/*
+		Purpose:			Returns the counts summed over the slots, and the greatest depth of any.
+		Pre:				A SearchStatsClass object has been instantiated.
+		Post:				The counts have been returned. They may be out of date by the time they
+							are, if a search runs.
+		Classification:		Observer / Accessor
+		Order of Magnitude:	O(T), where T = # of slots
+		*/
+
+		void WriteJson(/* In/Out */ ostream& dout) const;	// The stream to write to
+		/*
+		Purpose:			Writes the # of slots, the seconds the search ran, the counts and the
+							histogram to dout as one JSON object on one line. The histogram is an
+							array holding, at each index, the # of locations moved into at that depth.
+		Pre:				No thread records into the object. StopReporting has been called since the
+							search began.
+		Post:				The JSON object has been written to dout.
+		Classification:		Observer / Accessor
+		Order of Magnitude:	O(T * D), where T = # of slots and D = the greatest depth
+		*/
+
+
+	private:
+
+		SearchStatsClass(/* In */ const SearchStatsClass& orig);
+		void operator=(/* In */ const SearchStatsClass& orig);
+		/*
+		Purpose:			Not defined; a SearchStatsClass object holds a thread and cannot be copied.
+		*/
+
+		void Report();
+		/*
+		Purpose:			Prints the counts to cerr every reportSeconds seconds until stopReporting is
+							set; run on the reporting thread.
+		Pre:				reportSeconds > 0.
+		Post:				stopReporting is set.
+		Classification:		Observer / Accessor
+		Order of Magnitude:	O(T * R), where T = # of slots and R = # of reports printed
+		*/
+
+		int numSlots;					// # of slots
+		SearchStatsSlotType* slots;		// One slot per recording thread
+		chrono::steady_clock::time_point startTime;	// When the counts were last reset
+		double seconds;					// # of seconds from the reset to StopReporting
+		double reportSeconds;			// # of seconds between reports
+		thread reporter;				// Prints the reports, while it runs
+		mutex reportLock;				// Guards stopReporting
+		condition_variable reportWake;	// Signalled when stopReporting is set
+		bool stopReporting;				// Set to stop the reporting thread; guarded by reportLock
+
+}; // End SearchStatsClass
+
+#endif
\ No newline at end of file
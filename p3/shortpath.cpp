@@ -0,0 +1,543 @@
+/*
+AUTHOR:
+	Chris Pray
+
+DATE:
+	10/19/26
+
+FILENAME:
+	shortpath.cpp
+
+PURPOSE:
+	This file contains the implementation for all of the methods declared in shortpath.h
+*/
+
+#include "shortpath.h"
+#include<algorithm>	// For reverse
+#include<new>		// For bad_alloc
+
+const int MIN_QUEUE_SIZE = 1024;	// # of indexes a CellQueueClass first makes room for
+
+// The bits of a location's byte in cells:
+//	Bits 0-2	FROM_START, the direction the location was reached in from the start, plus one, or
+//				AT_ROOT if it is the start; 0 if it has not been reached
+//	Bits 3-5	TO_GOAL, the direction it leads in toward the goal, plus one, or AT_ROOT if it is the
+//				goal; 0 if the search from the goal has not reached it. A* has no search from the goal
+//				and uses bit 3 as DEFERRED_BIT instead.
+//	Bit 6		EXPANDED_BIT, set once A* has expanded the location
+//	Bit 7		WALL_BIT
+const unsigned char FROM_START_MASK = 0x07;
+const unsigned char TO_GOAL_MASK = 0x38;
+const int TO_GOAL_SHIFT = 3;
+const unsigned char DEFERRED_BIT = 0x08;	// Set while A*'s best way to the location is 2 longer
+											//  than the estimate being expanded
+const unsigned char EXPANDED_BIT = 0x40;
+const unsigned char WALL_BIT = 0x80;
+const unsigned char AT_ROOT = 5;
+
+// The words for a move east, south, west and north, in the order of steps
+const char* const MOVE_NAMES[NUM_MOVES] = { "EAST ", "SOUTH ", "WEST ", "NORTH " };
+
+
+//***************************************************************************************
+//*																						*
+//*							CellQueueClass Default Constructor							*
+//*																						*
+//***************************************************************************************
+
+// Default Constructor
+CellQueueClass::CellQueueClass()
+{
+	head = 0;
+	length = 0;
+
+} // End CellQueueClass()
+
+
+//***************************************************************************************
+//*																						*
+//*							CellQueueClass Observer / Accessor							*
+//*																						*
+//***************************************************************************************
+
+bool CellQueueClass::IsEmpty() const
+{
+	return length == 0;
+
+} // End IsEmpty()
+
+//***************************************************************************************
+
+int CellQueueClass::GetLength() const
+{
+	return length;
+
+} // End GetLength()
+
+
+//***************************************************************************************
+//*																						*
+//*								CellQueueClass Mutator									*
+//*																						*
+//***************************************************************************************
+
+void CellQueueClass::Enqueue(/* In */ const uint32_t index)	// The index to add
+{
+	vector<uint32_t> grown;	// The buffer after doubling
+
+	// If the buffer is full, double it, unwinding the queue to start at the front of the new one
+	if( length == int(items.size()) )
+	{
+		grown.resize(items.empty() ? MIN_QUEUE_SIZE : 2 * items.size());
+
+		for(int i = 0; i < length; i++)
+		{
+			grown[i] = items[(head + i) & (items.size() - 1)];
+
+		} // End for
+
+		items.swap(grown);
+		head = 0;
+
+	} // End if
+
+	items[(head + length) & (items.size() - 1)] = index;
+	length++;
+
+} // End Enqueue(uint32_t index)
+
+//***************************************************************************************
+
+uint32_t CellQueueClass::Dequeue()
+{
+	const uint32_t index = items[head];	// The index at the front
+
+	head = (head + 1) & (int(items.size()) - 1);
+	length--;
+
+	return index;
+
+} // End Dequeue()
+
+
+//***************************************************************************************
+//*																						*
+//*							ShortestPathClass Non-default Constructor					*
+//*																						*
+//***************************************************************************************
+
+// Non-default Constructor
+ShortestPathClass::ShortestPathClass(/* In */ const MazeClass& maze)	// The maze to search
+{
+	numRows = maze.GetNumRows();
+	numCols = maze.GetNumCols();
+	width = numCols + 2;
+	numExpanded = 0;
+
+	// Moves west and north subtract from an index by wrapping around
+	steps[0] = 1;
+	steps[1] = uint32_t(width);
+	steps[2] = uint32_t(-1);
+	steps[3] = uint32_t(-width);
+
+	try
+	{
+		// Start with every location a wall, then open each location of the maze that is not one,
+		//  leaving the border
+		cells.assign(size_t(numRows + 2) * width, WALL_BIT);
+
+		for(int r = 0; r < numRows; r++)
+		{
+			for(int c = 0; c < numCols; c++)
+			{
+				if(maze.GetStatus(r, c) != WALL)
+				{
+					cells[size_t(r + 1) * width + c + 1] = 0;
+
+				} // End if
+
+			} // End for
+
+		} // End for
+
+	} // End try
+	catch(bad_alloc e)
+	{
+		throw OutOfMemoryException("OutOfMemoryException: The heap has run out of memory.");
+
+	} // End catch
+
+} // End ShortestPathClass(const MazeClass& maze)
+
+
+//***************************************************************************************
+//*																						*
+//*								ShortestPathClass Mutator								*
+//*																						*
+//***************************************************************************************
+
+int ShortestPathClass::FindPath(/* In */ const int			  startRow,	// Row # of the start
+								/* In */ const int			  startCol,	// Column # of the start
+								/* In */ const int			  goalRow,	// Row # of the goal
+								/* In */ const int			  goalCol,	// Column # of the goal
+								/* In */ const SearchMethodEnum method)	// The search to use
+{
+	const uint32_t start = uint32_t(startRow + 1) * width + startCol + 1;	// Index of the start
+	const uint32_t goal = uint32_t(goalRow + 1) * width + goalCol + 1;		// Index of the goal
+	uint32_t meet = goal;	// Where the halves of a bidirectional path join
+	bool found = false;		// True if the goal was reached
+
+	// If the start or the goal is outside the maze
+	if( startRow < 0 || startRow >= numRows || startCol < 0 || startCol >= numCols ||
+		goalRow < 0 || goalRow >= numRows || goalCol < 0 || goalCol >= numCols )
+	{
+		throw RetrieveFromOutOfBoundsException("RetrieveFromOutOfBoundsException: Cannot retrieve a "
+			"position from a location\n                                  outside the bounds of the "
+			"maze.");
+
+	} // End if
+
+	path.clear();
+	numExpanded = 0;
+
+	// Clear the state left by the last search, keeping the walls
+	for(size_t i = 0; i < cells.size(); i++)
+	{
+		cells[i] &= WALL_BIT;
+
+	} // End for
+
+	// If the start or the goal is a wall, there is no path
+	if( (cells[start] & WALL_BIT) != 0 || (cells[goal] & WALL_BIT) != 0 )
+	{
+		return NO_PATH;
+
+	} // End if
+
+	// If the start is the goal, the path has no moves
+	if(start == goal)
+	{
+		return 0;
+
+	} // End if
+
+	try
+	{
+		// Branch depending on the search to use
+		switch( method )
+		{
+			case SEARCH_BFS: found = SearchBFS(start, goal); break;
+
+			case SEARCH_ASTAR: found = SearchAStar(start, goal); break;
+
+			case SEARCH_BIDIRECTIONAL: found = SearchBidirectional(start, goal, meet); break;
+
+		} // End switch
+
+		if( !found )
+		{
+			return NO_PATH;
+
+		} // End if
+
+		TracePath(meet);
+
+	} // End try
+	catch(bad_alloc e)
+	{
+		path.clear();
+		throw OutOfMemoryException("OutOfMemoryException: The heap has run out of memory.");
+
+	} // End catch
+
+	return int(path.size());
+
+} // End FindPath(int startRow, int startCol, int goalRow, int goalCol, SearchMethodEnum method)
+
+//***************************************************************************************
+
+bool ShortestPathClass::SearchBFS(/* In */ const uint32_t start,	// Index of the start
+								  /* In */ const uint32_t goal)		// Index of the goal
+{
+	CellQueueClass queue;	// Locations reached and not yet expanded, nearest the start first
+	uint32_t location;		// The location being expanded
+	uint32_t next;			// A neighbour of location
+
+	cells[start] |= AT_ROOT;
+	queue.Enqueue(start);
+
+	// Expand the locations in the order they were reached, until the goal is reached
+	while( !queue.IsEmpty() )
+	{
+		location = queue.Dequeue();
+		numExpanded++;
+
+		for(int d = 0; d < NUM_MOVES; d++)
+		{
+			next = location + steps[d];
+
+			// If the neighbour is open and has not been reached, reach it
+			if( (cells[next] & (WALL_BIT | FROM_START_MASK)) == 0 )
+			{
+				cells[next] |= (unsigned char)(d + 1);
+
+				if(next == goal)
+				{
+					return true;
+
+				} // End if
+
+				queue.Enqueue(next);
+
+			} // End if
+
+		} // End for
+
+	} // End while
+
+	return false;
+
+} // End SearchBFS(uint32_t start, uint32_t goal)
+
+//***************************************************************************************
+
+bool ShortestPathClass::SearchAStar(/* In */ const uint32_t start,	// Index of the start
+									/* In */ const uint32_t goal)	// Index of the goal
+{
+	const int goalRow = int(goal / width);	// Row of the goal, counting the border
+	const int goalCol = int(goal % width);	// Column of the goal, counting the border
+	vector<uint32_t> current;	// Locations whose estimate is the one being expanded
+	vector<uint32_t> deferred;	// Locations whose estimate is 2 longer
+	bool closer[NUM_MOVES];		// True for each move that brings location closer to the goal
+	uint32_t location;			// The location being expanded
+	uint32_t next;				// A neighbour of location
+	unsigned char cell;			// The byte of next
+	int row;					// Row of location, counting the border
+	int col;					// Column of location, counting the border
+
+	cells[start] |= AT_ROOT;
+	current.push_back(start);
+
+	// Expand the locations with the smallest estimate until the goal is expanded; among those, take
+	//  the one reached last, which heads straight for the goal while nothing is in the way
+	while( true )
+	{
+		// If every location with this estimate is expanded, move on to the next estimate
+		if( current.empty() )
+		{
+			if( deferred.empty() )
+			{
+				return false;
+
+			} // End if
+
+			current.swap(deferred);
+
+		} // End if
+
+		location = current.back();
+		current.pop_back();
+
+		// If the location was already expanded from a shorter way to it, skip it
+		if( (cells[location] & EXPANDED_BIT) != 0 )
+		{
+			continue;
+
+		} // End if
+
+		cells[location] = (unsigned char)((cells[location] | EXPANDED_BIT) & ~DEFERRED_BIT);
+		numExpanded++;
+
+		if(location == goal)
+		{
+			return true;
+
+		} // End if
+
+		row = int(location / width);
+		col = int(location % width);
+		closer[0] = col < goalCol;
+		closer[1] = row < goalRow;
+		closer[2] = col > goalCol;
+		closer[3] = row > goalRow;
+
+		for(int d = 0; d < NUM_MOVES; d++)
+		{
+			next = location + steps[d];
+			cell = cells[next];
+
+			if( (cell & (WALL_BIT | EXPANDED_BIT)) != 0 )
+			{
+				continue;
+
+			} // End if
+
+			// A move toward the goal keeps the estimate, so it is the best way to the neighbour
+			//  unless the neighbour was already reached with this estimate
+			if(closer[d])
+			{
+				if( (cell & FROM_START_MASK) == 0 || (cell & DEFERRED_BIT) != 0 )
+				{
+					cells[next] = (unsigned char)((cell & ~(FROM_START_MASK | DEFERRED_BIT)) | (d + 1));
+					current.push_back(next);
+
+				} // End if
+
+			} // End if
+			// Else a move away from the goal adds 2 to the estimate, so it only reaches neighbours
+			//  not yet reached at all
+			else if( (cell & FROM_START_MASK) == 0 )
+			{
+				cells[next] = (unsigned char)(cell | (d + 1) | DEFERRED_BIT);
+				deferred.push_back(next);
+
+			} // End else if
+
+		} // End for
+
+	} // End while
+
+} // End SearchAStar(uint32_t start, uint32_t goal)
+
+//***************************************************************************************
+
+bool ShortestPathClass::SearchBidirectional(/* In */  const uint32_t start,	// Index of the start
+											/* In */  const uint32_t goal,	// Index of the goal
+											/* Out */ uint32_t&		 meet)	// Where they met
+{
+	CellQueueClass fromStart;	// Locations on the frontier of the search from the start
+	CellQueueClass fromGoal;	// Locations on the frontier of the search from the goal
+	CellQueueClass* queue;		// The frontier being expanded
+	bool forward;				// True while expanding the search from the start
+	int levelSize;				// # of locations on the level being expanded
+	uint32_t location;			// The location being expanded
+	uint32_t next;				// A neighbour of location
+	unsigned char ownMask;		// The bits of a byte the search being expanded sets
+	unsigned char otherMask;	// The bits the other search sets
+	unsigned char mark;			// The bits recording how the search reached next
+
+	cells[start] |= AT_ROOT;
+	cells[goal] |= AT_ROOT << TO_GOAL_SHIFT;
+	fromStart.Enqueue(start);
+	fromGoal.Enqueue(goal);
+
+	// Expand a whole level of the smaller frontier at a time. The first location one search reaches
+	//  that the other has already reached is on a shortest path, since any location the other
+	//  search reached before its last level would have been expanded and found a level sooner
+	while( !fromStart.IsEmpty() && !fromGoal.IsEmpty() )
+	{
+		forward = fromStart.GetLength() <= fromGoal.GetLength();
+		queue = forward ? &fromStart : &fromGoal;
+		ownMask = forward ? FROM_START_MASK : TO_GOAL_MASK;
+		otherMask = forward ? TO_GOAL_MASK : FROM_START_MASK;
+		levelSize = queue->GetLength();
+
+		for(int i = 0; i < levelSize; i++)
+		{
+			location = queue->Dequeue();
+			numExpanded++;
+
+			for(int d = 0; d < NUM_MOVES; d++)
+			{
+				next = location + steps[d];
+
+				if( (cells[next] & (WALL_BIT | ownMask)) != 0 )
+				{
+					continue;
+
+				} // End if
+
+				// The search from the start records the move into next, and the search from the
+				//  goal the move back out of it, which is the opposite direction
+				if(forward)
+				{
+					mark = (unsigned char)(d + 1);
+
+				} // End if
+				else
+				{
+					mark = (unsigned char)(((d + 2) % NUM_MOVES + 1) << TO_GOAL_SHIFT);
+
+				} // End else
+
+				cells[next] |= mark;
+
+				if( (cells[next] & otherMask) != 0 )
+				{
+					meet = next;
+					return true;
+
+				} // End if
+
+				queue->Enqueue(next);
+
+			} // End for
+
+		} // End for
+
+	} // End while
+
+	return false;
+
+} // End SearchBidirectional(uint32_t start, uint32_t goal, uint32_t& meet)
+
+//***************************************************************************************
+
+void ShortestPathClass::TracePath(/* In */ const uint32_t meet)	// Where the halves join
+{
+	uint32_t location = meet;	// A location on the path
+	int move;					// The move into or out of location
+
+	// Follow the moves back from meet to the start, then put them in order
+	while( (cells[location] & FROM_START_MASK) != AT_ROOT )
+	{
+		move = (cells[location] & FROM_START_MASK) - 1;
+		path.push_back((unsigned char)move);
+		location -= steps[move];
+
+	} // End while
+
+	reverse(path.begin(), path.end());
+
+	// Follow the moves on from meet to the goal, if a search from the goal recorded them
+	location = meet;
+
+	while( (cells[location] & TO_GOAL_MASK) != 0 &&
+		   (cells[location] & TO_GOAL_MASK) != (AT_ROOT << TO_GOAL_SHIFT) )
+	{
+		move = ((cells[location] & TO_GOAL_MASK) >> TO_GOAL_SHIFT) - 1;
+		path.push_back((unsigned char)move);
+		location += steps[move];
+
+	} // End while
+
+} // End TracePath(uint32_t meet)
+
+
+//***************************************************************************************
+//*																						*
+//*							ShortestPathClass Observer / Accessor						*
+//*																						*
+//***************************************************************************************
+
+string ShortestPathClass::GetDirections() const
+{
+	string directions;	// The words of the path
+
+	for(size_t i = 0; i < path.size(); i++)
+	{
+		directions += MOVE_NAMES[path[i]];
+
+	} // End for
+
+	return directions;
+
+} // End GetDirections()
+
+//***************************************************************************************
+
+int ShortestPathClass::GetNumExpanded() const
+{
+	return numExpanded;
+
+} // End GetNumExpanded()
\ No newline at end of file
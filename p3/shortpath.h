@@ -0,0 +1,281 @@
+/*
+AUTHOR:
+	Chris Pray
+
+DATE:
+	10/19/26
+
+FILENAME:
+	shortpath.h
+
+PURPOSE:
+	This file contains the specification for ShortestPathClass, which finds a shortest path between any
+	two locations of a MazeClass object, and for CellQueueClass, the queue it searches with. Where
+	PathEnumeratorClass finds every path and takes exponential time, a shortest path takes time and
+	memory in proportion to the number of locations, so it can be found in mazes of 10^8 locations.
+
+	The walls of the maze are copied once into one byte per location, with a border of walls all the
+	way around so that a search never has to check whether a move leaves the maze. A search keeps its
+	own state in the rest of each byte: the direction the location was reached in from the start, the
+	direction it leads in toward the goal, and whether it has been expanded, so that no other memory
+	per location is needed, and the path is traced back from the goal through those directions once
+	the search is done.
+
+	Three searches are offered:
+		SEARCH_BFS				a breadth-first search from the start, with a CellQueueClass
+		SEARCH_ASTAR			an A* search, which expands the locations closest to the goal by
+								Manhattan distance first. A move changes the Manhattan distance by
+								exactly one, so the estimated length of a path through a location
+								only ever grows by 0 or 2, and two buckets of locations take the place
+								of a priority queue.
+		SEARCH_BIDIRECTIONAL	two breadth-first searches, one from the start and one from the goal,
+								each expanding a whole level at a time, the smaller first, until they
+								meet
+
+	A CellQueueClass is a ring buffer of location indexes that doubles in size when it fills, so a
+	search allocates nothing per location it reaches.
+
+ASSUMPTIONS:
+	(1) The maze, with its border, has fewer than 2^32 locations.
+	(2) Only WALL locations block a path. VISITED locations count as open.
+
+EXCEPTION HANDLING:
+	RetrieveFromOutOfBoundsException is thrown by FindPath if the start or the goal is outside the
+	maze. bad_alloc is caught if an attempt to allocate dynamic memory fails, and OutOfMemoryException
+	is thrown in its place.
+
+SUMMARY OF METHODS:
+
+	CellQueueClass()
+		Instantiates an empty CellQueueClass object.
+
+	bool IsEmpty() const
+		Returns true if the queue holds no indexes.
+
+	int GetLength() const
+		Returns the number of indexes in the queue.
+
+	void Enqueue(uint32_t index)
+		Adds index to the back of the queue.
+
+	uint32_t Dequeue()
+		Removes and returns the index at the front of the queue.
+
+	ShortestPathClass(const MazeClass& maze)
+		Instantiates a ShortestPathClass object for the walls of maze.
+
+	int FindPath(int startRow, int startCol, int goalRow, int goalCol, SearchMethodEnum method)
+		Finds a shortest path from (startRow, startCol) to (goalRow, goalCol) and returns its length.
+
+	string GetDirections() const
+		Returns the directions of the last path found.
+
+	int GetNumExpanded() const
+		Returns the number of locations the last search expanded.
+*/
+
+#ifndef ShortestPath_h
+#define ShortestPath_h
+
+#include "maze.h"		// For MazeClass
+#include<cstdint>		// For uint32_t
+#include<string>		// For string
+#include<vector>		// For vector
+using namespace std;
+
+enum SearchMethodEnum { SEARCH_BFS, SEARCH_ASTAR, SEARCH_BIDIRECTIONAL };
+
+const int NO_PATH = -1;		// Length FindPath returns when the goal cannot be reached
+const int NUM_MOVES = 4;	// # of directions a path can move in
+
+class CellQueueClass
+{
+	public:
+
+		// Constructor
+
+		CellQueueClass();
+		/*
+		Purpose:			Instantiates an empty CellQueueClass object.
+		Pre:				None
+		Post:				An empty CellQueueClass object has been instantiated.
+		Classification:		Default Constructor
+		Order of Magnitude:	O(1)
+		*/
+
+
+		// ADT CellQueueClass Operations
+
+		bool IsEmpty() const;
+		/*
+		Purpose:			Determines whether the queue is empty.
+		Pre:				A CellQueueClass object has been instantiated.
+		Post:				True has been returned if the queue holds no indexes, false otherwise.
+		Classification:		Observer / Predicator
+		Order of Magnitude:	O(1)
+		*/
+
+		int GetLength() const;
+		/*
+		Purpose:			Returns the number of indexes in the queue.
+		Pre:				A CellQueueClass object has been instantiated.
+		Post:				The number of indexes has been returned.
+		Classification:		Observer / Accessor
+		Order of Magnitude:	O(1)
+		*/
+
+		void Enqueue(/* In */ const uint32_t index);	// The index to add
+		/*
+		Purpose:			Adds index to the back of the queue, doubling the buffer if it is full.
+		Pre:				A CellQueueClass object has been instantiated.
+		Post:				index is at the back of the queue.
+		Classification:		Mutator
+		Order of Magnitude:	O(1) amortized
+		Exceptions Thrown:	bad_alloc
+		*/
+
+		uint32_t Dequeue();
+		/*
+		Purpose:			Removes and returns the index at the front of the queue.
+		Pre:				The queue is not empty.
+		Post:				The index that was at the front has been removed and returned.
+		Classification:		Mutator
+		Order of Magnitude:	O(1)
+		*/
+
+
+	private:
+
+		vector<uint32_t> items;	// The ring buffer; its size is zero or a power of two
+		int head;				// Index in items of the front of the queue
+		int length;				// # of indexes in the queue
+
+}; // End CellQueueClass
+
+class ShortestPathClass
+{
+	public:
+
+		// Constructor
+
+		ShortestPathClass(/* In */ const MazeClass& maze);	// The maze to search
+		/*
+		Purpose:			Instantiates a ShortestPathClass object for the walls of maze.
+		Pre:				maze has been built.
+		Post:				A ShortestPathClass object has been instantiated with no path found.
+		Classification:		Non-default Constructor
+		Order of Magnitude:	O(N * M), where N = # of rows and M = # of columns
+		Exceptions Thrown:	OutOfMemoryException
+		*/
+
+
+		// ADT ShortestPathClass Operations
+
+		int FindPath(/* In */ const int				 startRow,	// Row # of the start
+					 /* In */ const int				 startCol,	// Column # of the start
+					 /* In */ const int				 goalRow,	// Row # of the goal
+					 /* In */ const int				 goalCol,	// Column # of the goal
+					 /* In */ const SearchMethodEnum method);	// The search to use
+		/*
+		Purpose:			Finds a shortest path from (startRow, startCol) to (goalRow, goalCol)
+							that crosses no wall, using method.
+		Pre:				A ShortestPathClass object has been instantiated.
+		Post:				The number of moves on a shortest path has been returned, and the path
+							kept for GetDirections. If the start or the goal is a wall, or the goal
+							cannot be reached, NO_PATH has been returned and no path is kept. Every
+							method returns the same length.
+		Classification:		Mutator
+		Order of Magnitude:	O(N * M)
+		Exceptions Thrown:	RetrieveFromOutOfBoundsException, OutOfMemoryException
+		*/
+
+		string GetDirections() const;
+		/*
+		Purpose:			Returns the directions of the last path found, in the word format of
+							solution.out, each followed by a space.
+		Pre:				A ShortestPathClass object has been instantiated.
+		Post:				The directions have been returned, or an empty string if there is no path
+							or the start is the goal.
+		Classification:		Observer / Accessor
+		Order of Magnitude:	O(L), where L = # of moves on the path
+		Exceptions Thrown:	bad_alloc
+		*/
+
+		int GetNumExpanded() const;
+		/*
+		Purpose:			Returns the number of locations the last search expanded.
+		Pre:				A ShortestPathClass object has been instantiated.
+		Post:				The number of locations whose neighbours were looked at has been returned,
+							or 0 if no search has run.
+		Classification:		Observer / Accessor
+		Order of Magnitude:	O(1)
+		*/
+
+
+	private:
+
+		bool SearchBFS(/* In */ const uint32_t start,	// Index of the start
+					  /* In */ const uint32_t goal);	// Index of the goal
+		/*
+		Purpose:			Runs a breadth-first search from start until goal is reached.
+		Pre:				cells holds no search state. start and goal are not walls.
+		Post:				If goal was reached, each location on a shortest path to it holds the
+							direction it was reached in, and true has been returned. Otherwise false
+							has been returned.
+		Classification:		Mutator
+		Order of Magnitude:	O(N * M)
+		Exceptions Thrown:	bad_alloc
+		*/
+
+		bool SearchAStar(/* In */ const uint32_t start,	// Index of the start
+						/* In */ const uint32_t goal);	// Index of the goal
+		/*
+		Purpose:			Runs an A* search from start, with the Manhattan distance to goal as the
+							estimate, until goal is expanded.
+		Pre:				cells holds no search state. start and goal are not walls.
+		Post:				As for SearchBFS.
+		Classification:		Mutator
+		Order of Magnitude:	O(N * M)
+		Exceptions Thrown:	bad_alloc
+		*/
+
+		bool SearchBidirectional(/* In */  const uint32_t start,	// Index of the start
+								 /* In */  const uint32_t goal,		// Index of the goal
+								 /* Out */ uint32_t&	  meet);	// Gets where the searches met
+		/*
+		Purpose:			Runs breadth-first searches from start and from goal, a level at a time,
+							until they meet.
+		Pre:				cells holds no search state. start and goal are not walls.
+		Post:				If they met, meet is the location where they did, each location on a
+							shortest path from start to meet holds the direction it was reached in,
+							each on a shortest path from meet to goal holds the direction it leads in,
+							and true has been returned. Otherwise false has been returned.
+		Classification:		Mutator
+		Order of Magnitude:	O(N * M)
+		Exceptions Thrown:	bad_alloc
+		*/
+
+		void TracePath(/* In */ const uint32_t meet);	// Where the halves of the path join
+		/*
+		Purpose:			Gathers the moves of the path found by the last search into path.
+		Pre:				A search has reached meet from the start, and from the goal if it was
+							bidirectional.
+		Post:				path holds the moves from the start to the goal.
+		Classification:		Mutator
+		Order of Magnitude:	O(L)
+		Exceptions Thrown:	bad_alloc
+		*/
+
+		int numRows;				// # of rows in the maze
+		int numCols;				// # of columns in the maze
+		int width;					// # of columns in cells, counting the border
+		vector<unsigned char> cells;	// Each location's wall and search state, row by row, with a
+										//  border of walls
+		uint32_t steps[NUM_MOVES];	// Change in index of a move east, south, west and north;
+									//  moves west and north wrap around
+		vector<unsigned char> path;	// The moves of the last path found, as indexes into steps
+		int numExpanded;			// # of locations the last search expanded
+
+}; // End ShortestPathClass
+
+#endif
\ No newline at end of file
@@ -0,0 +1,506 @@
+/*
+AUTHOR:
+	Chris Pray
+
+DATE:
+	10/19/26
+
+FILENAME:
+	solutionfile.cpp
+
+PURPOSE:
+	This file contains the implementation for all of the methods declared in solutionfile.h
+*/
+
+#include "solutionfile.h"
+#include<charconv>	// For to_chars
+#include<cstring>	// For memcmp and memcpy
+#include<new>		// For bad_alloc
+
+const char SOLUTION_LABEL[] = "Solution #";	// Start of the line that numbers a text solution
+const int SOLUTION_LABEL_SIZE = 10;				// # of characters in SOLUTION_LABEL
+const int MAX_DIGITS = 20;						// Most characters to_chars writes for a long long
+const int MAX_NUMBER_SIZE = SOLUTION_LABEL_SIZE + MAX_DIGITS + 2;	// Most bytes a "Solution #N:"
+																	//  line takes, with its newline
+const int MAX_WORD_SIZE = 6;					// Most bytes the word for a move takes
+const int MAX_VARINT_SIZE = 10;					// Most bytes a varint of a size_t takes
+const int MOVES_PER_BYTE = 4;					// # of moves packed into each byte of a compact
+												//  solution
+const int BITS_PER_MOVE = 2;					// # of bits each packed move takes
+
+// The word written for each move, and its length, indexed by DirectionEnum
+const char* const MOVE_WORDS[] = { "NORTH ", "SOUTH ", "EAST ", "WEST " };
+const int MOVE_WORD_SIZES[] = { 6, 6, 5, 5 };
+
+
+//***************************************************************************************
+//*																						*
+//*						SolutionWriterClass: Constructor and Destructor					*
+//*																						*
+//***************************************************************************************
+
+// Non-default Constructor
+SolutionWriterClass::SolutionWriterClass(/* In/Out */ ofstream&				   setDout,	// The file
+										 /* In */	  const SolutionFormatEnum setFormat)	// Format
+	: dout(setDout)
+{
+	format = setFormat;
+	used = 0;
+	numWritten = 0;
+
+	try
+	{
+		buffer.resize(WRITE_BUFFER_SIZE);
+
+	} // End try
+	catch(bad_alloc e)
+	{
+		throw nmspcMazeExceptions::OutOfMemoryException("OutOfMemoryException: The heap has run out "
+			"of memory.");
+
+	} // End catch
+
+	// A compact file starts with its magic bytes
+	if(format == SOLUTIONS_COMPACT)
+	{
+		memcpy(buffer.data(), SOLUTION_FILE_MAGIC, SOLUTION_FILE_MAGIC_SIZE);
+		used = SOLUTION_FILE_MAGIC_SIZE;
+
+	} // End if
+
+} // End SolutionWriterClass(ofstream& setDout, SolutionFormatEnum setFormat)
+
+//***************************************************************************************
+
+// Destructor
+SolutionWriterClass::~SolutionWriterClass()
+{
+	Flush();
+
+} // End ~SolutionWriterClass()
+
+
+//***************************************************************************************
+//*																						*
+//*							SolutionWriterClass: Mutator								*
+//*																						*
+//***************************************************************************************
+
+void SolutionWriterClass::WriteSolution(/* In */ const unsigned char* moves,		// The moves
+										/* In */ const int			  numMoves)		// # of moves
+{
+	size_t shared = 0;		// # of moves shared with the start of the previous solution
+	unsigned char packed;	// Up to MOVES_PER_BYTE moves, packed into one byte
+	int i;					// Index of a move
+
+	numWritten++;
+
+	// If only counting, there is nothing to write
+	if(format == SOLUTIONS_COUNT_ONLY)
+	{
+		return;
+
+	} // End if
+
+	// If writing text, write the number of the solution and then the word for each move
+	if(format == SOLUTIONS_TEXT)
+	{
+		MakeRoom(MAX_NUMBER_SIZE);
+		memcpy(buffer.data() + used, SOLUTION_LABEL, SOLUTION_LABEL_SIZE);
+		used += SOLUTION_LABEL_SIZE;
+		used = to_chars(buffer.data() + used, buffer.data() + buffer.size(), numWritten).ptr -
+			   buffer.data();
+		buffer[used++] = ':';
+		buffer[used++] = '\n';
+
+		for(i = 0; i < numMoves; i++)
+		{
+			MakeRoom(MAX_WORD_SIZE);
+			memcpy(buffer.data() + used, MOVE_WORDS[moves[i]], MOVE_WORD_SIZES[moves[i]]);
+			used += MOVE_WORD_SIZES[moves[i]];
+
+		} // End for
+
+		MakeRoom(2);
+		buffer[used++] = '\n';
+		buffer[used++] = '\n';
+
+	} // End if
+	// Else write the # of moves shared with the previous solution, and pack the rest
+	else
+	{
+		while( shared < previous.size() && shared < size_t(numMoves) &&
+			   previous[shared] == moves[shared] )
+		{
+			shared++;
+
+		} // End while
+
+		MakeRoom(2 * MAX_VARINT_SIZE);
+		PutVarint(shared);
+		PutVarint(numMoves - shared);
+
+		for(i = int(shared); i < numMoves; i += MOVES_PER_BYTE)
+		{
+			packed = 0;
+
+			for(int j = 0; j < MOVES_PER_BYTE && i + j < numMoves; j++)
+			{
+				packed |= moves[i + j] << (BITS_PER_MOVE * j);
+
+			} // End for
+
+			MakeRoom(1);
+			buffer[used++] = char(packed);
+
+		} // End for
+
+		// Keep the moves to compare the next solution against
+		try
+		{
+			previous.resize(shared);
+			previous.insert(previous.end(), moves + shared, moves + numMoves);
+
+		} // End try
+		catch(bad_alloc e)
+		{
+			throw nmspcMazeExceptions::OutOfMemoryException("OutOfMemoryException: The heap has run "
+				"out of memory.");
+
+		} // End catch
+
+	} // End else
+
+} // End WriteSolution(const unsigned char* moves, int numMoves)
+
+//***************************************************************************************
+
+void SolutionWriterClass::Flush()
+{
+	if(used > 0)
+	{
+		dout.write(buffer.data(), used);
+		used = 0;
+
+	} // End if
+
+} // End Flush()
+
+//***************************************************************************************
+
+void SolutionWriterClass::Finish()
+{
+	// A compact file ends with a record of no moves, holding the # of solutions written
+	if(format == SOLUTIONS_COMPACT)
+	{
+		MakeRoom(3 * MAX_VARINT_SIZE);
+		PutVarint(0);
+		PutVarint(0);
+		PutVarint(size_t(numWritten));
+
+	} // End if
+
+	Flush();
+
+} // End Finish()
+
+//***************************************************************************************
+
+void SolutionWriterClass::Resume(/* In */ const long long setNumWritten)	// # already written
+{
+	numWritten = setNumWritten;
+
+	// The output file already starts with the magic bytes, and the next solution has nothing
+	//  written before it to share moves with
+	used = 0;
+	previous.clear();
+
+} // End Resume(long long setNumWritten)
+
+//***************************************************************************************
+
+long long SolutionWriterClass::Sync()
+{
+	Flush();
+
+	if( !dout.is_open() )
+	{
+		return 0;
+
+	} // End if
+
+	dout.flush();
+
+	return (long long)dout.tellp();
+
+} // End Sync()
+
+//***************************************************************************************
+
+void SolutionWriterClass::MakeRoom(/* In */ const size_t numBytes)	// # of bytes to be added
+{
+	if(used + numBytes > buffer.size())
+	{
+		Flush();
+
+	} // End if
+
+} // End MakeRoom(size_t numBytes)
+
+//***************************************************************************************
+
+void SolutionWriterClass::PutVarint(/* In */ size_t value)	// The value to write
+{
+	// Write seven bits at a time, lowest first, flagging every byte but the last
+	while(value >= 0x80)
+	{
+		buffer[used++] = char((value & 0x7F) | 0x80);
+		value >>= 7;
+
+	} // End while
+
+	buffer[used++] = char(value);
+
+} // End PutVarint(size_t value)
+
+
+//***************************************************************************************
+//*																						*
+//*						SolutionWriterClass: Observer / Accessor						*
+//*																						*
+//***************************************************************************************
+
+SolutionFormatEnum SolutionWriterClass::GetFormat() const
+{
+	return format;
+
+} // End GetFormat()
+
+//***************************************************************************************
+
+long long SolutionWriterClass::GetNumWritten() const
+{
+	return numWritten;
+
+} // End GetNumWritten()
+
+
+//***************************************************************************************
+//*																						*
+//*						SolutionReaderClass: Default Constructor						*
+//*																						*
+//***************************************************************************************
+
+// Default Constructor
+SolutionReaderClass::SolutionReaderClass()
+{
+	next = 0;
+	filled = 0;
+	numRead = 0;
+	complete = false;
+
+} // End SolutionReaderClass()
+
+
+//***************************************************************************************
+//*																						*
+//*							SolutionReaderClass: Mutator								*
+//*																						*
+//***************************************************************************************
+
+bool SolutionReaderClass::Open(/* In */ const string& fileName)	// Name of the file
+{
+	unsigned char magic[SOLUTION_FILE_MAGIC_SIZE];	// The first bytes of the file
+
+	if( din.is_open() )
+	{
+		din.close();
+
+	} // End if
+
+	din.clear();
+	next = 0;
+	filled = 0;
+	numRead = 0;
+	complete = false;
+
+	try
+	{
+		buffer.resize(READ_BUFFER_SIZE);
+
+	} // End try
+	catch(bad_alloc e)
+	{
+		throw nmspcMazeExceptions::OutOfMemoryException("OutOfMemoryException: The heap has run out "
+			"of memory.");
+
+	} // End catch
+
+	din.open(fileName.c_str(), ios::binary);
+
+	if( !din )
+	{
+		return false;
+
+	} // End if
+
+	// Check that the file starts with the magic bytes
+	for(int i = 0; i < SOLUTION_FILE_MAGIC_SIZE; i++)
+	{
+		if( !GetByte(magic[i]) )
+		{
+			return false;
+
+		} // End if
+
+	} // End for
+
+	return memcmp(magic, SOLUTION_FILE_MAGIC, SOLUTION_FILE_MAGIC_SIZE) == 0;
+
+} // End Open(const string& fileName)
+
+//***************************************************************************************
+
+bool SolutionReaderClass::ReadSolution(/* Out */ vector<unsigned char>& moves)	// Gets the moves
+{
+	size_t shared;			// # of moves shared with the previous solution
+	size_t numNew;			// # of moves that follow them
+	size_t numSolutions;	// # of solutions the end record holds
+	unsigned char packed;	// Up to four packed moves
+
+	// Once the end record has been read, there is nothing left
+	if(complete)
+	{
+		return false;
+
+	} // End if
+
+	// Read the record's lengths; the end of the file here, before the end record, means it was cut
+	//  short
+	if( !GetVarint(shared) || !GetVarint(numNew) )
+	{
+		return false;
+
+	} // End if
+
+	// If this is the end record, the file is whole if it counts the solutions read
+	if(shared == 0 && numNew == 0)
+	{
+		complete = GetVarint(numSolutions) && numSolutions == size_t(numRead);
+		return false;
+
+	} // End if
+
+	// A solution cannot share more moves than the last one had
+	if(shared > moves.size())
+	{
+		return false;
+
+	} // End if
+
+	try
+	{
+		moves.resize(shared);
+
+		// Unpack the new moves, four to a byte
+		for(size_t i = 0; i < numNew; i += MOVES_PER_BYTE)
+		{
+			if( !GetByte(packed) )
+			{
+				return false;
+
+			} // End if
+
+			for(size_t j = 0; j < size_t(MOVES_PER_BYTE) && i + j < numNew; j++)
+			{
+				moves.push_back((packed >> (BITS_PER_MOVE * j)) & 0x03);
+
+			} // End for
+
+		} // End for
+
+	} // End try
+	catch(bad_alloc e)
+	{
+		throw nmspcMazeExceptions::OutOfMemoryException("OutOfMemoryException: The heap has run out "
+			"of memory.");
+
+	} // End catch
+
+	numRead++;
+
+	return true;
+
+} // End ReadSolution(vector<unsigned char>& moves)
+
+//***************************************************************************************
+
+bool SolutionReaderClass::GetByte(/* Out */ unsigned char& value)	// Gets the byte
+{
+	// If the buffer has been used up, refill it from the file
+	if(next == filled)
+	{
+		din.read(buffer.data(), buffer.size());
+		filled = size_t(din.gcount());
+		next = 0;
+
+		if(filled == 0)
+		{
+			return false;
+
+		} // End if
+
+	} // End if
+
+	value = (unsigned char)buffer[next++];
+
+	return true;
+
+} // End GetByte(unsigned char& value)
+
+//***************************************************************************************
+
+bool SolutionReaderClass::GetVarint(/* Out */ size_t& value)	// Gets the value
+{
+	unsigned char byte;	// A byte of the varint
+	int shift = 0;		// # of bits of value already read
+
+	value = 0;
+
+	do
+	{
+		if( !GetByte(byte) || shift >= 7 * MAX_VARINT_SIZE )
+		{
+			return false;
+
+		} // End if
+
+		value |= size_t(byte & 0x7F) << shift;
+		shift += 7;
+
+	} while( (byte & 0x80) != 0 );
+
+	return true;
+
+} // End GetVarint(size_t& value)
+
+
+//***************************************************************************************
+//*																						*
+//*						SolutionReaderClass: Observer / Accessor						*
+//*																						*
+//***************************************************************************************
+
+long long SolutionReaderClass::GetNumRead() const
+{
+	return numRead;
+
+} // End GetNumRead()
+
+//***************************************************************************************
+
+bool SolutionReaderClass::IsComplete() const
+{
+	return complete;
+
+} // End IsComplete()
\ No newline at end of file
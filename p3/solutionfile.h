@@ -0,0 +1,367 @@
+/*
+AUTHOR:
+	Chris Pray
+
+DATE:
+	10/19/26
+
+FILENAME:
+	solutionfile.h
+
+PURPOSE:
+	This file contains the specifications for SolutionWriterClass, which writes the solutions of a maze
+	to an output file in either of two formats, and SolutionReaderClass, which reads them back from a
+	compact solution file.
+
+	A solution is handed over as its moves, one DirectionEnum per byte, from the move into the maze to
+	the move out of it. In the text format each is written as it always has been, as "Solution #N:",
+	the words "EAST ", "SOUTH ", "WEST " or "NORTH " for its moves, and a blank line.
+
+	Solutions found in depth-first order share long prefixes, so the compact format writes each one
+	front coded against the solution before it:
+		Bytes 0-7		the magic bytes "P3SOLNC2"
+		Then, for each solution, in order:
+			the # of moves it shares with the start of the previous solution (0 for the first), and
+			the # of moves that follow them, each as an unsigned LEB128 varint: seven bits per byte,
+			lowest first, with the top bit set on every byte but the last
+			the moves that follow them, four to a byte, lowest bits first, two bits per move holding
+			its DirectionEnum; the bits past the last move are clear
+		Then an end record: two varints of 0, which no solution can have, and the # of solutions
+		as a varint
+	A solution of L moves that shares S of them costs about (L - S) / 4 + 2 bytes, against about 6 * L
+	bytes of text.
+
+	Either way the output is gathered in a WRITE_BUFFER_SIZE buffer and handed to the output file a
+	buffer at a time, instead of a stream insertion per word. A writer can instead only count the
+	solutions, writing nothing, for a search that needs no more than their number.
+
+	A writer can take over an output file that an earlier writer was interrupted in, from a checkpoint
+	of how many solutions that writer had written. It numbers the solutions on from there, and, in
+	compact form, writes its first solution whole, so the file decodes the same as if it had been
+	written in one go. The output file is cut back to the checkpoint first, which drops the end record
+	of the earlier writer, if it wrote one.
+
+	A reader that meets the end of the file in the middle of a record, or before the end record, or
+	an end record whose # of solutions is not the # read, stops and reports the file as cut short.
+
+ASSUMPTIONS:
+	(1) A solution has at least one move, and no solution is a prefix of the one after it.
+
+EXCEPTION HANDLING:
+	bad_alloc is caught if an attempt to allocate dynamic memory fails, and
+	nmspcMazeExceptions::OutOfMemoryException is thrown in its place.
+
+SUMMARY OF METHODS:
+
+	SolutionWriterClass
+
+		SolutionWriterClass(ofstream& setDout, SolutionFormatEnum setFormat)
+			Instantiates a SolutionWriterClass object that writes to setDout in setFormat.
+
+		~SolutionWriterClass()
+			Writes out whatever is left in the buffer.
+
+		void WriteSolution(const unsigned char* moves, int numMoves)
+			Writes the next solution.
+
+		void Flush()
+			Writes the buffer out to the output file.
+
+		void Finish()
+			Writes the end record of a compact file, and then the buffer out to the output file.
+
+		void Resume(long long setNumWritten)
+			Carries on numbering from an earlier writer of the same output file.
+
+		long long Sync()
+			Writes the buffer out, flushes the output file and returns its size.
+
+		SolutionFormatEnum GetFormat() const
+			Returns the format the solutions are written in.
+
+		long long GetNumWritten() const
+			Returns the number of solutions written so far.
+
+	SolutionReaderClass
+
+		SolutionReaderClass()
+			Instantiates a SolutionReaderClass object with no file open.
+
+		bool Open(const string& fileName)
+			Opens a compact solution file.
+
+		bool ReadSolution(vector<unsigned char>& moves)
+			Reads the next solution.
+
+		long long GetNumRead() const
+			Returns the number of solutions read so far.
+
+		bool IsComplete() const
+			Returns true if the whole file, up to its end record, has been read.
+*/
+
+#ifndef SolutionFile_h
+#define SolutionFile_h
+
+#include "ItemType.h"		// For DirectionEnum
+#include "MazeExceptions.h"	// For OutOfMemoryException
+#include<cstddef>			// For size_t
+#include<fstream>			// For ifstream and ofstream
+#include<string>			// For string
+#include<vector>			// For vector
+using namespace std;
+
+enum SolutionFormatEnum { SOLUTIONS_TEXT, SOLUTIONS_COMPACT, SOLUTIONS_COUNT_ONLY };
+
+const char SOLUTION_FILE_MAGIC[] = "P3SOLNC2";	// First bytes of a compact solution file
+const int SOLUTION_FILE_MAGIC_SIZE = 8;			// # of magic bytes
+const int WRITE_BUFFER_SIZE = 1 << 22;			// # of bytes gathered before each write to the file
+const int READ_BUFFER_SIZE = 1 << 20;			// # of bytes read from the file at a time
+
+class SolutionWriterClass
+{
+	public:
+
+		// Constructor and Destructor
+
+		SolutionWriterClass(/* In/Out */ ofstream&				  setDout,		// The output file
+							/* In */	 const SolutionFormatEnum setFormat);	// Format to write
+		/*
+		Purpose:			Instantiates a SolutionWriterClass object that writes solutions to setDout
+							in setFormat, numbering them from 1. A compact file starts with its magic
+							bytes. SOLUTIONS_COUNT_ONLY writes nothing.
+		Pre:				setDout has been associated with an output file, in binary mode if
+							setFormat is SOLUTIONS_COMPACT, or setFormat is SOLUTIONS_COUNT_ONLY.
+		Post:				A SolutionWriterClass object has been instantiated.
+		Classification:		Non-default Constructor
+		Order of Magnitude:	O(1)
+		Exceptions Thrown:	OutOfMemoryException
+		*/
+
+		~SolutionWriterClass();
+		/*
+		Purpose:			Writes out whatever is left in the buffer.
+		Pre:				A SolutionWriterClass object has been instantiated, and its output file
+							has not been closed.
+		Post:				The buffer has been written out to the output file.
+		Classification:		Destructor
+		Order of Magnitude:	O(B), where B = # of bytes in the buffer
+		*/
+
+
+		// ADT SolutionWriterClass Operations
+
+		void WriteSolution(/* In */ const unsigned char* moves,		// The moves of the solution
+						   /* In */ const int			 numMoves);	// # of moves
+		/*
+		Purpose:			Writes the next solution, in the format of the object, or only counts it.
+		Pre:				moves holds numMoves DirectionEnum values, from the move into the maze to
+							the move out of it. numMoves > 0.
+		Post:				The solution has been added to the buffer, and the buffer has been written
+							out to the output file whenever it filled.
+		Classification:		Mutator
+		Order of Magnitude:	O(L), where L = numMoves
+		Exceptions Thrown:	OutOfMemoryException
+		*/
+
+		void Flush();
+		/*
+		Purpose:			Writes the buffer out to the output file.
+		Pre:				A SolutionWriterClass object has been instantiated.
+		Post:				Every solution written so far is in the output file's stream, and the
+							buffer is empty.
+		Classification:		Mutator
+		Order of Magnitude:	O(B), where B = # of bytes in the buffer
+		*/
+
+		void Finish();
+		/*
+		Purpose:			Ends the output file: writes the end record if the format is compact, and
+							then writes the buffer out to the output file.
+		Pre:				A SolutionWriterClass object has been instantiated.
+		Post:				Every solution written so far, followed in a compact file by the end
+							record, is in the output file's stream, and the buffer is empty. No more
+							solutions may be written, but the writer may be resumed over the file
+							after it is cut back to a checkpoint taken before Finish.
+		Classification:		Mutator
+		Order of Magnitude:	O(B), where B = # of bytes in the buffer
+		*/
+
+		void Resume(/* In */ const long long setNumWritten);	// # of solutions already written
+		/*
+		Purpose:			Carries on from an earlier writer that had written setNumWritten solutions
+							to the same output file: the next solution is numbered setNumWritten + 1,
+							the magic bytes of a compact file are not written again, and the next
+							compact solution is written whole.
+		Pre:				No solution has been written since the object was instantiated. The output
+							file holds exactly what the earlier writer had written, and is positioned
+							at its end.
+		Post:				The object carries on from the earlier writer.
+		Classification:		Mutator
+		Order of Magnitude:	O(1)
+		*/
+
+		long long Sync();
+		/*
+		Purpose:			Writes the buffer out and flushes the output file, so that everything
+							written so far is in the file, and returns the position reached in it.
+		Pre:				A SolutionWriterClass object has been instantiated.
+		Post:				The buffer is empty and the output file has been flushed. The position of
+							the output file, or 0 if it is not open, has been returned.
+		Classification:		Mutator
+		Order of Magnitude:	O(B), where B = # of bytes in the buffer
+		*/
+
+		SolutionFormatEnum GetFormat() const;
+		/*
+		Purpose:			Returns the format the solutions are written in.
+		Pre:				A SolutionWriterClass object has been instantiated.
+		Post:				The format has been returned.
+		Classification:		Observer / Accessor
+		Order of Magnitude:	O(1)
+		*/
+
+		long long GetNumWritten() const;
+		/*
+		Purpose:			Returns the number of solutions written or counted so far, counting those
+							of an earlier writer resumed from.
+		Pre:				A SolutionWriterClass object has been instantiated.
+		Post:				The number of solutions has been returned.
+		Classification:		Observer / Accessor
+		Order of Magnitude:	O(1)
+		*/
+
+
+	private:
+
+		SolutionWriterClass(/* In */ const SolutionWriterClass& orig);
+		void operator=(/* In */ const SolutionWriterClass& orig);
+		/*
+		Purpose:			Not defined; a SolutionWriterClass object shares its output file and cannot
+							be copied.
+		*/
+
+		void MakeRoom(/* In */ const size_t numBytes);	// # of bytes about to be added
+		/*
+		Purpose:			Writes the buffer out to the output file if it cannot take numBytes more.
+		Pre:				numBytes <= WRITE_BUFFER_SIZE.
+		Post:				The buffer has room for numBytes more bytes.
+		Classification:		Mutator
+		Order of Magnitude:	O(B), where B = # of bytes in the buffer
+		*/
+
+		void PutVarint(/* In */ size_t value);	// The value to write
+		/*
+		Purpose:			Adds value to the buffer as an unsigned LEB128 varint.
+		Pre:				The buffer has room for 10 more bytes.
+		Post:				value has been added to the buffer.
+		Classification:		Mutator
+		Order of Magnitude:	O(1)
+		*/
+
+		ofstream& dout;					// The output file
+		SolutionFormatEnum format;		// Format the solutions are written in
+		vector<char> buffer;			// Output not yet written to the output file
+		size_t used;					// # of bytes of buffer in use
+		vector<unsigned char> previous;	// The moves of the last compact solution written
+		long long numWritten;			// # of solutions written so far
+
+}; // End SolutionWriterClass
+
+class SolutionReaderClass
+{
+	public:
+
+		// Constructor
+
+		SolutionReaderClass();
+		/*
+		Purpose:			Instantiates a SolutionReaderClass object with no file open.
+		Pre:				None
+		Post:				A SolutionReaderClass object with no file open has been instantiated.
+		Classification:		Default Constructor
+		Order of Magnitude:	O(1)
+		*/
+
+
+		// ADT SolutionReaderClass Operations
+
+		bool Open(/* In */ const string& fileName);	// Name of the compact solution file
+		/*
+		Purpose:			Closes any file already open and opens the file named fileName, checking
+							its magic bytes.
+		Pre:				A SolutionReaderClass object has been instantiated.
+		Post:				If the file was opened and is a compact solution file, it is positioned at
+							its first solution and true has been returned. Otherwise false has been
+							returned.
+		Classification:		Mutator
+		Order of Magnitude:	O(1)
+		Exceptions Thrown:	OutOfMemoryException
+		*/
+
+		bool ReadSolution(/* Out */ vector<unsigned char>& moves);	// Gets the moves
+		/*
+		Purpose:			Reads the next solution of the file.
+		Pre:				A file has been opened. moves holds the last solution read, if any.
+		Post:				If a whole solution was left to read, moves holds its moves, one
+							DirectionEnum per byte, and true has been returned. Otherwise, at the end
+							record or wherever the file is cut short or corrupt, false has been
+							returned, and IsComplete tells which.
+		Classification:		Mutator
+		Order of Magnitude:	O(L), where L = # of moves not shared with the last solution read
+		Exceptions Thrown:	OutOfMemoryException
+		*/
+
+		long long GetNumRead() const;
+		/*
+		Purpose:			Returns the number of solutions read so far.
+		Pre:				A SolutionReaderClass object has been instantiated.
+		Post:				The number of solutions has been returned.
+		Classification:		Observer / Accessor
+		Order of Magnitude:	O(1)
+		*/
+
+		bool IsComplete() const;
+		/*
+		Purpose:			Determines whether the whole file has been read: ReadSolution reached an
+							end record whose # of solutions is the # read.
+		Pre:				A SolutionReaderClass object has been instantiated.
+		Post:				True has been returned if the end record was reached and matched, false
+							if it has not been reached, or if the file is cut short or corrupt.
+		Classification:		Observer / Predicator
+		Order of Magnitude:	O(1)
+		*/
+
+
+	private:
+
+		bool GetByte(/* Out */ unsigned char& value);	// Gets the byte
+		/*
+		Purpose:			Takes the next byte of the file, refilling the buffer from it when empty.
+		Pre:				A file has been opened.
+		Post:				If a byte was left, value holds it and true has been returned. Otherwise
+							false has been returned.
+		Classification:		Mutator
+		Order of Magnitude:	O(1) amortized
+		*/
+
+		bool GetVarint(/* Out */ size_t& value);	// Gets the value
+		/*
+		Purpose:			Takes the next unsigned LEB128 varint of the file.
+		Pre:				A file has been opened.
+		Post:				If a whole varint was left, value holds it and true has been returned.
+							Otherwise false has been returned.
+		Classification:		Mutator
+		Order of Magnitude:	O(1)
+		*/
+
+		ifstream din;			// The compact solution file
+		vector<char> buffer;	// Bytes read from the file and not yet taken
+		size_t next;			// Index in buffer of the next byte to take
+		size_t filled;			// # of bytes of buffer holding data
+		long long numRead;		// # of solutions read so far
+		bool complete;			// True once a matching end record has been read
+
+}; // End SolutionReaderClass
+
+#endif
\ No newline at end of file
@@ -0,0 +1,361 @@
+/*
+AUTHOR:
+	Chris Pray
+
+DATE:
+	10/19/26
+
+FILENAME:
+	MazeBench.cpp
+
+PURPOSE:
+	This file measures the recursive solver, SolveMaze, on a corpus of maze files, such as those
+	written by p3's generate.cpp, without any prompts, so that it can be run from a script. For each
+	maze it reports how fast the solver moved through the maze and found its solutions, and how much
+	memory it took to do so, in the same columns as p3's bench.cpp reports for the iterative solver.
+
+INPUT:
+	The options and the names of the maze files are given on the command line:
+		MazeBench [-o outFile] mazeFile...
+	-o writes the solutions to outFile; otherwise they are formatted and thrown away, so that the
+	disk is not measured. Each maze file holds the dimensions of its maze followed by the row # and
+	column # of each wall, as MazeClient.cpp reads them.
+
+PROCESSING:
+	Each maze file is read into a MazeClass object as MazeClient.cpp reads it, and SolveMaze finds
+	every valid path through it. The time taken to load the maze, and the time taken to search it,
+	are measured separately with steady_clock. The replacement operator new and operator delete in
+	this file count every allocation made, and the bytes allocated at once, from which the # of
+	allocations and the peak heap use of each search are found. The peak resident set size of the
+	process, which never goes down, is read with getrusage.
+
+OUTPUT:
+	One line per maze is output to the console, under a line of headings:
+		maze		the name of the maze file
+		rows, cols	the dimensions of the maze
+		solutions	the # of valid paths found
+		nodes		the # of locations the search entered
+		load s		seconds taken to load the maze
+		solve s		seconds taken to search the maze
+		nodes/s		nodes divided by solve seconds
+		sol/s		solutions divided by solve seconds
+		allocs		the # of allocations made by the search
+		heap MB		the most heap memory the search held at once, above what was held before it
+		RSS MB		the peak resident set size of the process so far
+	A maze that cannot be loaded is reported and skipped.
+
+	When built with SEARCH_STATS defined, a JSON summary of what each search did, as described in
+	SearchStats.h, is also output to cerr, one line per maze searched, in the order of the lines
+	above. Its histogram is then counted in allocs and heap MB.
+
+ASSUMPTIONS:
+	(1) The maze files are in the format MazeClient.cpp reads.
+	(2) The paths through each maze are short enough not to overflow the call stack.
+	(3) Peak resident set size is only available where getrusage is; elsewhere 0 is reported.
+
+EXCEPTION HANDLING:
+	(1) OutOfMemoryException
+			Thrown whenever an attempt to dynamically allocate memory for the instantiation of a
+			MazeClass object fails. The maze is reported and skipped.
+	(2) OutOfBoundsException
+			Thrown whenever an attempt to access or modify a MazeRec from a location that's outside the
+			bounds of the maze is made. The maze is reported and skipped.
+*/
+
+// Header Files / Libraries
+#include "MazeClass.h"			// For MazeClass objects
+#include "MazeSolver.h"			// For SolveMaze and SetMazeLoc
+#include "SearchStats.h"		// For SearchStatsRec and SEARCH_STAT
+#include <atomic>				// For atomic
+#include <chrono>				// For steady_clock
+#include <cstdlib>				// For malloc, free, EXIT_SUCCESS and EXIT_FAILURE
+#include <cstring>				// For strcmp
+#include <fstream>				// For file input/output
+#include <iomanip>				// For setw and setprecision
+#include <iostream>				// For standard output
+#include <new>					// For bad_alloc
+#include <string>				// For string datatype
+#ifndef _WIN32
+#include <sys/resource.h>		// For getrusage
+#endif
+using namespace std;
+
+// Prototypes
+double PeakResidentMB();
+	// Returns the peak resident set size of the process, in megabytes.
+void BenchMaze(const string&, ofstream&);
+	// Loads and searches one maze, and outputs a line of measurements for it.
+
+// Constants
+const size_t ALLOCATION_HEADER = 16;			// # of bytes in front of each block, holding its
+												//  size; keeps the block aligned for any type
+const double BYTES_PER_MB = 1024.0 * 1024.0;	// # of bytes in a megabyte
+const int ROW_START = 0;						// 1st row in the maze
+const int COL_START = 0;						// 1st column in the maze
+const int FIRST_SOLUTION = 1;					// First solution #
+
+// Allocation counts, kept by the replacement operator new and operator delete
+static atomic<long long> numAllocations( 0 );	// # of allocations since the last reset
+static atomic<long long> liveBytes( 0 );		// # of bytes allocated and not yet freed
+static atomic<long long> peakBytes( 0 );		// Most bytes allocated at once since the last reset
+
+//******************************************************************************************************
+
+/*
+Purpose:	Allocates size bytes, counting the allocation and the bytes.
+Pre:		None
+Post:		The address of a block of size bytes has been returned. numAllocations and liveBytes have
+			been increased, and peakBytes raised to liveBytes if it was lower.
+*/
+void* operator new( /* In */ size_t size )	// # of bytes to allocate
+{
+	char* block = static_cast<char*>( malloc( size + ALLOCATION_HEADER ) );	// The block and its
+																			//  header
+	long long live;		// # of bytes allocated, counting this block
+	long long peak;		// The peak seen so far
+
+	// If the block could not be allocated
+	if( block == NULL )
+	{
+		throw bad_alloc();
+
+	} // End if
+
+	// Record the size in front of the block, so that operator delete can count it out again
+	*reinterpret_cast<size_t*>( block ) = size;
+
+	numAllocations++;
+	live = liveBytes += (long long)size;
+	peak = peakBytes;
+
+	while( live > peak && !peakBytes.compare_exchange_weak( peak, live ) )
+	{
+	} // End while
+
+	return block + ALLOCATION_HEADER;
+
+} // End operator new( size_t size )
+
+//******************************************************************************************************
+
+/*
+Purpose:	Frees a block allocated by operator new, counting its bytes out.
+Pre:		block is NULL or was returned by operator new and has not been freed.
+Post:		The block has been freed and liveBytes decreased by its size.
+*/
+void operator delete( /* In */ void* block ) noexcept	// The block to free
+{
+	char* start;	// The start of the block's header
+
+	// If there is a block to free
+	if( block != NULL )
+	{
+		start = static_cast<char*>( block ) - ALLOCATION_HEADER;
+		liveBytes -= (long long)*reinterpret_cast<size_t*>( start );
+		free( start );
+
+	} // End if
+
+} // End operator delete( void* block )
+
+//******************************************************************************************************
+
+void* operator new[]( /* In */ size_t size )	// # of bytes to allocate
+{
+	return operator new( size );
+
+} // End operator new[]( size_t size )
+
+void operator delete[]( /* In */ void* block ) noexcept	// The block to free
+{
+	operator delete( block );
+
+} // End operator delete[]( void* block )
+
+void operator delete( /* In */ void* block, /* In */ size_t ) noexcept	// The block to free
+{
+	operator delete( block );
+
+} // End operator delete( void* block, size_t )
+
+void operator delete[]( /* In */ void* block, /* In */ size_t ) noexcept	// The block to free
+{
+	operator delete( block );
+
+} // End operator delete[]( void* block, size_t )
+
+//******************************************************************************************************
+
+int main( /* In */ int argc,		// # of command line arguments
+		  /* In */ char* argv[] )	// The command line arguments
+{
+	// Variables
+	ofstream dout;	// The output file; left unopened to throw the solutions away
+	int arg = 1;	// Index of the current command line argument
+
+	// If an output file was given
+	if( argc > 2 && strcmp( argv[ 1 ], "-o" ) == 0 )
+	{
+		dout.open( argv[ 2 ] );
+		arg = 3;
+
+	} // End if
+
+	// If no maze files were given
+	if( arg == argc )
+	{
+		cout << "Usage: MazeBench [-o outFile] mazeFile..." << endl;
+		return EXIT_FAILURE;
+
+	} // End if
+
+	cout << left << setw( 24 ) << "maze" << right << setw( 7 ) << "rows" << setw( 7 ) << "cols"
+		 << setw( 12 ) << "solutions" << setw( 14 ) << "nodes" << setw( 9 ) << "load s" << setw( 10 )
+		 << "solve s" << setw( 12 ) << "nodes/s" << setw( 12 ) << "sol/s" << setw( 10 ) << "allocs"
+		 << setw( 9 ) << "heap MB" << setw( 9 ) << "RSS MB" << endl;
+
+	// Measure each maze in turn
+	for( ; arg < argc; arg++ )
+	{
+		BenchMaze( argv[ arg ], dout );
+
+	} // End for
+
+	return EXIT_SUCCESS;
+
+} // End main
+
+//******************************************************************************************************
+
+/*
+Purpose:	Returns the peak resident set size of the process, in megabytes.
+Pre:		None
+Post:		The peak resident set size has been returned, or 0 where getrusage is not available.
+*/
+double PeakResidentMB()
+{
+#ifndef _WIN32
+	struct rusage usage;	// Gets the resource usage of the process
+
+	getrusage( RUSAGE_SELF, &usage );
+
+	// ru_maxrss is in kilobytes on Linux, and in bytes on macOS
+#ifdef __APPLE__
+	return usage.ru_maxrss / BYTES_PER_MB;
+#else
+	return usage.ru_maxrss / 1024.0;
+#endif
+#else
+	return 0.0;
+#endif
+
+} // End PeakResidentMB()
+
+//******************************************************************************************************
+
+/*
+Purpose:	Loads and searches one maze, and outputs a line of measurements for it.
+Pre:		dout is open on the output file, or unopened to throw the solutions away.
+Post:		A line of measurements, or the reason the maze could not be measured, has been output to
+			the console. The maze's solutions have been written to dout.
+*/
+void BenchMaze( /* In */	 const string& fileName,	// Name of the maze file
+				/* In/Out */ ofstream&	   dout )		// The output file
+{
+	ifstream din;								// Input file stream variable
+	chrono::steady_clock::time_point start;		// When loading the maze began
+	chrono::steady_clock::time_point loaded;	// When loading the maze ended
+	chrono::steady_clock::time_point solved;	// When searching the maze ended
+	double loadSeconds;							// Seconds taken to load the maze
+	double solveSeconds;						// Seconds taken to search the maze
+	string solution;							// The directions of the path so far
+	int solutionNumber = FIRST_SOLUTION;		// The current solution #
+	long long numNodes = 0;						// # of locations the search entered
+	SearchStatsRec stats;						// What the search did, when built with SEARCH_STATS
+	long long allocations;						// # of allocations made by the search
+	long long heapBytes;						// Most heap bytes the search held at once
+	int numRows;								// # of rows in the maze
+	int numCols;								// # of columns in the maze
+	int row;									// A row # in the maze
+	int col;									// A column # in the maze
+
+	start = chrono::steady_clock::now();
+
+	// Open the maze file and get the # of rows and # of columns
+	din.open( fileName.c_str() );
+	din >> numRows >> numCols;
+
+	// If the maze file could not be opened or does not start with the dimensions of a maze
+	if( !din || numRows <= 0 || numCols <= 0 )
+	{
+		cout << left << setw( 24 ) << fileName << " File not found or not a maze file." << endl;
+		return;
+
+	} // End if
+
+	try
+	{
+		// Instantiate the maze and build the walls listed in the maze file
+		MazeClass maze( numRows, numCols );
+
+		din >> row >> col;
+
+		while( din )
+		{
+			SetMazeLoc( maze, row, col, WALL );
+			din >> row >> col;
+
+		} // End while
+
+		din.close();
+		loaded = chrono::steady_clock::now();
+
+		// Count only what the search allocates
+		numAllocations = 0;
+		peakBytes.store( liveBytes );
+		heapBytes = liveBytes;
+
+		// If the entrance and the exit are not blocked, search the maze the way MazeClient.cpp does
+		if( maze.GetMazeRec( ROW_START, COL_START ).type != WALL &&
+			maze.GetMazeRec( numRows - 1, numCols - 1 ).type != WALL )
+		{
+			solution += "S";
+			row = ROW_START;
+			col = COL_START;
+
+			SEARCH_STAT( StartStats( stats, 0 ) );
+			SolveMaze( maze, solution, dout, solutionNumber, row, col, numNodes, stats );
+			SEARCH_STAT( StopStats( stats ) );
+			SEARCH_STAT( PrintStatsJson( stats, cerr ) );
+
+		} // End if
+
+		solved = chrono::steady_clock::now();
+		allocations = numAllocations;
+		heapBytes = peakBytes - heapBytes;
+
+		loadSeconds = chrono::duration<double>( loaded - start ).count();
+		solveSeconds = chrono::duration<double>( solved - loaded ).count();
+
+		cout << left << setw( 24 ) << fileName << right << setw( 7 ) << numRows << setw( 7 )
+			 << numCols << setw( 12 ) << solutionNumber - FIRST_SOLUTION << setw( 14 ) << numNodes
+			 << fixed << setprecision( 3 ) << setw( 9 ) << loadSeconds << setw( 10 ) << solveSeconds
+			 << setprecision( 0 ) << setw( 12 ) << ( solveSeconds > 0 ? numNodes / solveSeconds : 0.0 )
+			 << setw( 12 ) << ( solveSeconds > 0 ? ( solutionNumber - FIRST_SOLUTION ) / solveSeconds
+			 : 0.0 ) << setw( 10 ) << allocations << setprecision( 1 ) << setw( 9 )
+			 << heapBytes / BYTES_PER_MB << setw( 9 ) << PeakResidentMB() << endl;
+
+	} // End try
+	catch( OutOfBoundsException e )	// Failed attempt to access or modify a MazeRec outside the bounds
+									//  of the maze
+	{
+		cout << left << setw( 24 ) << fileName << ' ' << e.GetMessage() << endl;
+
+	} // End catch
+	catch( OutOfMemoryException e )	// Could not dynamically allocate memory
+	{
+		cout << left << setw( 24 ) << fileName << ' ' << e.GetMessage() << endl;
+
+	} // End catch
+
+} // End BenchMaze( const string& fileName, ofstream& dout )
\ No newline at end of file
@@ -29,11 +29,12 @@ PROCESSING:
 	program attempts to open the file. If successful, the dimensions of the maze are read from the file.
 	A MazeClass object gets instantiated with these dimensions. Next, the locations of walls in the
 	maze, if there are any, are read from the file, building the walls of the maze as they are read,
-	until the end of the file is reached. Then the program uses recursion to search through the maze to
-	find all valid paths through the maze, starting at the entrance to the maze (0, 0). For each move to
-	a new location within the maze, a character ('N', 'S', 'E', or 'W') representing the direction moved
-	is concatenated onto a string in order to keep track of the path through the maze. In each recursive
-	call, if the exit from the maze is reached (the base case), the path (represented by NORTH, SOUTH,
+	until the end of the file is reached. Then the program uses recursion, through the functions in
+	MazeSolver.cpp, to search through the maze to find all valid paths through the maze, starting at the
+	entrance to the maze (0, 0). For each move to a new location within the maze, a character ('N',
+	'S', 'E', or 'W') representing the direction moved is concatenated onto a string in order to keep
+	track of the path through the maze. In each recursive call, if the exit from the maze is reached
+	(the base case), the path (represented by NORTH, SOUTH,
 	EAST, and/or WEST moves) is printed to the output file (OUT_FILE_NAME) and the solution backtracks
 	to the previous location. If the exit from the maze was not reached, another call to the recursive
 	function is made from the current location in the maze to an adjacent location within the maze,
@@ -56,6 +57,10 @@ OUTPUT:
 	was found. Otherwise, if either the entrance to the maze or the exit from the maze are blocked, a
 	statement stating so is written to the file.
 
+	When built with SEARCH_STATS defined, the counts of what the search is doing are printed to cerr
+	every REPORT_SECONDS seconds while it runs, and a JSON summary of them, with a histogram of the
+	depths the search reached, is printed to cerr once it stops. See SearchStats.h.
+
 ASSUMPTIONS:
 	(1)	The input file will contain the dimensions of the maze
 	(2)	The data in the input file will be in the correct format
@@ -78,28 +83,19 @@ EXCEPTION HANDLING:
 
 // Header Files / Libraries
 #include "MazeClass.h"			// For MazeClass objects
+#include "MazeSolver.h"			// For SolveMaze and SetMazeLoc
+#include "SearchStats.h"		// For SearchStatsRec and SEARCH_STAT
 #include <iostream>				// For standard input/output
 #include <string>				// For string datatype
 #include <fstream>				// For file input/output
 using namespace std;
 
-// Prototypes
-void SolveMaze(MazeClass&, string&, ofstream&, int&, int&, int&);
-	// Finds every path through the maze from the location (row, col) in the maze to the exit from the
-	//  maze. Each path is printed to an output file.
-void SetMazeLoc(MazeClass&, const int, const int, const MazeLocEnum);
-	// Marks the MazeRec at location (row, col) in the maze as either WALL, UNVISITED, or VISITED.
-bool TryMove(MazeClass&, char, string&, int&, int&);
-	// Attempts to move in a specified direction in the maze, modifying the row and column #s and the
-	//  string representing the path through the maze appropriately.
-void BackTrack(MazeClass&, string&, int&, int&);
-	// Moves to the previous location in the maze, modifying the row and column #s and the string
-	//  representing the path through the maze appropriately.
-
 // Constants
 const char OUT_FILE_NAME[] = "solution.out";	// Output file name
 const int MIN_FILENAME_LENGTH = 5;				// Min length of input file name
 const int FIRST_SOLUTION = 1;					// First solution #
+const double REPORT_SECONDS = 10;				// # of seconds between progress reports, when built
+												//  with SEARCH_STATS
 const int ROW_START = 0;						// 1st row in the maze
 const int COL_START = 0;						// 1st column int he maze
 
@@ -118,6 +114,8 @@ void main()
 	int numRows;							// Max # of rows in the maze
 	int numCols;							// Max # of columns in the maze
 	int solutionNumber = FIRST_SOLUTION;	// The current solution #
+	long long numNodes = 0;					// # of locations the search has entered
+	SearchStatsRec stats;					// What the search has done, when built with SEARCH_STATS
 
 	//**************************************************************************************************
 	// Prompt for and get input file name, validate input file name, open input file
@@ -297,7 +295,12 @@ void main()
 				col = COL_START;
 				
 				// Find and print all paths through the maze to the output file
-				SolveMaze( maze, solution, dout, solutionNumber, row, col );
+				SEARCH_STAT( StartStats( stats, REPORT_SECONDS ) );
+				SolveMaze( maze, solution, dout, solutionNumber, row, col, numNodes, stats );
+
+				// Print what the search did, when built to count it
+				SEARCH_STAT( StopStats( stats ) );
+				SEARCH_STAT( PrintStatsJson( stats, cerr ) );
 
 			} // End if
 			// Else the exit from the maze is blocked by a wall
@@ -335,346 +338,4 @@ void main()
 
 	} // End catch
 
-} // End main
-
-//******************************************************************************************************
-
-/* 
-Purpose:	Finds every path through the maze from the location (row, col) in the maze to the exit from
-			the maze. Each path is printed to an output file.
-Pre:		maze has been instantiated. The values of the characters in solution represent the path
-			taken from the entrance to the maze to the location (row, col) in the maze. dout has been
-			associated with the output file. solutionNumber contains the current solution number.
-			(row, col) is a location within the bounds of the maze.
-Post:		Each path through the maze from the location (row, col) in the maze to the exit from the
-			maze has been found and printed to the output file.
-*/
-void SolveMaze( /* In/Out */ MazeClass& maze,			// The maze
-				/* In/Out */ string&	solution,		// The string representing the path through the maze
-				/* In/Out */ ofstream&	dout,			// The output file stream variable
-				/* In/Out */ int&		solutionNumber,	// The current solution number
-				/* In */	 int&		row,			// The row # of a location in the maze
-				/* In */	 int&		col)			// The column # of a location in the maze
-{
-	// If the current location in the maze is the exit from the maze
-	if( row == maze.GetNumRows() - 1 &&
-		col == maze.GetNumCols() - 1 )
-	{
-		char* print = &solution[ 0 ];	// Points to a character that represents a direction taken in
-										//  the maze
-
-		// Concatenate an 'S' to the string representing the path through the maze, indicating a
-		//  southward movement out of the maze
-		solution += "S";
-
-		dout << "Solution #" << solutionNumber << ":" << endl;
-
-		// For each character in the string representing the path through the maze
-		for( int i = 0; i < solution.length(); i++ )
-		{
-			// Branch depending on what the character being pointed to is
-			switch( *print )
-			{
-				case 'N' : dout << "NORTH"; break;
-
-				case 'S' : dout << "SOUTH"; break;
-
-				case 'E' : dout << "EAST"; break;
-
-				case 'W' : dout << "WEST"; break;
-
-			} // End switch
-
-			// If not on the last iteration of the loop
-			if( i != solution.length() - 1 )
-			{
-				dout << ", ";
-
-				// Point to the next character in the string representing the path through the maze
-				print++;
-
-			} // End if
-			// Else on the last iteration of the loop
-			else
-			{
-				dout << endl << endl;
-
-			} // End else
-
-		} // End for
-
-		// Increment the solution # by one
-		solutionNumber++;
-
-		// Erase the last character from the string representing the path through the maze
-		solution.erase( solution.length() - 1 );
-
-		// Backtrack to the previous position in the maze
-		BackTrack( maze, solution, row, col );
-
-		// Return to the calling function
-		return;
-
-	} // End if
-
-	// If able to move to an adjacent location in the maze east of the current location in the maze
-	if( TryMove( maze, 'E', solution, row, col ) )
-	{
-		// Find all paths in the maze from the adjacent location to the east of the current location and
-		//  print them to the output file
-		SolveMaze( maze, solution, dout, solutionNumber, row, col );
-
-	} // End if
-
-	// If able to move to an adjacent location in the maze south of the current location in the maze
-	if( TryMove( maze, 'S', solution, row, col ) )
-	{
-		// Find all paths in the maze from the adjacent location to the south of the current location
-		//  and print them to the output file
-		SolveMaze( maze, solution, dout, solutionNumber, row, col );
-
-	} // End if
-
-	// If able to move to an adjacent location in the maze west of the current location in the maze
-	if( TryMove( maze, 'W', solution, row, col ) )
-	{
-		// Find all paths in the maze from the adjacent location to the west of the current location and
-		//  print them to the output file
-		SolveMaze( maze, solution, dout, solutionNumber, row, col );
-
-	} // End if
-
-	// If able to move to an adjacent location in the maze north of the current location in the maze
-	if( TryMove( maze, 'N', solution, row, col ) )
-	{
-		// Find all paths in the maze from the adjacent location to the north of the current location
-		//  and print them to the output file
-		SolveMaze( maze, solution, dout, solutionNumber, row, col );
-
-	} // End if
-
-	// Backtrack to the previous position in the maze
-	BackTrack( maze, solution, row, col );
-
-} // End SolveMaze( MazeClass& maze, string& solution, ofstream& dout, int& solutionNumber, int row,
-  //  int col)
-
-//******************************************************************************************************
-
-/* 
-Purpose:	Marks the MazeRec at location (row, col) in the maze as either WALL, UNVISITED, or VISITED.
-Pre:		maze has been instantiated. (row, col) is a location within the bounds of the maze. newType
-			has been assigned a value.
-Post:		The MazeRec at location (row, col) in the maze has been marked with the value of newType.
-*/
-void SetMazeLoc( /* In/Out */		MazeClass&  maze,		// The maze
-				 /* In */	  const int			row,		// The row # of a location in the maze
-				 /* In */	  const int			col,		// The column # of a location in the maze
-				 /* In */	  const MazeLocEnum newType )	// The value to mark the MazeRec at location
-															//  (row, col) in the maze with
-{
-	MazeRec mazeItem;	// Gets the data to set the MazeRec at location (row, col) in the maze to
-	
-	// Assign the type field of the MazeRec to newType
-	mazeItem.type = newType;
-
-	try
-	{
-		// Assign the MazeRec at location (row, col) in the maze to newItem
-		maze.SetMazeRec( row, col, mazeItem );
-
-	} // End try
-	catch( OutOfBoundsException e )	// Failed attempt to modify a MazeRec outside the bounds of the maze
-	{
-		cout << e.GetMessage() << endl;
-
-	} // End catch
-
-} // End SetMazeLoc( MazeClass& maze, const int row, const int col, const MazeLocEnum newType )
-
-//******************************************************************************************************
-
-/* 
-Purpose:	Attempts to move in a specified direction in the maze, modifying the row and column #s and
-			the string representing the path through the maze appropriately.
-Pre:		maze has been instantiated. The value of direction is 'N', 'S', 'E', or 'W'. solution has
-			been declared. (row, col) is a location within the bounds of the maze.
-Post:		If the move was successful, true has been returned and the value of the last character in
-			solution represents the direction of the move taken and row or col has been updated to
-			reflect the direction taken. Otherwise, false has been returned and the values of the
-			parameters have not been changed.
-*/
-bool TryMove( /* In */	   MazeClass& maze,			// The maze
-			  /* In */	   char		  direction,	// A character representing the direction to move
-			  /* In/Out */ string&    solution,		// The string representing the path through the maze
-			  /* In/Out */ int&		  row,			// The row # of a location in the maze
-			  /* In/Out */ int&		  col )			// The column # of a location in the maze
-{
-	// Branch depending on the value of the character representing a direction
-	switch( direction )
-	{
-		case 'N' :
-		{
-			// If location directly to the north of location (row, col) in the maze is within the bounds
-			//  of the maze and marked as UNVISITED
-			if( maze.InBounds( row - 1, col ) && maze.GetMazeRec( row - 1, col ).type == UNVISITED )
-			{
-				// Mark location (row, col) in the maze as VISITED
-				SetMazeLoc( maze, row, col, VISITED );
-
-				// Decrement the row # by one
-				row--;
-
-				// Concatenate an 'N' to the string representing the path through the maze, indicating a
-				//  northward movement in the maze
-				solution += "N";
-
-				return true;
-
-			} // End if
-			// Else location directly to the north of location (row, col) in the maze is either not
-			//  within the bounds of the maze or is not marked as UNVISITED
-			else
-			{
-				return false;
-
-			} // End else
-
-		} // End case
-
-		case 'S' :
-		{
-			// If location directly to the south of location (row, col) in the maze is in the bounds of
-			//  the maze and marked as UNVISITED
-			if( maze.InBounds( row + 1, col ) && maze.GetMazeRec( row + 1, col ).type == UNVISITED )
-			{
-				// Mark location (row, col) in the maze as VISITED
-				SetMazeLoc( maze, row, col, VISITED );
-
-				// Increment the row # by one
-				row++;
-
-				// Concatenate an 'S' to the string representing the path through the maze, indicating a
-				//  southward movement in the maze
-				solution += "S";
-
-				return true;
-
-			} // End if
-			// Else location directly to the south of location (row, col) in the maze is either not
-			//  within the bounds of the maze or is not marked as UNVISITED
-			else
-			{
-				return false;
-
-			} // End else
-
-		} // End case
-
-		case 'E' :
-		{
-			// If location directly to the east of location (row, col) in the maze is in the bounds of
-			//  the maze and marked as UNVISITED
-			if( maze.InBounds( row, col + 1 ) && maze.GetMazeRec( row, col + 1 ).type == UNVISITED )
-			{
-				// Mark location (row, col) in the maze as VISITED
-				SetMazeLoc( maze, row, col, VISITED );
-
-				// Increment the column # by one
-				col++;
-
-				// Concatenate an 'E' to the string representing the path through the maze, indicating a
-				//  eastward movement in the maze
-				solution += "E";
-
-				return true;
-
-			} // End if
-			// Else location directly to the east of location (row, col) in the maze is either not
-			//  within the bounds of the maze or is not marked as UNVISITED
-			else
-			{
-				return false;
-
-			} // End else
-
-		} // End case
-
-		case 'W' :
-		{
-			// If location directly to the west of location (row, col) in the maze is in the bounds of
-			//  the maze and marked as UNVISITED
-			if( maze.InBounds( row, col - 1 ) && maze.GetMazeRec( row, col - 1 ).type == UNVISITED )
-			{
-				// Mark location (row, col) in the maze as VISITED
-				SetMazeLoc( maze, row, col, VISITED );
-
-				// Decrement the column # by one
-				col--;
-
-				// Concatenate an 'W' to the string representing the path through the maze, indicating a
-				//  westward movement in the maze
-				solution += "W";
-
-				return true;
-
-			} // End if
-			// Else location directly to the west of location (row, col) in the maze is either not
-			//  within the bounds of the maze or is not marked as UNVISITED
-			else
-			{
-				return false;
-
-			} // End else
-
-		} // End case
-
-	} // End switch
-
-} // End TryMove( MazeClass maze, char direction, string& solution, int& row, int& col )
-
-//******************************************************************************************************
-
-/* 
-Purpose:	Moves to the previous location in the maze, modifying the row and column #s and the string
-			representing the path through the maze appropriately.
-Pre:		maze has been instantiated. solution's length is >= 1. (row, col) is a location within the
-			bounds of the maze.
-Post:		The last character in solution has been removed. (row, col) now represents the previous
-			location in the maze.
-*/
-void BackTrack( /* In/Out */ MazeClass& maze,		// The maze
-				/* In/Out */ string&	solution,	// The string representing the path through the maze
-				/* In/Out */ int&		row,		// The row # of a location in the maze
-				/* In/Out */ int&		col )		// The column # of a location in the maze
-{
-	try
-	{
-		// Mark location (row, col) in the maze as UNVISITED
-		SetMazeLoc( maze, row, col, UNVISITED );
-
-		// Branch depending on the value of the last character in the string representing the path
-		//  through the maze
-		switch( solution[ solution.length() - 1 ] )
-		{
-			case 'N' : row++; break;
-
-			case 'S' : row--; break;
-
-			case 'E' : col--; break;
-
-			case 'W' : col++; break;
-
-		} // End switch
-
-		// Erase the last character from the string representing the path through the maze
-		solution.erase( solution.length() - 1 );
-
-	} // End try
-	catch( OutOfBoundsException e )	// Failed attempt to modify a MazeRec outside the bounds of the maze
-	{
-		cout << e.GetMessage() << endl;
-
-	} // End catch
-
-} // End BackTrack( MazeClass& maze, string& solution, int& row, int& col )
\ No newline at end of file
+} // End main
\ No newline at end of file
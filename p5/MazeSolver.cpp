@@ -0,0 +1,371 @@
+/*
+AUTHOR:
+	Chris Pray
+
+DATE:
+	10/19/26
+
+FILENAME:
+	MazeSolver.cpp
+
+PURPOSE:
+	This file contains the implementation for all of the functions declared in MazeSolver.h
+*/
+
+#include "MazeSolver.h"		// For function declarations
+#include <iostream>			// For standard output
+
+/* 
+Purpose:	Finds every path through the maze from the location (row, col) in the maze to the exit from
+			the maze. Each path is printed to an output file.
+Pre:		maze has been instantiated. The values of the characters in solution represent the path
+			taken from the entrance to the maze to the location (row, col) in the maze. dout has been
+			associated with the output file. solutionNumber contains the current solution number.
+			(row, col) is a location within the bounds of the maze. numNodes contains the # of
+			locations entered so far. When built with SEARCH_STATS, StartStats has been called on
+			stats.
+Post:		Each path through the maze from the location (row, col) in the maze to the exit from the
+			maze has been found and printed to the output file. numNodes has been increased by the #
+			of locations entered, counting (row, col). When built with SEARCH_STATS, the locations
+			entered, the backtracks and the solutions found have been recorded in stats.
+*/
+void SolveMaze( /* In/Out */ MazeClass& maze,			// The maze
+				/* In/Out */ string&	solution,		// The string representing the path through the maze
+				/* In/Out */ ofstream&	dout,			// The output file stream variable
+				/* In/Out */ int&		solutionNumber,	// The current solution number
+				/* In */	 int&		row,			// The row # of a location in the maze
+				/* In */	 int&		col,			// The column # of a location in the maze
+				/* In/Out */ long long& numNodes,		// The # of locations entered so far
+				/* In/Out */ SearchStatsRec& stats)	// What the search has done so far
+{
+	// Count the location just entered
+	numNodes++;
+	SEARCH_STAT( CountNode( stats, solution.length() ) );
+
+	// If the current location in the maze is the exit from the maze
+	if( row == maze.GetNumRows() - 1 &&
+		col == maze.GetNumCols() - 1 )
+	{
+		char* print;	// Points to a character that represents a direction taken in the maze
+
+		// Concatenate an 'S' to the string representing the path through the maze, indicating a
+		//  southward movement out of the maze
+		solution += "S";
+
+		// Point to the first direction only now, since the concatenation may have moved the string
+		print = &solution[ 0 ];
+
+		dout << "Solution #" << solutionNumber << ":" << endl;
+
+		// For each character in the string representing the path through the maze
+		for( int i = 0; i < solution.length(); i++ )
+		{
+			// Branch depending on what the character being pointed to is
+			switch( *print )
+			{
+				case 'N' : dout << "NORTH"; break;
+
+				case 'S' : dout << "SOUTH"; break;
+
+				case 'E' : dout << "EAST"; break;
+
+				case 'W' : dout << "WEST"; break;
+
+			} // End switch
+
+			// If not on the last iteration of the loop
+			if( i != solution.length() - 1 )
+			{
+				dout << ", ";
+
+				// Point to the next character in the string representing the path through the maze
+				print++;
+
+			} // End if
+			// Else on the last iteration of the loop
+			else
+			{
+				dout << endl << endl;
+
+			} // End else
+
+		} // End for
+
+		// Increment the solution # by one
+		solutionNumber++;
+		SEARCH_STAT( CountSolution( stats ) );
+
+		// Erase the last character from the string representing the path through the maze
+		solution.erase( solution.length() - 1 );
+
+		// Backtrack to the previous position in the maze
+		BackTrack( maze, solution, row, col );
+		SEARCH_STAT( CountBacktrack( stats ) );
+
+		// Return to the calling function
+		return;
+
+	} // End if
+
+	// If able to move to an adjacent location in the maze east of the current location in the maze
+	if( TryMove( maze, 'E', solution, row, col ) )
+	{
+		// Find all paths in the maze from the adjacent location to the east of the current location and
+		//  print them to the output file
+		SolveMaze( maze, solution, dout, solutionNumber, row, col, numNodes, stats );
+
+	} // End if
+
+	// If able to move to an adjacent location in the maze south of the current location in the maze
+	if( TryMove( maze, 'S', solution, row, col ) )
+	{
+		// Find all paths in the maze from the adjacent location to the south of the current location
+		//  and print them to the output file
+		SolveMaze( maze, solution, dout, solutionNumber, row, col, numNodes, stats );
+
+	} // End if
+
+	// If able to move to an adjacent location in the maze west of the current location in the maze
+	if( TryMove( maze, 'W', solution, row, col ) )
+	{
+		// Find all paths in the maze from the adjacent location to the west of the current location and
+		//  print them to the output file
+		SolveMaze( maze, solution, dout, solutionNumber, row, col, numNodes, stats );
+
+	} // End if
+
+	// If able to move to an adjacent location in the maze north of the current location in the maze
+	if( TryMove( maze, 'N', solution, row, col ) )
+	{
+		// Find all paths in the maze from the adjacent location to the north of the current location
+		//  and print them to the output file
+		SolveMaze( maze, solution, dout, solutionNumber, row, col, numNodes, stats );
+
+	} // End if
+
+	// Backtrack to the previous position in the maze
+	BackTrack( maze, solution, row, col );
+	SEARCH_STAT( CountBacktrack( stats ) );
+
+} // End SolveMaze( MazeClass& maze, string& solution, ofstream& dout, int& solutionNumber, int row,
+  //  int col, long long& numNodes, SearchStatsRec& stats)
+
+//******************************************************************************************************
+
+/* 
+Purpose:	Marks the MazeRec at location (row, col) in the maze as either WALL, UNVISITED, or VISITED.
+Pre:		maze has been instantiated. (row, col) is a location within the bounds of the maze. newType
+			has been assigned a value.
+Post:		The MazeRec at location (row, col) in the maze has been marked with the value of newType.
+*/
+void SetMazeLoc( /* In/Out */		MazeClass&  maze,		// The maze
+				 /* In */	  const int			row,		// The row # of a location in the maze
+				 /* In */	  const int			col,		// The column # of a location in the maze
+				 /* In */	  const MazeLocEnum newType )	// The value to mark the MazeRec at location
+															//  (row, col) in the maze with
+{
+	MazeRec mazeItem;	// Gets the data to set the MazeRec at location (row, col) in the maze to
+	
+	// Assign the type field of the MazeRec to newType
+	mazeItem.type = newType;
+
+	try
+	{
+		// Assign the MazeRec at location (row, col) in the maze to newItem
+		maze.SetMazeRec( row, col, mazeItem );
+
+	} // End try
+	catch( OutOfBoundsException e )	// Failed attempt to modify a MazeRec outside the bounds of the maze
+	{
+		cout << e.GetMessage() << endl;
+
+	} // End catch
+
+} // End SetMazeLoc( MazeClass& maze, const int row, const int col, const MazeLocEnum newType )
+
+//******************************************************************************************************
+
+/* 
+Purpose:	Attempts to move in a specified direction in the maze, modifying the row and column #s and
+			the string representing the path through the maze appropriately.
+Pre:		maze has been instantiated. The value of direction is 'N', 'S', 'E', or 'W'. solution has
+			been declared. (row, col) is a location within the bounds of the maze.
+Post:		If the move was successful, true has been returned and the value of the last character in
+			solution represents the direction of the move taken and row or col has been updated to
+			reflect the direction taken. Otherwise, false has been returned and the values of the
+			parameters have not been changed.
+*/
+bool TryMove( /* In */	   MazeClass& maze,			// The maze
+			  /* In */	   char		  direction,	// A character representing the direction to move
+			  /* In/Out */ string&    solution,		// The string representing the path through the maze
+			  /* In/Out */ int&		  row,			// The row # of a location in the maze
+			  /* In/Out */ int&		  col )			// The column # of a location in the maze
+{
+	// Branch depending on the value of the character representing a direction
+	switch( direction )
+	{
+		case 'N' :
+		{
+			// If location directly to the north of location (row, col) in the maze is within the bounds
+			//  of the maze and marked as UNVISITED
+			if( maze.InBounds( row - 1, col ) && maze.GetMazeRec( row - 1, col ).type == UNVISITED )
+			{
+				// Mark location (row, col) in the maze as VISITED
+				SetMazeLoc( maze, row, col, VISITED );
+
+				// Decrement the row # by one
+				row--;
+
+				// Concatenate an 'N' to the string representing the path through the maze, indicating a
+				//  northward movement in the maze
+				solution += "N";
+
+				return true;
+
+			} // End if
+			// Else location directly to the north of location (row, col) in the maze is either not
+			//  within the bounds of the maze or is not marked as UNVISITED
+			else
+			{
+				return false;
+
+			} // End else
+
+		} // End case
+
+		case 'S' :
+		{
+			// If location directly to the south of location (row, col) in the maze is in the bounds of
+			//  the maze and marked as UNVISITED
+			if( maze.InBounds( row + 1, col ) && maze.GetMazeRec( row + 1, col ).type == UNVISITED )
+			{
+				// Mark location (row, col) in the maze as VISITED
+				SetMazeLoc( maze, row, col, VISITED );
+
+				// Increment the row # by one
+				row++;
+
+				// Concatenate an 'S' to the string representing the path through the maze, indicating a
+				//  southward movement in the maze
+				solution += "S";
+
+				return true;
+
+			} // End if
+			// Else location directly to the south of location (row, col) in the maze is either not
+			//  within the bounds of the maze or is not marked as UNVISITED
+			else
+			{
+				return false;
+
+			} // End else
+
+		} // End case
+
+		case 'E' :
+		{
+			// If location directly to the east of location (row, col) in the maze is in the bounds of
+			//  the maze and marked as UNVISITED
+			if( maze.InBounds( row, col + 1 ) && maze.GetMazeRec( row, col + 1 ).type == UNVISITED )
+			{
+				// Mark location (row, col) in the maze as VISITED
+				SetMazeLoc( maze, row, col, VISITED );
+
+				// Increment the column # by one
+				col++;
+
+				// Concatenate an 'E' to the string representing the path through the maze, indicating a
+				//  eastward movement in the maze
+				solution += "E";
+
+				return true;
+
+			} // End if
+			// Else location directly to the east of location (row, col) in the maze is either not
+			//  within the bounds of the maze or is not marked as UNVISITED
+			else
+			{
+				return false;
+
+			} // End else
+
+		} // End case
+
+		case 'W' :
+		{
+			// If location directly to the west of location (row, col) in the maze is in the bounds of
+			//  the maze and marked as UNVISITED
+			if( maze.InBounds( row, col - 1 ) && maze.GetMazeRec( row, col - 1 ).type == UNVISITED )
+			{
+				// Mark location (row, col) in the maze as VISITED
+				SetMazeLoc( maze, row, col, VISITED );
+
+				// Decrement the column # by one
+				col--;
+
+				// Concatenate an 'W' to the string representing the path through the maze, indicating a
+				//  westward movement in the maze
+				solution += "W";
+
+				return true;
+
+			} // End if
+			// Else location directly to the west of location (row, col) in the maze is either not
+			//  within the bounds of the maze or is not marked as UNVISITED
+			else
+			{
+				return false;
+
+			} // End else
+
+		} // End case
+
+	} // End switch
+
+} // End TryMove( MazeClass maze, char direction, string& solution, int& row, int& col )
+
+//******************************************************************************************************
+
+/* 
+Purpose:	Moves to the previous location in the maze, modifying the row and column #s and the string
+			representing the path through the maze appropriately.
+Pre:		maze has been instantiated. solution's length is >= 1. (row, col) is a location within the
+			bounds of the maze.
+Post:		The last character in solution has been removed. (row, col) now represents the previous
+			location in the maze.
+*/
+void BackTrack( /* In/Out */ MazeClass& maze,		// The maze
+				/* In/Out */ string&	solution,	// The string representing the path through the maze
+				/* In/Out */ int&		row,		// The row # of a location in the maze
+				/* In/Out */ int&		col )		// The column # of a location in the maze
+{
+	try
+	{
+		// Mark location (row, col) in the maze as UNVISITED
+		SetMazeLoc( maze, row, col, UNVISITED );
+
+		// Branch depending on the value of the last character in the string representing the path
+		//  through the maze
+		switch( solution[ solution.length() - 1 ] )
+		{
+			case 'N' : row++; break;
+
+			case 'S' : row--; break;
+
+			case 'E' : col--; break;
+
+			case 'W' : col++; break;
+
+		} // End switch
+
+		// Erase the last character from the string representing the path through the maze
+		solution.erase( solution.length() - 1 );
+
+	} // End try
+	catch( OutOfBoundsException e )	// Failed attempt to modify a MazeRec outside the bounds of the maze
+	{
+		cout << e.GetMessage() << endl;
+
+	} // End catch
+
+} // End BackTrack( MazeClass& maze, string& solution, int& row, int& col )
\ No newline at end of file
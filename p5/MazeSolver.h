@@ -0,0 +1,67 @@
+/*
+AUTHOR:
+	Chris Pray
+
+DATE:
+	10/19/26
+
+FILENAME:
+	MazeSolver.h
+
+PURPOSE:
+	This file contains the prototypes for the functions that find every valid path through a MazeClass
+	object by recursion, from the entrance at (0, 0) to the exit at (numRows - 1, numCols - 1), and
+	print each to an output file. They are kept apart from MazeClient.cpp so that MazeBench.cpp can
+	measure the same search.
+
+	From each location, adjacent locations within the maze are tried in the order EAST, SOUTH, WEST,
+	and then NORTH. The path so far is kept as a string of 'N', 'S', 'E', and 'W' characters, and each
+	location on it is marked VISITED in the maze until the search backtracks out of it. SolveMaze
+	counts the locations it enters, so that the work of a search can be measured, and when built with
+	SEARCH_STATS defined it also records what it does in a SearchStatsRec; see SearchStats.h.
+
+ASSUMPTIONS:
+	(1) The maze is small enough that a path through it does not overflow the call stack, since
+		SolveMaze recurses once per location on the path.
+
+SUMMARY OF FUNCTIONS:
+
+	void SolveMaze(MazeClass&, string&, ofstream&, int&, int&, int&, long long&, SearchStatsRec&)
+		Finds every path through the maze from the location (row, col) in the maze to the exit from the
+		maze. Each path is printed to an output file.
+
+	void SetMazeLoc(MazeClass&, const int, const int, const MazeLocEnum)
+		Marks the MazeRec at location (row, col) in the maze as either WALL, UNVISITED, or VISITED.
+
+	bool TryMove(MazeClass&, char, string&, int&, int&)
+		Attempts to move in a specified direction in the maze, modifying the row and column #s and the
+		string representing the path through the maze appropriately.
+
+	void BackTrack(MazeClass&, string&, int&, int&)
+		Moves to the previous location in the maze, modifying the row and column #s and the string
+		representing the path through the maze appropriately.
+*/
+
+#ifndef MazeSolver_h
+#define MazeSolver_h
+
+#include "MazeClass.h"			// For MazeClass objects
+#include "SearchStats.h"		// For SearchStatsRec
+#include <string>				// For string datatype
+#include <fstream>				// For file output
+using namespace std;
+
+// Prototypes
+void SolveMaze(MazeClass&, string&, ofstream&, int&, int&, int&, long long&, SearchStatsRec&);
+	// Finds every path through the maze from the location (row, col) in the maze to the exit from the
+	//  maze. Each path is printed to an output file.
+void SetMazeLoc(MazeClass&, const int, const int, const MazeLocEnum);
+	// Marks the MazeRec at location (row, col) in the maze as either WALL, UNVISITED, or VISITED.
+bool TryMove(MazeClass&, char, string&, int&, int&);
+	// Attempts to move in a specified direction in the maze, modifying the row and column #s and the
+	//  string representing the path through the maze appropriately.
+void BackTrack(MazeClass&, string&, int&, int&);
+	// Moves to the previous location in the maze, modifying the row and column #s and the string
+	//  representing the path through the maze appropriately.
+
+#endif
\ No newline at end of file
@@ -0,0 +1,163 @@
+/*
+AUTHOR:
+	Chris Pray
+
+DATE:
+	10/19/26
+
+FILENAME:
+	SearchStats.cpp
+
+PURPOSE:
+	This file contains the implementation for all of the functions declared in SearchStats.h
+*/
+
+#include "SearchStats.h"		// For function declarations
+#include <iostream>				// For cerr
+
+/*
+Purpose:	Returns the # of seconds since the search began.
+Pre:		StartStats has been called on stats.
+Post:		The # of seconds has been returned.
+*/
+static double SecondsSince( /* In */ const SearchStatsRec& stats )	// The counts of the search
+{
+	return chrono::duration<double>( chrono::steady_clock::now() - stats.startTime ).count();
+
+} // End SecondsSince( const SearchStatsRec& stats )
+
+//******************************************************************************************************
+
+/*
+Purpose:	Sets every count to 0 and notes the time, for a search that prints its counts every
+			reportSeconds seconds.
+Pre:		None
+Post:		Every count of stats is 0, its histogram is empty and the time has been noted. If
+			reportSeconds is not positive, no counts will be printed while the search runs.
+*/
+void StartStats( /* Out */		SearchStatsRec& stats,			// The counts of the search
+				 /* In */ const double			reportSeconds )	// # of seconds between reports
+{
+	stats.expanded = 0;
+	stats.backtracks = 0;
+	stats.solutions = 0;
+	stats.pruned = 0;
+	stats.maxDepth = 0;
+	stats.depths.clear();
+	stats.startTime = chrono::steady_clock::now();
+	stats.reportSeconds = reportSeconds > 0 ? reportSeconds : 0;
+	stats.nextReport = stats.reportSeconds;
+	stats.seconds = 0;
+
+} // End StartStats( SearchStatsRec& stats, const double reportSeconds )
+
+//******************************************************************************************************
+
+/*
+Purpose:	Records a location entered at depth, and prints the counts to cerr if it is time to.
+Pre:		StartStats has been called on stats. depth >= 0.
+Post:		The # of locations entered, the histogram at depth and, if depth is greater, the greatest
+			depth have been updated. If reports are wanted, this is the STATS_CHECK_NODES-th location
+			since the last look at the clock and the time for the next report has come, the counts
+			have been printed to cerr.
+*/
+void CountNode( /* In/Out */	   SearchStatsRec& stats,	// The counts of the search
+				/* In */	 const int			   depth )	// Depth of the location entered
+{
+	stats.expanded++;
+
+	if( depth > stats.maxDepth )
+	{
+		stats.maxDepth = depth;
+
+	} // End if
+
+	// Grow the histogram to reach depth, if it does not yet
+	if( size_t( depth ) >= stats.depths.size() )
+	{
+		stats.depths.resize( depth + 1, 0 );
+
+	} // End if
+
+	stats.depths[ depth ]++;
+
+	// If reports are wanted, look at the clock only every so often, and print the counts if it is time
+	if( stats.reportSeconds > 0 && stats.expanded % STATS_CHECK_NODES == 0 &&
+		SecondsSince( stats ) >= stats.nextReport )
+	{
+		cerr << "[stats] " << SecondsSince( stats ) << " s: " << stats.expanded << " expanded, "
+			 << stats.backtracks << " backtracks, " << stats.solutions << " solutions, "
+			 << stats.pruned << " pruned, max depth " << stats.maxDepth << endl;
+
+		stats.nextReport = SecondsSince( stats ) + stats.reportSeconds;
+
+	} // End if
+
+} // End CountNode( SearchStatsRec& stats, const int depth )
+
+//******************************************************************************************************
+
+/*
+Purpose:	Records a backtrack out of a location.
+Pre:		StartStats has been called on stats.
+Post:		The # of backtracks has been increased by one.
+*/
+void CountBacktrack( /* In/Out */ SearchStatsRec& stats )	// The counts of the search
+{
+	stats.backtracks++;
+
+} // End CountBacktrack( SearchStatsRec& stats )
+
+//******************************************************************************************************
+
+/*
+Purpose:	Records a solution found.
+Pre:		StartStats has been called on stats.
+Post:		The # of solutions has been increased by one.
+*/
+void CountSolution( /* In/Out */ SearchStatsRec& stats )	// The counts of the search
+{
+	stats.solutions++;
+
+} // End CountSolution( SearchStatsRec& stats )
+
+//******************************************************************************************************
+
+/*
+Purpose:	Notes how long the search ran.
+Pre:		StartStats has been called on stats.
+Post:		stats holds the # of seconds since StartStats was called.
+*/
+void StopStats( /* In/Out */ SearchStatsRec& stats )	// The counts of the search
+{
+	stats.seconds = SecondsSince( stats );
+
+} // End StopStats( SearchStatsRec& stats )
+
+//******************************************************************************************************
+
+/*
+Purpose:	Writes the counts and the histogram to an output stream as one JSON object on one line, in
+			the form p3's searchstats.h writes them. The histogram is an array holding, at each index,
+			the # of locations entered at that depth.
+Pre:		StopStats has been called on stats. dout has been opened.
+Post:		The JSON object has been written to dout.
+*/
+void PrintStatsJson( /* In */	  const SearchStatsRec& stats,	// The counts of the search
+					 /* In/Out */ ostream&				dout )	// The stream to write to
+{
+	dout << "{\"threads\": 1, \"seconds\": " << stats.seconds << ", \"expanded\": " << stats.expanded
+		 << ", \"backtracks\": " << stats.backtracks << ", \"solutions\": " << stats.solutions
+		 << ", \"pruned\": " << stats.pruned << ", \"max_depth\": " << stats.maxDepth
+		 << ", \"depth_histogram\": [";
+
+	// For each depth out to the greatest
+	for( int d = 0; d <= stats.maxDepth; d++ )
+	{
+		dout << ( d > 0 ? ", " : "" ) << ( size_t( d ) < stats.depths.size() ? stats.depths[ d ] : 0 );
+
+	} // End for
+
+	dout << "]}" << endl;
+
+} // End PrintStatsJson( const SearchStatsRec& stats, ostream& dout )
\ No newline at end of file
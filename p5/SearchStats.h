@@ -0,0 +1,99 @@
+/*
+AUTHOR:
+	Chris Pray
+
+DATE:
+	10/19/26
+
+FILENAME:
+	SearchStats.h
+
+PURPOSE:
+	This file contains the SearchStatsRec struct and the prototypes for the functions that count what
+	SolveMaze does while it runs: the locations it enters, the times it backtracks out of a location,
+	the solutions it finds, and the greatest depth it reaches, along with a histogram of the depths
+	of the locations it enters. The depth of a location is the # of characters in the path to it,
+	counting the 'S' into the maze, which is the # of locations on the path. The counts are those
+	p3's searchstats.h keeps for the iterative solver, so that the two can be compared; SolveMaze
+	never drops a location early, so its # of locations pruned is always 0.
+
+	The search runs on one thread, so the counts are plain integers, and the search itself prints
+	them to cerr every so often: every STATS_CHECK_NODES locations entered, it looks at the clock,
+	and prints the counts if it is time to. Once the search has stopped, the counts and the histogram
+	can be written out as a JSON object.
+
+	The counting is compiled in only when SEARCH_STATS is defined. Every call to these functions from
+	the search is wrapped in SEARCH_STAT, which drops the call when SEARCH_STATS is not defined, so
+	that a build without it runs the search exactly as it did before.
+
+SUMMARY OF FUNCTIONS:
+
+	void StartStats(SearchStatsRec&, const double)
+		Sets every count to 0 and notes the time, for a search that prints its counts every so many
+		seconds.
+
+	void CountNode(SearchStatsRec&, const int)
+		Records a location entered at a depth, and prints the counts if it is time to.
+
+	void CountBacktrack(SearchStatsRec&)
+		Records a backtrack out of a location.
+
+	void CountSolution(SearchStatsRec&)
+		Records a solution found.
+
+	void StopStats(SearchStatsRec&)
+		Notes how long the search ran.
+
+	void PrintStatsJson(const SearchStatsRec&, ostream&)
+		Writes the counts and the histogram to an output stream as a JSON object.
+*/
+
+#ifndef SearchStats_h
+#define SearchStats_h
+
+#include <chrono>				// For steady_clock
+#include <ostream>				// For ostream
+#include <vector>				// For vector
+using namespace std;
+
+// Wraps a statement that records into a SearchStatsRec, so that it is only compiled in when
+//  SEARCH_STATS is defined
+#ifdef SEARCH_STATS
+#define SEARCH_STAT( ... ) __VA_ARGS__
+#else
+#define SEARCH_STAT( ... )
+#endif
+
+const long long STATS_CHECK_NODES = 1 << 16;	// # of locations entered between looks at the clock
+
+struct SearchStatsRec
+{
+	long long expanded;		// # of locations entered
+	long long backtracks;	// # of times the search backtracked out of a location
+	long long solutions;	// # of solutions found
+	long long pruned;		// # of locations dropped early; always 0
+	int maxDepth;			// Greatest depth entered
+	vector<long long> depths;	// # of locations entered at each depth
+	chrono::steady_clock::time_point startTime;	// When the search began
+	double reportSeconds;	// # of seconds between reports, or 0 for none
+	double nextReport;		// Seconds into the search to print the next report at
+	double seconds;			// # of seconds the search ran, once it has stopped
+
+}; // End SearchStatsRec
+
+// Prototypes
+void StartStats( SearchStatsRec&, const double );
+	// Sets every count to 0 and notes the time, for a search that prints its counts every so many
+	//  seconds.
+void CountNode( SearchStatsRec&, const int );
+	// Records a location entered at a depth, and prints the counts if it is time to.
+void CountBacktrack( SearchStatsRec& );
+	// Records a backtrack out of a location.
+void CountSolution( SearchStatsRec& );
+	// Records a solution found.
+void StopStats( SearchStatsRec& );
+	// Notes how long the search ran.
+void PrintStatsJson( const SearchStatsRec&, ostream& );
+	// Writes the counts and the histogram to an output stream as a JSON object.
+
+#endif
\ No newline at end of file